@@ -4,9 +4,53 @@
 #ifndef AUDIO_H
 #define AUDIO_H
 
+// One note per key, 48 or 96 (Tools/gen_tables.py has tables for both)
+#ifndef MAX_NOTES
 #define MAX_NOTES 48
+#endif
 #define NUM_MODES 4
 
+// Voices mixed at once. Lower it to bound the render time; once all are
+// in use a new note steals the least audible one. More keys do not raise it.
+#ifndef AUDIO_MAX_VOICES
+#define AUDIO_MAX_VOICES 48
+#endif
+
+#if AUDIO_MAX_VOICES > MAX_NOTES
+#error "AUDIO_MAX_VOICES can be at most MAX_NOTES"
+#endif
+
+// Output rate of the DAC, independent of the notes being played.
+// 32000, 44100 and 48000 are the intended settings.
+#define AUDIO_SAMPLE_RATE 48000
+
+// Samples rendered per DMA half-transfer. Latency is 2 blocks; smaller
+// blocks react faster, larger ones spend less time per sample on overhead.
+#define AUDIO_BLOCK_SIZE 64
+
+// log2 of the wavetable length, 8, 10 or 11. Larger tables cost flash
+// and cache misses but lower the distortion of truncated lookup.
+#ifndef AUDIO_WAVETABLE_BITS
+#define AUDIO_WAVETABLE_BITS 8
+#endif
+
+typedef enum {
+	AUDIO_OSC_TRUNCATE, // nearest lower table entry
+	AUDIO_OSC_LINEAR // linear interpolation between entries
+} audio_osc_quality_t;
+
+// Oscillator lookup at startup, audio_set_osc_quality changes it at run time
+#define AUDIO_OSC_QUALITY AUDIO_OSC_TRUNCATE
+
+// Mix bus headroom in 6 dB steps. One voice at full amp plays at
+// 1/2^AUDIO_HEADROOM_BITS of full scale, louder chords are bent by a soft
+// clip rather than turning every voice down.
+#define AUDIO_HEADROOM_BITS 2
+
+// Length of the crossfade between timbres on a mode change, 0 to switch
+// on the next block boundary without one
+#define AUDIO_XFADE_SAMPLES (AUDIO_SAMPLE_RATE / 50)
+
 #define NUM_TUT_NOTES 3
 
 #define TUT_X 5
@@ -15,45 +59,94 @@
 #define CORR_X (DISP_WIDTH - (2*CHAR_WIDTH + CHAR_PADDING) * 10)/2
 #define CORR_Y (DISP_HEIGHT - CHAR_HEIGHT * 10)/4
 
+typedef enum {
+	ENV_ATTACK, // linear rise to the note's amp
+	ENV_DECAY, // toward sustain while held, toward 0 once released
+	ENV_STEAL // linear fade to 0 before pending_note takes the voice
+} env_stage_t;
+
 typedef struct audio_ctx_s {
 	int num_notes;
 	int notes[MAX_NOTES];
-	int cycles[MAX_NOTES];
-	int cycles_per_wave[MAX_NOTES];
-	float amps[MAX_NOTES];
+	uint32_t phase[MAX_NOTES]; // 0.32 fixed point fraction of a cycle
+	uint32_t phase_inc[MAX_NOTES]; // freq / sample rate in the same format
+	uint8_t mip_level[MAX_NOTES]; // which of the mode's band-limited tables to play
+	float amps[MAX_NOTES]; // envelope level at the start of the next block
+	float peak_amps[MAX_NOTES]; // amp the note was played at
+	uint8_t env_stage[MAX_NOTES]; // env_stage_t
+	float env_step[MAX_NOTES]; // per-sample change in ENV_ATTACK and ENV_STEAL
+	int32_t gains[MAX_NOTES]; // amps at the start of the block, in the mixer's format
+	int32_t gain_steps[MAX_NOTES]; // per-sample ramp to the end of the block
 	float played_amps[MAX_NOTES];
-	uint16_t damp_factor; // High or low bits for high or low damp
+	uint8_t high_damp[MAX_NOTES]; // 1 once the key is released
+	int8_t voice_of_note[MAX_NOTES]; // index into the arrays above, -1 if silent
+	int8_t pending_note[MAX_NOTES]; // note taking over a stolen voice, -1 if none
+	float pending_amp[MAX_NOTES];
 } audio_ctx_t;
 
+/*
+ * Clears all voices and selects the wavetable for the current mode.
+ * Only for startup, before audio_start.
+ */
 void init_audio_ctx();
 
 /*
- * Fills in list of frequencies freqs;
+ * Switches every voice, sounding ones included, to new_mode's wavetable.
+ * Takes effect at the next block with a short crossfade. Safe to call
+ * while audio is running.
+ */
+void audio_set_mode(uint8_t new_mode);
+
+/*
+ * Selects how the oscillators read their tables, from the next block on.
+ * Safe to call while audio is running.
  */
-void fill_freqs();
+void audio_set_osc_quality(audio_osc_quality_t quality);
 
 /*
- * Adds note to list of notes.
+ * Adds note to list of notes, or restarts it if already sounding.
+ * With all AUDIO_MAX_VOICES in use, fades out the quietest released voice
+ * (or the quietest voice if none are released) and starts note in it.
  */
 void add_note(int note_idx, float note_amp);
 
 /*
  * Sets the damp factor for a given note (existing in audio ctx)
- * If high is 1, sets it to high, else low damping factor
+ * If high is 1, sets it to high, else low damping factor. Constant time.
  */
 void set_damp_factor(int note, int high);
 
 /*
- * Decays all amplitudes by some factor and removes dead notes.
+ * Advances every voice's envelope by len samples, sets up the gain ramps
+ * the mixer follows over them and removes dead notes.
  */
-void update_amps();
+void update_amps(int len);
 
 /*
- * Inits the timer
+ * Inits TIM4 to trigger a DAC conversion at AUDIO_SAMPLE_RATE
  */
 void init_timer();
 
-void audio_tim_isr();
+/*
+ * Starts circular DMA from the ping-pong buffer to the DAC.
+ * Blocks are rendered from the DMA half/complete callbacks.
+ */
+void audio_start();
+
+/*
+ * Percentage of the block period the last block took to render, and how
+ * far the load governor has cut back to stay under it: 0 not at all, 1
+ * quiet voices culled early, 2 also truncated lookup. Both stay 0 unless
+ * the profiler is built in (PROFILE_ENABLED), which does the measuring.
+ */
+uint8_t audio_load();
+uint8_t audio_gov_level();
+
+/*
+ * Renders len samples (at most AUDIO_BLOCK_SIZE) of all voices as
+ * 12-bit DAC values.
+ */
+void audio_render_block(uint16_t *out, int len);
 
 void print_mode();
 
@@ -67,4 +160,9 @@ uint8_t is_note_correct(uint8_t note_idx);
 
 void tut_init_display();
 
+/*
+ * Starts the tutorial song over from its first note.
+ */
+void tut_restart();
+
 #endif
@@ -0,0 +1,59 @@
+/*
+ * Generated by Tools/gen_tables.py, do not edit.
+ */
+#ifndef AUDIO_TABLES_H
+#define AUDIO_TABLES_H
+
+#include <stdint.h>
+#include "audio.h"
+
+#define WAVETABLE_BITS AUDIO_WAVETABLE_BITS
+#define WAVETABLE_SIZE (1 << WAVETABLE_BITS)
+
+// A voice plays mip level (top set bit of its phase increment) - MIPMAP_BASE_BIT,
+// clamped to the levels there are
+#define MIPMAP_BASE_BIT 22
+#if MAX_NOTES <= 48
+#define MIPMAP_LEVELS 5
+#elif MAX_NOTES <= 96
+#define MIPMAP_LEVELS 9
+#else
+#error "No mip levels for MAX_NOTES, add it to Tools/gen_tables.py"
+#endif
+
+/*
+ * One cycle of each mode's waveform per mip level, peak 2047 around
+ * zero, plus a copy of the first sample at [WAVETABLE_SIZE]. Each level
+ * keeps only the partials below Nyquist for the highest phase increment
+ * that uses it; levels that come out the same share a table.
+ */
+extern const int16_t *const wavetables[NUM_MODES][MIPMAP_LEVELS];
+
+/*
+ * Per-note 0.32 fixed-point phase increment at AUDIO_SAMPLE_RATE, enough
+ * for the largest MAX_NOTES.
+ */
+#define NOTE_TABLE_SIZE 96
+extern const uint32_t note_phase_inc[NOTE_TABLE_SIZE];
+
+typedef struct envelope_s {
+	uint32_t attack_samples; // linear rise from 0 to the note's amp
+	float decay; // per-sample factor toward sustain while held
+	float sustain; // held level relative to the note's amp
+	float release; // per-sample factor toward 0 after key-up
+} envelope_t;
+
+/*
+ * Each mode's ADSR at AUDIO_SAMPLE_RATE.
+ */
+extern const envelope_t mode_envelopes[NUM_MODES];
+
+#define SOFT_CLIP_SIZE 4096
+
+/*
+ * Soft clip curve for non-negative mix levels, in the same units as the
+ * wavetables. Levels from SOFT_CLIP_SIZE up map to the last entry.
+ */
+extern const int16_t soft_clip[SOFT_CLIP_SIZE];
+
+#endif
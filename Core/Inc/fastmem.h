@@ -0,0 +1,25 @@
+/*
+ * Placement of the audio hot path in SRAM2, see .ramfunc and .fastdata in
+ * the linker scripts. Whether it renders a block in fewer cycles than
+ * from flash has not been measured: compare PROF_AUDIO_BLOCK with
+ * USE_FASTMEM at 0 and 1 before counting on it.
+ */
+#ifndef FASTMEM_H
+#define FASTMEM_H
+
+// Set to 0 to leave everything in flash, e.g. to compare timings
+#ifndef USE_FASTMEM
+#define USE_FASTMEM 1
+#endif
+
+#if USE_FASTMEM && defined(__arm__)
+// Function copied to and run from SRAM2
+#define RAMFUNC __attribute__((section(".ramfunc")))
+// Constant data copied to SRAM2
+#define FASTDATA __attribute__((section(".fastdata")))
+#else
+#define RAMFUNC
+#define FASTDATA
+#endif
+
+#endif
@@ -0,0 +1,47 @@
+/*
+ * Which keys are down, as a bitmap with bit n for note n. Updated from
+ * each chip's touch status by the read completion, which also queues the
+ * key events on keyq. The queries are safe from the main loop.
+ */
+#ifndef KEYBOARD_H
+#define KEYBOARD_H
+
+#include <stdint.h>
+#include "mpr121.h"
+
+#define KEYS_PER_CHIP 12
+#define KEYBOARD_KEYS (MPR121_NUM_CHIPS * KEYS_PER_CHIP)
+
+#define KEYBOARD_WORDS ((KEYBOARD_KEYS + 63) / 64) // bit n is bit n % 64 of word n / 64
+
+/*
+ * Takes a fresh touch status for chip and queues an event for each key
+ * that changed. velocity has one entry per electrode for the presses, or
+ * is 0 if they were not measured. A change that does not fit in keyq is
+ * left out of the bitmap and tried again with the chip's next status.
+ * Interrupt context, or with interrupts masked.
+ */
+void keyboard_update(uint8_t chip, uint16_t status, const uint8_t *velocity);
+
+/*
+ * Copies a snapshot of the bitmap into map, KEYBOARD_WORDS words.
+ */
+void keyboard_held(uint64_t *map);
+
+/*
+ * Number of keys down.
+ */
+int keyboard_count();
+
+/*
+ * Lowest and highest note down, -1 if none.
+ */
+int keyboard_lowest();
+int keyboard_highest();
+
+/*
+ * Nonzero if note is down.
+ */
+int keyboard_is_held(uint8_t note);
+
+#endif
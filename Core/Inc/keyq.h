@@ -0,0 +1,43 @@
+/*
+ * Single-producer/single-consumer queue of key events. The touch read
+ * completion pushes from interrupt context, the main loop pops. Neither
+ * side masks interrupts; each only writes its own index.
+ */
+#ifndef KEYQ_H
+#define KEYQ_H
+
+#include <stdint.h>
+
+// Must be a power of two
+#define KEYQ_SIZE 64
+
+typedef struct key_event_s {
+	uint32_t time; // HAL_GetTick() when the touch status was read
+	uint8_t note; // 0 to MAX_NOTES - 1
+	uint8_t on; // 1 for a press, 0 for a release
+	uint16_t pressure; // that hand's pressure reading at the time
+	uint8_t velocity; // presses: 1 to 255 from the strike, 0 if not measured
+} key_event_t;
+
+/*
+ * Producer side. Returns 0, or -1 and counts a drop if the queue is full.
+ */
+int keyq_push(const key_event_t *ev);
+
+/*
+ * Consumer side. Copies up to max of the oldest events into evs and
+ * returns how many.
+ */
+int keyq_pop(key_event_t *evs, int max);
+
+/*
+ * Nonzero while events are waiting.
+ */
+int keyq_pending();
+
+/*
+ * Events lost to a full queue since startup.
+ */
+uint32_t keyq_dropped();
+
+#endif
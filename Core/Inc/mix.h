@@ -0,0 +1,50 @@
+#ifndef MIX_H
+#define MIX_H
+
+#include <stdint.h>
+
+// Gain of 1.0 in the Q14 format taken by the mixer. Q14 rather than Q15 so
+// 48 voices of 12-bit samples at full gain still fit a 32-bit accumulator.
+#define MIX_GAIN_BITS 14
+#define MIX_GAIN_ONE (1 << MIX_GAIN_BITS)
+
+// Gains are passed as Q14 in the top half of a word, the low half holds
+// the fraction that lets a slow ramp advance a little every sample
+#define MIX_RAMP_BITS 16
+
+// Phase bits below the table index used as the interpolation fraction
+#define MIX_FRAC_BITS 15
+
+/*
+ * Adds num_voices wavetable oscillators into acc[0..len).
+ * Voice i reads table[i][phase[i] >> shift], advances by phase_inc[i] every
+ * sample and is scaled by gain[i] >> MIX_RAMP_BITS (Q14), with gain[i]
+ * growing by gain_step[i] after each sample. phase[] is left where the run
+ * ended, gain[] is not touched.
+ * Uses the Cortex-M4 DSP instructions to mix two voices at a time when
+ * available, otherwise it is the same as mix_voices_ref.
+ */
+void mix_voices(int32_t *acc, int len, const int16_t *const *table, int shift, uint32_t *phase,
+		const uint32_t *phase_inc, const int32_t *gain, const int32_t *gain_step, int num_voices);
+
+/*
+ * Plain C version of mix_voices, bit-exact with it.
+ */
+void mix_voices_ref(int32_t *acc, int len, const int16_t *const *table, int shift, uint32_t *phase,
+		const uint32_t *phase_inc, const int32_t *gain, const int32_t *gain_step, int num_voices);
+
+/*
+ * Same as mix_voices but interpolates linearly between table[i][n] and
+ * table[i][n + 1], so every table needs one entry past the end repeating
+ * the first. shift must be at least MIX_FRAC_BITS.
+ */
+void mix_voices_lerp(int32_t *acc, int len, const int16_t *const *table, int shift, uint32_t *phase,
+		const uint32_t *phase_inc, const int32_t *gain, const int32_t *gain_step, int num_voices);
+
+/*
+ * Plain C version of mix_voices_lerp, bit-exact with it.
+ */
+void mix_voices_lerp_ref(int32_t *acc, int len, const int16_t *const *table, int shift, uint32_t *phase,
+		const uint32_t *phase_inc, const int32_t *gain, const int32_t *gain_step, int num_voices);
+
+#endif
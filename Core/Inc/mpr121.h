@@ -1,29 +1,162 @@
+#ifndef MPR121_H
+#define MPR121_H
+
 #include <stdint.h>
 
+// Chips are numbered from 0, one per octave, and split evenly over
+// MPR121_NUM_BUSES buses (I2C1, then I2C2). On each bus they sit at
+// consecutive addresses from MPR121_BASE_ADDR.
+#ifndef MPR121_NUM_CHIPS
+#define MPR121_NUM_CHIPS 4
+#endif
+#ifndef MPR121_NUM_BUSES
+#define MPR121_NUM_BUSES 1
+#endif
+#define MPR121_BASE_ADDR 0x5A
+#define MPR121_CHIPS_PER_BUS ((MPR121_NUM_CHIPS + MPR121_NUM_BUSES - 1) / MPR121_NUM_BUSES)
+
+// 1 to read the chips on the TIM7 scan instead of their interrupt lines
+#ifndef MPR121_SCAN
+#define MPR121_SCAN 0
+#endif
+
+#define MPR121_NUM_ELECS 12
+
+#if MPR121_NUM_CHIPS > 8 || MPR121_NUM_BUSES > 2 || MPR121_CHIPS_PER_BUS > 4
+#error "up to 4 MPR121s on each of I2C1 and I2C2"
+#endif
+#if MPR121_NUM_CHIPS > 4 && !MPR121_SCAN
+#error "only four chips have interrupt lines, more need MPR121_SCAN"
+#endif
+
 /*
- * Initializes the MPR121 at the specified I2C address
+ * A chip's thresholds and what it has learned of its electrodes, to be
+ * kept across power cycles.
+ */
+typedef struct mpr121_calib_s {
+	uint8_t thresholds[2 * MPR121_NUM_ELECS]; // touch and release for each electrode in turn
+	uint8_t baselines[MPR121_NUM_ELECS]; // top 8 of 10 bits for each electrode
+	uint8_t has_baselines; // 0 to have the chip learn them when it starts
+} mpr121_calib_t;
+
+/*
+ * Initializes an MPR121.
  * Returns 0 on success and -1 on failure.
  */
-int mpr121_init(uint8_t addr);
+int mpr121_init(uint8_t chip);
 
 /*
- * addr is a 7-bit address without r/w bit.
+ * Blocking register access, giving up after 10 ms in all, waiting for
+ * the bus to go idle included.
  * Returns 0 on success and -1 on failure.
  */
-int mpr121_read(uint8_t addr, uint8_t reg_addr, uint8_t *data, int size);
-int mpr121_write(uint8_t addr, uint8_t reg_addr, uint8_t *data, int size);
+int mpr121_read(uint8_t chip, uint8_t reg_addr, uint8_t *data, int size);
+int mpr121_write(uint8_t chip, uint8_t reg_addr, uint8_t *data, int size);
 
 /*
  * The least significant 12 bits of the returned value represent touch status of the 12 electrodes.
  * Returns ~0 on failure;
  */
-uint16_t mpr121_read_touch_status(uint8_t addr);
-uint16_t mpr121_read_touch_status_nb(uint8_t addr);
+uint16_t mpr121_read_touch_status(uint8_t chip);
+
+/*
+ * Queues a DMA read of the chip's touch status and returns without
+ * waiting. The chips' interrupts queue one on their own. When a read
+ * lands, a key event goes on keyq for each electrode that changed. If
+ * one went down, a second read of the chip's filtered and baseline data
+ * goes first, and the presses carry a velocity estimated from it.
+ * Returns the status from the chip's last completed read, ~0 if none.
+ */
+uint16_t mpr121_read_touch_status_nb(uint8_t chip);
+
+/*
+ * The touch status from the last completed DMA read of chip, ~0 if none.
+ * Does not touch the bus.
+ */
+uint16_t mpr121_touch_status(uint8_t chip);
 
 /*
  * Sets the touch and release thresholds for all electrodes in an MPR121.
+ * They are kept for the chip's next init.
  * Returns 0 on success and -1 on failure.
  */
-int mpr121_set_thresholds(uint8_t addr, uint8_t touch, uint8_t release);
+int mpr121_set_thresholds(uint8_t chip, uint8_t touch, uint8_t release);
+
+/*
+ * Sets what the background init sets chip up with, in place of the
+ * default thresholds and learning the baselines. Call before
+ * mpr121_init_start, or it waits for the chip's next init.
+ */
+void mpr121_set_calib(uint8_t chip, const mpr121_calib_t *calib);
+
+/*
+ * Queues a DMA read of chip's current baselines, behind any touch status
+ * reads, and returns without waiting. It waits while the chip is down.
+ */
+void mpr121_read_calib_nb(uint8_t chip);
+
+/*
+ * Copies chip's thresholds, and the baselines from the read
+ * mpr121_read_calib_nb asked for, into calib. Does not touch the bus.
+ * Returns 0 on success and -1 if that read has not landed yet, or the
+ * chip dropped out since.
+ */
+int mpr121_get_calib(uint8_t chip, mpr121_calib_t *calib);
+
+/*
+ * Starts a DMA read into data (or an interrupt-driven write from it) and
+ * returns; HAL_I2C_MemRxCpltCallback or HAL_I2C_MemTxCpltCallback runs
+ * when it is done. data must stay valid until then.
+ * Returns 0 if the transfer started and -1 if the bus is busy or failed.
+ */
+int mpr121_read_nb(uint8_t chip, uint8_t reg_addr, uint8_t *data, int size);
+int mpr121_write_nb(uint8_t chip, uint8_t reg_addr, uint8_t *data, int size);
+
+/*
+ * Starts initializing every chip in the background, as mpr121_init does
+ * one at a time: all are stopped and reset, then after a single reset
+ * delay each is verified, given the default thresholds and enabled. Each
+ * bus runs its own chips at the same time as the other. The I2C
+ * interrupts chain the steps; mpr121_init_poll has to be called to get
+ * past the reset delay.
+ */
+void mpr121_init_start();
+
+/*
+ * Moves the background init along, as mpr121_poll does. Returns 1 once
+ * every chip has come up or failed, 0 before that.
+ */
+int mpr121_init_poll();
+
+/*
+ * Keeps the touch controllers going, call it from the main loop. A bus
+ * whose transfer has hung or lost arbitration is reset and clocked free,
+ * the other bus carries on meanwhile. Reads left waiting after a failed
+ * transfer are started again. A chip that fails three transfers
+ * in a row is dropped, its keys are released, and it is re-initialized
+ * in the background about once a second until it comes back, as are
+ * chips that never came up.
+ */
+void mpr121_poll();
+
+/*
+ * Failed transfers to chip since startup.
+ */
+uint32_t mpr121_errors(uint8_t chip);
+
+/*
+ * Bit n set if chip n came up and verified.
+ */
+uint8_t mpr121_ready();
+
+/*
+ * Starts and stops reading every ready chip's touch status on each TIM7
+ * update (1 kHz), in place of the chips' interrupt lines (PE10/12/14/15).
+ * The buses are read at the same time, each chip after the other on its
+ * own bus. The results land in the same place as the interrupt driven
+ * reads. A scan that has not finished by the next tick absorbs it.
+ */
+void mpr121_scan_start();
+void mpr121_scan_stop();
 
-int mpr121_read_nb(uint8_t addr, uint8_t reg_addr, uint8_t *data, int size);
+#endif
@@ -0,0 +1,100 @@
+/*
+ * Cycle counts of named code zones from the DWT cycle counter.
+ *
+ *   uint32_t t = profile_begin();
+ *   ...
+ *   profile_end(PROF_UPDATE_AMPS, t);
+ *
+ * Stats stay in prof_stats for the debugger to read. Built in when
+ * PROFILE_ENABLED is 1, which is the default on the target.
+ */
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <stdint.h>
+
+#ifndef PROFILE_ENABLED
+#ifdef __arm__
+#define PROFILE_ENABLED 1
+#else
+#define PROFILE_ENABLED 0
+#endif
+#endif
+
+#if PROFILE_ENABLED
+#include "stm32l4xx.h"
+#endif
+
+typedef enum {
+	PROF_AUDIO_BLOCK, // DAC DMA callback rendering one block
+	PROF_UPDATE_AMPS,
+	PROF_GPIO_EXTI,
+	PROF_DISP_FILL_RECT,
+	PROF_UART_RX,
+	PROF_NUM_ZONES
+} prof_zone_t;
+
+// Bucket b counts runs of 2^(b-1) to 2^b - 1 cycles, the last one
+// everything longer
+#define PROF_HIST_BUCKETS 24
+
+typedef struct prof_stats_s {
+	uint32_t count;
+	uint32_t min;
+	uint32_t max;
+	uint64_t total;
+	uint32_t budget; // cycles a run may take, 0 for no limit
+	uint32_t overruns; // runs over budget
+	uint32_t hist[PROF_HIST_BUCKETS];
+} prof_stats_t;
+
+extern prof_stats_t prof_stats[PROF_NUM_ZONES];
+
+// Set once any zone goes over its budget, cleared by profile_reset
+extern volatile uint8_t prof_overrun;
+
+#if PROFILE_ENABLED
+
+/*
+ * Starts the DWT cycle counter and clears all stats.
+ */
+void profile_init();
+
+/*
+ * Clears all stats and the overrun flag, keeping the budgets.
+ */
+void profile_reset();
+
+/*
+ * Sets the cycles a run of zone may take before it counts as an overrun.
+ */
+void profile_set_budget(prof_zone_t zone, uint32_t cycles);
+
+/*
+ * Mean cycles per run of zone, 0 if it has not run.
+ */
+uint32_t profile_avg(prof_zone_t zone);
+
+/*
+ * Records a run of zone that started at start, from profile_begin.
+ * Returns the cycles it took.
+ */
+uint32_t profile_end(prof_zone_t zone, uint32_t start);
+
+static inline uint32_t profile_begin()
+{
+	return DWT->CYCCNT;
+}
+
+#else
+
+static inline void profile_init() { }
+static inline void profile_reset() { }
+static inline void profile_set_budget(prof_zone_t zone, uint32_t cycles) { }
+static inline uint32_t profile_avg(prof_zone_t zone) { return 0; }
+static inline uint32_t profile_end(prof_zone_t zone, uint32_t start) { return 0; }
+static inline uint32_t profile_begin() { return 0; }
+
+#endif
+
+#endif
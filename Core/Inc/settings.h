@@ -0,0 +1,60 @@
+/*
+ * Settings kept in internal flash across power cycles, as a log of
+ * key-value records in the SETTINGS region of STM32L4R5ZITXP_FLASH.ld.
+ * A change appends a record; the latest one for a key is its value. When
+ * the log fills, the latest records are copied to the other half of the
+ * region, so the two halves take turns being erased.
+ * Main loop only: a write can stall it for a page erase.
+ *
+ * Needs the flash in dual-bank mode (DBANK set, the default), so that
+ * erasing in bank 2 leaves the code in bank 1 running. With a single
+ * bank, every fetch stalls for a whole page erase, and that includes
+ * the audio interrupts. In that mode settings_init leaves the log
+ * alone, settings_get finds nothing, and settings_set fails.
+ *
+ * A reset partway through a write can leave a double word whose ECC does
+ * not match, and reading it raises an NMI. NMI_Handler passes those to
+ * settings_nmi, which clears the error when it is in the region and
+ * flags it, and settings_init takes the record it was reading as
+ * damaged.
+ */
+#ifndef SETTINGS_H
+#define SETTINGS_H
+
+#include <stdint.h>
+
+// Largest value a key can hold
+#define SETTINGS_MAX_SIZE 64
+
+typedef enum {
+	SETTING_MODE = 1, // uint8_t, the instrument mode
+	SETTING_CALIB = 0x10 // + chip, mpr121_calib_t
+} setting_key_t;
+
+/*
+ * Finds the current log, if the flash is dual bank. Call once at
+ * startup, before the others.
+ */
+void settings_init();
+
+/*
+ * Call from NMI_Handler. Clears a double ECC error in a read of the
+ * SETTINGS region, for settings_init to see. Returns 1 if that is what
+ * raised the NMI and 0 if not.
+ */
+int settings_nmi();
+
+/*
+ * Copies the value of key into data if it has one of exactly size bytes.
+ * Returns 0 if it did and -1 if not.
+ */
+int settings_get(uint16_t key, void *data, int size);
+
+/*
+ * Sets the value of key to size bytes of data, at most SETTINGS_MAX_SIZE.
+ * Nothing is written if it already has that value.
+ * Returns 0 on success and -1 on failure.
+ */
+int settings_set(uint16_t key, const void *data, int size);
+
+#endif
@@ -1,40 +1,64 @@
 #include <stdint.h>
 #include <string.h>
-#include <math.h>
 #include "stm32l4xx_hal.h"
 #include "audio.h"
+#include "audio_tables.h"
 #include "display.h"
+#include "fastmem.h"
+#include "mix.h"
+#include "profile.h"
 
-#define LUT_SIZE 256
+// Top WAVETABLE_BITS of a 32-bit phase accumulator index the wavetable
+#define PHASE_SHIFT (32 - WAVETABLE_BITS)
 #define INIT_AMP 0.5
 #define DEAD_THRESHOLD 0.0001
-#define NUM_HARM 6
 
+// Keep in step with TIM_CLK in Tools/gen_tables.py
 #define PRESCALER 1
 #define BASE_CLK 120000000
-#define LOWEST_FREQ 65.41
 
-#define PI 3.14159265
-#define HIGH_DAMP_FACTOR 0.95
-#define LOW_DAMP_FACTOR 0.9992
-#define ATTACK_FACTOR 0.2
+// TIM4 reload for AUDIO_SAMPLE_RATE
+#define TIM_PERIOD ((BASE_CLK / (PRESCALER + 1) + AUDIO_SAMPLE_RATE / 2) / AUDIO_SAMPLE_RATE)
 
-#define AMP_UPDATE_INTR_COUNT 50
+// A stolen voice ramps down over 2 ms before the new note starts in it
+#define STEAL_FADE_SAMPLES (AUDIO_SAMPLE_RATE / 500)
+
+// Load governor, loads in percent of the block period. Each block over
+// GOV_HIGH_LOAD sheds one more level of work, GOV_RESTORE_BLOCKS in a row
+// under GOV_LOW_LOAD give one back.
+#define GOV_HIGH_LOAD 80
+#define GOV_LOW_LOAD 50
+#define GOV_RESTORE_BLOCKS 200
+#define GOV_CULL_THRESHOLD 0.01 // -40 dB
+
+enum {
+	GOV_FULL,
+	GOV_CULL, // drop voices under GOV_CULL_THRESHOLD
+	GOV_CHEAP_OSC, // and fall back to truncated lookup
+	GOV_LEVELS
+};
+
+#define DAC_MID 2048
 
-static float freqs[48];
 static audio_ctx_t ctx;
-static int sin_lut[LUT_SIZE];
 
-static const float  haramonic_piano[NUM_HARM] = {1, 0.4, 0.2, 0.1, 0.6, 0.15};
-static const float  haramonic_flute[NUM_HARM] = {1, 0, 0, 0, 0, 0};
-static const float  haramonic_misc[NUM_HARM] = {0.75, 0.2, 0.2, 0.2, 0.2, 0.2};
-static const float  haramonic_nada[NUM_HARM] = {0.8, 0.6, 0.4, 0.2, 0.1, 0};
+// Mode the voices play. Only the render path changes it, picking up
+// next_mode at the start of a block and crossfading from prev_mode.
+static uint8_t cur_mode;
+static volatile uint8_t next_mode;
+static uint8_t prev_mode;
+static const envelope_t *envelope;
+static int xfade_left; // samples of crossfade still to play
 
-static const float* harmonic_amps[NUM_MODES] = {haramonic_piano, haramonic_flute, haramonic_misc, haramonic_nada};
+static volatile uint8_t osc_quality = AUDIO_OSC_QUALITY;
 
-static int intr_freq;
+static uint32_t block_budget; // cycles per block period
+static volatile uint8_t gov_level;
+static volatile uint8_t gov_load;
+static int gov_calm_blocks;
 
-static int amp_update_counter;
+// Ping-pong DAC buffer, DMA plays one half while the other is rendered
+static uint16_t dac_buf[2 * AUDIO_BLOCK_SIZE];
 
 /* TUTORIAL MODE VARS*/
 
@@ -48,42 +72,12 @@ static const char* correct_tut_notes[NUM_TUT_NOTES] = {"E ", "C ", "D ", "E ", "
 
 extern DAC_HandleTypeDef hdac1;
 extern TIM_HandleTypeDef htim4;
-extern uint8_t sustain;
-extern uint8_t chmod;
-extern uint8_t mode;
-extern tutorial_mode;
-extern best_index;
-extern pressure_wait;
-
-void fill_freqs()
-{
-	double freq = LOWEST_FREQ;
-	double m = pow(2, (double)1/12);
-	for (int i = 0; i < 48; i++) {
-		freqs[i] = (float) freq;
-		freq *= m;
-	}
-	intr_freq = (int) freqs[47]*LUT_SIZE;
-}
-
-void fill_sin_lut()
-{
-	float* temp_haram = *harmonic_amps + mode;
-	float harm_amp_sum = 0;
-	for (int i = 0; i < NUM_HARM; i++) {
-		harm_amp_sum += temp_haram[i];
-	}
-
-	// creates a sine wave look up table centered at VREF/2
-	for(uint16_t i = 0; i < LUT_SIZE; ++i) {
-		sin_lut[i] = 0;
-		for (int j = 0; j < NUM_HARM; j++) {
-//			sin_lut[i] += (int) (sin((double) 2 * PI * i * (j+1) / LUT_SIZE) * 2047 * harmonic_amps[j]);
-			sin_lut[i] += (int) (sin((double) 2 * PI * i * (3*j/4 +1) / LUT_SIZE) * 2047 * (temp_haram[j]));
-		}
-		sin_lut[i] /= harm_amp_sum;
-	}
-}
+extern volatile uint8_t sustain;
+extern volatile uint8_t chmod;
+extern volatile uint8_t mode;
+extern volatile uint8_t tutorial_mode;
+extern volatile int best_index;
+extern volatile int pressure_wait;
 
 const char *keys[12] = {"C ", "C#", "D ", "D#", "E ", "F ", "F#", "G ", "G#", "A ", "A#", "B "};
 
@@ -114,36 +108,199 @@ void print_mode()
 	disp_print(modes[mode], x, y, size, 0xa839, 0x0000);
 }
 
-// TODO: scale amplitude depending on frequency
-void add_note(int note_idx, float note_amp)
+/*
+ * Converts an envelope level to the mixer's ramping gain format.
+ */
+RAMFUNC static int32_t amp_to_gain(float amp)
 {
-	if (ctx.num_notes >= MAX_NOTES) {
-		// ERROR or remove lowest amp note??
-		return;
+	if (amp >= 1.0f) {
+		return MIX_GAIN_ONE << MIX_RAMP_BITS;
 	}
+	return (int32_t) (amp * (MIX_GAIN_ONE << MIX_RAMP_BITS));
+}
 
-	float scaled_amp = note_amp;
-	uint8_t note_exists = 0;
-	uint8_t existing_note_idx = MAX_NOTES + 1;
+/*
+ * f to the power n, for turning per-sample factors into per-block ones.
+ */
+RAMFUNC static float pow_len(float f, int n)
+{
+	float result = 1.0f;
+
+	while (n > 0) {
+		if (n & 1) {
+			result *= f;
+		}
+		f *= f;
+		n >>= 1;
+	}
+	return result;
+}
+
+/*
+ * Masks interrupts so the main loop can change voices without the DAC
+ * callbacks seeing them half updated. Returns the state for irq_restore.
+ */
+static uint32_t irq_save()
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	return primask;
+}
+
+static void irq_restore(uint32_t primask)
+{
+	__set_PRIMASK(primask);
+}
+
+/*
+ * Drops voice i by moving the last voice into its slot.
+ */
+RAMFUNC static void remove_voice(int i)
+{
+	int last = ctx.num_notes - 1;
+
+	ctx.voice_of_note[ctx.notes[i]] = -1;
+	if (i != last) {
+		ctx.notes[i] = ctx.notes[last];
+		ctx.amps[i] = ctx.amps[last];
+		ctx.peak_amps[i] = ctx.peak_amps[last];
+		ctx.env_stage[i] = ctx.env_stage[last];
+		ctx.env_step[i] = ctx.env_step[last];
+		ctx.gains[i] = ctx.gains[last];
+		ctx.gain_steps[i] = ctx.gain_steps[last];
+		ctx.phase[i] = ctx.phase[last];
+		ctx.phase_inc[i] = ctx.phase_inc[last];
+		ctx.mip_level[i] = ctx.mip_level[last];
+		ctx.high_damp[i] = ctx.high_damp[last];
+		ctx.pending_note[i] = ctx.pending_note[last];
+		ctx.pending_amp[i] = ctx.pending_amp[last];
+		// A voice being stolen is only reachable through its new note
+		if (ctx.pending_note[i] >= 0) {
+			ctx.voice_of_note[ctx.pending_note[i]] = i;
+		} else {
+			ctx.voice_of_note[ctx.notes[i]] = i;
+		}
+	}
+	ctx.num_notes--;
+}
+
+/*
+ * Ramps voice v from wherever it is up to amp over the mode's attack.
+ */
+RAMFUNC static void start_attack(int v, float amp)
+{
+	ctx.peak_amps[v] = amp;
+	ctx.high_damp[v] = 0;
+	if (envelope->attack_samples == 0 || ctx.amps[v] >= amp) {
+		ctx.amps[v] = amp;
+		ctx.env_stage[v] = ENV_DECAY;
+	} else {
+		ctx.env_step[v] = amp / envelope->attack_samples;
+		ctx.env_stage[v] = ENV_ATTACK;
+	}
+}
+
+/*
+ * Picks the voice to give up for a new note: the quietest released one,
+ * which is usually the one released longest ago, else the quietest.
+ * Voices already being stolen are skipped. Returns -1 if there is none.
+ */
+static int steal_victim()
+{
+	int victim = -1;
+	int victim_released = 0;
 
-	// Check for existing notes and update amp back to one if present
 	for (int i = 0; i < ctx.num_notes; i++) {
-		if (ctx.notes[i] == note_idx) {
-			note_exists = 1;
-			existing_note_idx = i;
+		if (ctx.env_stage[i] == ENV_STEAL) {
+			continue;
+		}
+		int released = ctx.high_damp[i];
+		if (victim < 0 || released > victim_released
+				|| (released == victim_released && ctx.amps[i] < ctx.amps[victim])) {
+			victim = i;
+			victim_released = released;
 		}
 	}
-	if (!note_exists) {
-		ctx.notes[ctx.num_notes] = note_idx;
-		ctx.amps[ctx.num_notes] = scaled_amp;
-		ctx.cycles[ctx.num_notes] = 0;
-		ctx.cycles_per_wave[ctx.num_notes] = intr_freq / (int) freqs[note_idx];
-		ctx.damp_factor &= ~(1 << ctx.num_notes);
-		ctx.num_notes++;
+	return victim;
+}
+
+/*
+ * Hands voice v over to note_idx once it has faded out, see update_amps.
+ */
+static void steal_voice(int v, int note_idx, float amp)
+{
+	ctx.voice_of_note[ctx.notes[v]] = -1;
+	ctx.voice_of_note[note_idx] = v;
+	ctx.pending_note[v] = note_idx;
+	ctx.pending_amp[v] = amp;
+	ctx.env_stage[v] = ENV_STEAL;
+	ctx.env_step[v] = ctx.amps[v] / STEAL_FADE_SAMPLES;
+	ctx.high_damp[v] = 0;
+}
+
+/*
+ * Sets voice v up to play note_idx from the start of its cycle, with the
+ * mip level for its pitch.
+ */
+RAMFUNC static void set_voice_note(int v, int note_idx)
+{
+	uint32_t inc = note_phase_inc[note_idx];
+	int level = (31 - __builtin_clz(inc)) - MIPMAP_BASE_BIT;
+
+	ctx.notes[v] = note_idx;
+	ctx.phase[v] = 0;
+	ctx.phase_inc[v] = inc;
+	if (level < 0) {
+		level = 0;
+	} else if (level >= MIPMAP_LEVELS) {
+		level = MIPMAP_LEVELS - 1;
+	}
+	ctx.mip_level[v] = level;
+}
+
+/*
+ * Starts the note waiting on a stolen voice that has gone silent.
+ */
+RAMFUNC static void start_pending_note(int i)
+{
+	set_voice_note(i, ctx.pending_note[i]);
+	ctx.pending_note[i] = -1;
+	ctx.amps[i] = 0;
+	// Keep a key-up that came in during the fade
+	uint8_t released = ctx.high_damp[i];
+	start_attack(i, ctx.pending_amp[i]);
+	ctx.high_damp[i] = released;
+}
+
+// TODO: scale amplitude depending on frequency
+void add_note(int note_idx, float note_amp)
+{
+	float scaled_amp = note_amp;
+	uint32_t primask = irq_save();
+	int v = ctx.voice_of_note[note_idx];
+
+	if (v < 0 && ctx.num_notes >= AUDIO_MAX_VOICES) {
+		v = steal_victim();
+		if (v >= 0) {
+			steal_voice(v, note_idx, scaled_amp);
+		}
+	} else if (v < 0) {
+		v = ctx.num_notes++;
+		set_voice_note(v, note_idx);
+		ctx.pending_note[v] = -1;
+		ctx.voice_of_note[note_idx] = v;
+		ctx.amps[v] = 0;
+		start_attack(v, scaled_amp);
+	} else if (ctx.pending_note[v] == note_idx) {
+		// Retriggered while still waiting for its voice
+		ctx.pending_amp[v] = scaled_amp;
+		ctx.high_damp[v] = 0;
 	} else {
-		ctx.amps[existing_note_idx] = scaled_amp;
-		ctx.damp_factor &= ~(1 << existing_note_idx);
+		// Existing notes keep their phase and attack again from their level
+		start_attack(v, scaled_amp);
 	}
+	irq_restore(primask);
+
 	// if in tutorial mode ? check for whether note is correct : nothinbg
 	if (!tutorial_mode) {
 		print_note(note_idx);
@@ -155,90 +312,281 @@ void add_note(int note_idx, float note_amp)
 
 void set_damp_factor(int note, int high)
 {
-	for (int i = 0; i < ctx.num_notes; i++) {
-		if (note == ctx.notes[i]) {
-			if (high) {
-				ctx.damp_factor |= (1 << i);
-			}
-			else {
-				// Low
-				ctx.damp_factor &= ~(1 << i);
-			}
-		}
+	uint32_t primask = irq_save();
+	int v = ctx.voice_of_note[note];
+
+	if (v >= 0) {
+		ctx.high_damp[v] = high ? 1 : 0;
 	}
+	irq_restore(primask);
 }
 
-void update_amps()
+RAMFUNC void update_amps(int len)
 {
-	for (int i = 0; i < ctx.num_notes; i++) {
-		if (sustain) {
-			ctx.amps[i] *= LOW_DAMP_FACTOR;
-		} else if (ctx.damp_factor & (1 << i)) { // decay fast
-			ctx.amps[i] *= HIGH_DAMP_FACTOR;
-		} else {
-			ctx.amps[i] *= LOW_DAMP_FACTOR; //decay slowly
-		}
-	}
+	uint32_t prof_start = profile_begin();
+	float dead_threshold = (gov_level >= GOV_CULL) ? GOV_CULL_THRESHOLD : DEAD_THRESHOLD;
+
+	// Block-rate coefficients, the mixer ramps linearly between them
+	float decay = pow_len(envelope->decay, len);
+	float release = pow_len(envelope->release, len);
+
 	for (int i = ctx.num_notes - 1; i >= 0; i--) {
-		if (ctx.amps[i] <= DEAD_THRESHOLD) {
-			// Remove note
-			ctx.notes[i] = ctx.notes[ctx.num_notes - 1];
-			ctx.amps[i] = ctx.amps[ctx.num_notes - 1];
-			ctx.cycles[i] = ctx.cycles[ctx.num_notes - 1];
-//			ctx.amps[ctx.num_notes - 1] = 0;
-			ctx.cycles_per_wave[i] = ctx.cycles_per_wave[ctx.num_notes - 1];
-			ctx.damp_factor &= ~(1 << i); // removing current note's damp factor
-			ctx.damp_factor |= (1 << (ctx.num_notes - 1));
-			ctx.num_notes--;
+		if (ctx.env_stage[i] == ENV_STEAL && ctx.amps[i] <= 0) {
+			start_pending_note(i);
 		}
-	}
 
+		// Held by the key or the pedal: decay to sustain, else release
+		int releasing = ctx.high_damp[i] && !sustain;
+		float start = ctx.amps[i];
+		float end;
+
+		if (ctx.env_stage[i] == ENV_ATTACK && releasing) {
+			ctx.env_stage[i] = ENV_DECAY;
+		}
+		switch (ctx.env_stage[i]) {
+		case ENV_ATTACK:
+			end = start + ctx.env_step[i] * len;
+			if (end >= ctx.peak_amps[i]) {
+				end = ctx.peak_amps[i];
+				ctx.env_stage[i] = ENV_DECAY;
+			}
+			break;
+		case ENV_STEAL:
+			end = start - ctx.env_step[i] * len;
+			if (end < 0) {
+				end = 0;
+			}
+			break;
+		default:
+			if (start <= dead_threshold) {
+				remove_voice(i);
+				continue;
+			}
+			if (releasing) {
+				end = start * release;
+			} else {
+				float level = envelope->sustain * ctx.peak_amps[i];
+				end = level + (start - level) * decay;
+			}
+			break;
+		}
+
+		ctx.amps[i] = end;
+		ctx.gains[i] = amp_to_gain(start);
+		ctx.gain_steps[i] = (amp_to_gain(end) - ctx.gains[i]) / len;
+	}
+	profile_end(PROF_UPDATE_AMPS, prof_start);
 }
 
 void init_audio_ctx()
 {
-	fill_freqs();
-	fill_sin_lut();
+	cur_mode = mode;
+	next_mode = mode;
+	envelope = &mode_envelopes[mode];
+	xfade_left = 0;
 	memset(&ctx, 0, sizeof(ctx));
-	amp_update_counter = 0;
+	memset(ctx.voice_of_note, -1, sizeof(ctx.voice_of_note));
 	tutorial_index = 0;
 }
 
-void audio_tim_isr()
+void audio_set_mode(uint8_t new_mode)
 {
-	uint32_t index;
-	float dac_out = 0;
-	if (ctx.num_notes == 0) {
-		return;
+	// Single byte store, safe against the DMA callbacks
+	next_mode = new_mode;
+}
+
+void audio_set_osc_quality(audio_osc_quality_t quality)
+{
+	osc_quality = quality;
+}
+
+typedef void (*mix_fn_t)(int32_t *acc, int len, const int16_t *const *table, int shift, uint32_t *phase,
+		const uint32_t *phase_inc, const int32_t *gain, const int32_t *gain_step, int num_voices);
+
+/*
+ * Mixer for the selected oscillator quality.
+ */
+RAMFUNC static mix_fn_t osc_mixer()
+{
+	int linear = osc_quality == AUDIO_OSC_LINEAR && gov_level < GOV_CHEAP_OSC;
+	return linear ? mix_voices_lerp : mix_voices;
+}
+
+RAMFUNC static int32_t soft_clip_level(int32_t level)
+{
+	if (level >= 0) {
+		return soft_clip[(level < SOFT_CLIP_SIZE) ? level : SOFT_CLIP_SIZE - 1];
+	}
+	level = -level;
+	return -soft_clip[(level < SOFT_CLIP_SIZE) ? level : SOFT_CLIP_SIZE - 1];
+}
+
+/*
+ * Points tables[] at each voice's mip level of the given mode.
+ */
+RAMFUNC static void voice_tables(const int16_t **tables, uint8_t table_mode)
+{
+	const int16_t *const *mipmaps = wavetables[table_mode];
+
+	for (int i = 0; i < ctx.num_notes; i++) {
+		tables[i] = mipmaps[ctx.mip_level[i]];
 	}
+}
+
+/*
+ * Mixes the voices through both the outgoing and incoming tables, the
+ * outgoing one fading out linearly over AUDIO_XFADE_SAMPLES.
+ */
+RAMFUNC static void mix_crossfade(int32_t *mix, int len)
+{
+	const int16_t *tables[MAX_NOTES];
+	int32_t gains_out[MAX_NOTES], steps_out[MAX_NOTES];
+	int32_t gains_in[MAX_NOTES], steps_in[MAX_NOTES];
+	uint32_t phase_out[MAX_NOTES];
+	mix_fn_t mix_fn = osc_mixer();
+	int32_t w_out = (xfade_left << MIX_GAIN_BITS) / AUDIO_XFADE_SAMPLES;
+	int32_t w_in = MIX_GAIN_ONE - w_out;
+
 	for (int i = 0; i < ctx.num_notes; i++) {
-		ctx.cycles[i]++;
-		if (ctx.cycles[i] >= ctx.cycles_per_wave[i]) {
-			ctx.cycles[i] = 0;
+		gains_out[i] = (ctx.gains[i] >> MIX_GAIN_BITS) * w_out;
+		steps_out[i] = (ctx.gain_steps[i] >> MIX_GAIN_BITS) * w_out;
+		gains_in[i] = (ctx.gains[i] >> MIX_GAIN_BITS) * w_in;
+		steps_in[i] = (ctx.gain_steps[i] >> MIX_GAIN_BITS) * w_in;
+		phase_out[i] = ctx.phase[i];
+	}
+	// Both passes start from the same phases, only the second one's are kept
+	voice_tables(tables, prev_mode);
+	mix_fn(mix, len, tables, PHASE_SHIFT, phase_out, ctx.phase_inc, gains_out, steps_out, ctx.num_notes);
+	voice_tables(tables, cur_mode);
+	mix_fn(mix, len, tables, PHASE_SHIFT, ctx.phase, ctx.phase_inc, gains_in, steps_in, ctx.num_notes);
+}
+
+RAMFUNC void audio_render_block(uint16_t *out, int len)
+{
+	int32_t mix[AUDIO_BLOCK_SIZE];
+
+	// A change requested mid-fade waits for the fade to finish
+	uint8_t requested = next_mode;
+	if (requested != cur_mode && xfade_left == 0) {
+		prev_mode = cur_mode;
+		cur_mode = requested;
+		envelope = &mode_envelopes[cur_mode];
+		xfade_left = AUDIO_XFADE_SAMPLES;
+	}
+
+	update_amps(len);
+
+	if (ctx.num_notes == 0) {
+		xfade_left = 0;
+		for (int k = 0; k < len; k++) {
+			out[k] = DAC_MID;
 		}
-		index = ctx.cycles[i] * LUT_SIZE / ctx.cycles_per_wave[i];
-		dac_out += ctx.amps[i] * sin_lut[index] + 2048;
+		return;
+	}
+
+	for (int k = 0; k < len; k++) {
+		mix[k] = 0;
 	}
-	dac_out /= ctx.num_notes;
-	HAL_DAC_SetValue(&hdac1, DAC_CHANNEL_1, DAC_ALIGN_12B_R, (uint32_t) dac_out);
-	amp_update_counter++;
-	if (amp_update_counter >= AMP_UPDATE_INTR_COUNT) {
-		amp_update_counter = 0;
-		update_amps();
+	if (xfade_left > 0) {
+		mix_crossfade(mix, len);
+		xfade_left = (xfade_left > len) ? xfade_left - len : 0;
+	} else {
+		const int16_t *tables[MAX_NOTES];
+		mix_fn_t mix_fn = osc_mixer();
+		voice_tables(tables, cur_mode);
+		mix_fn(mix, len, tables, PHASE_SHIFT, ctx.phase, ctx.phase_inc, ctx.gains, ctx.gain_steps, ctx.num_notes);
+	}
+
+	// Back to 12 bits around DAC_MID through the headroom and soft clip
+	for (int k = 0; k < len; k++) {
+		int32_t level = mix[k] >> (MIX_GAIN_BITS + AUDIO_HEADROOM_BITS);
+		out[k] = (uint16_t) (soft_clip_level(level) + DAC_MID);
 	}
 }
 
-void init_timer(TIM_HandleTypeDef *htim)
+void init_timer()
 {
+	TIM_MasterConfigTypeDef master_config = {0};
+
 	HAL_TIM_Base_Stop(&htim4);
 	htim4.Instance = TIM4;
 	htim4.Init.Prescaler = PRESCALER;
 	htim4.Init.CounterMode = TIM_COUNTERMODE_UP;
-	htim4.Init.Period = (uint32_t) (BASE_CLK/ (PRESCALER+1)/((float)LUT_SIZE)/freqs[47]);
+	htim4.Init.Period = TIM_PERIOD - 1;
 	htim4.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
 	htim4.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
 	HAL_TIM_Base_Init(&htim4);
-	HAL_TIM_Base_Start_IT(&htim4);
+
+	// Every update event triggers one DAC conversion
+	master_config.MasterOutputTrigger = TIM_TRGO_UPDATE;
+	master_config.MasterSlaveMode = TIM_MASTERSLAVEMODE_DISABLE;
+	HAL_TIMEx_MasterConfigSynchronization(&htim4, &master_config);
+}
+
+void audio_start()
+{
+	for (int k = 0; k < 2 * AUDIO_BLOCK_SIZE; k++) {
+		dac_buf[k] = DAC_MID;
+	}
+	init_timer();
+	// Each half of dac_buf has to be rendered before DMA gets back to it
+	block_budget = SystemCoreClock / AUDIO_SAMPLE_RATE * AUDIO_BLOCK_SIZE;
+	profile_set_budget(PROF_AUDIO_BLOCK, block_budget);
+	HAL_DAC_Start_DMA(&hdac1, DAC_CHANNEL_1, (uint32_t *) dac_buf, 2 * AUDIO_BLOCK_SIZE, DAC_ALIGN_12B_R);
+	HAL_TIM_Base_Start(&htim4);
+}
+
+uint8_t audio_load()
+{
+	return gov_load;
+}
+
+uint8_t audio_gov_level()
+{
+	return gov_level;
+}
+
+/*
+ * Sheds or restores work from the cycles the last block took.
+ */
+RAMFUNC static void govern(uint32_t cycles)
+{
+	if (block_budget == 0 || cycles == 0) {
+		return;
+	}
+	uint32_t load = (uint32_t) ((uint64_t) cycles * 100 / block_budget);
+
+	if (load >= GOV_HIGH_LOAD) {
+		if (gov_level < GOV_LEVELS - 1) {
+			gov_level++;
+		}
+		gov_calm_blocks = 0;
+	} else if (load < GOV_LOW_LOAD) {
+		if (++gov_calm_blocks >= GOV_RESTORE_BLOCKS && gov_level > GOV_FULL) {
+			gov_level--;
+			gov_calm_blocks = 0;
+		}
+	} else {
+		gov_calm_blocks = 0;
+	}
+	gov_load = (load > 255) ? 255 : load;
+}
+
+RAMFUNC void HAL_DAC_ConvHalfCpltCallbackCh1(DAC_HandleTypeDef *hdac)
+{
+	uint32_t prof_start = profile_begin();
+
+	// DMA moved on to the second half, refill the first
+	audio_render_block(dac_buf, AUDIO_BLOCK_SIZE);
+	govern(profile_end(PROF_AUDIO_BLOCK, prof_start));
+}
+
+RAMFUNC void HAL_DAC_ConvCpltCallbackCh1(DAC_HandleTypeDef *hdac)
+{
+	uint32_t prof_start = profile_begin();
+
+	audio_render_block(dac_buf + AUDIO_BLOCK_SIZE, AUDIO_BLOCK_SIZE);
+	govern(profile_end(PROF_AUDIO_BLOCK, prof_start));
 }
 
 
@@ -330,7 +678,13 @@ void handle_note_incorrect(uint8_t note_idx)
 	HAL_Delay(1000);
 	disp_print(keys[mod], tut_c_x, tut_c_y, size, 0x0000, 0x0000);
 }
+void tut_restart()
+{
+	tutorial_index = 0;
+}
+
 void tut_init_display() {
+	tutorial_index = 0;
 	disp_fill_rect(0, 0, DISP_WIDTH, DISP_HEIGHT, BLACK);
 	disp_print("Tutorial", TUT_X, TUT_Y, 4, 0xf81c, 0x0000);
 	disp_print("Hail To The Victors", TUT_X, TUT_Y+40, 4, 0xffc0, 0x0000);
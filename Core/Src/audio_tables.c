@@ -0,0 +1,3295 @@
+/*
+ * Generated by Tools/gen_tables.py, do not edit.
+ */
+#include <stdint.h>
+#include "audio_tables.h"
+#include "fastmem.h"
+
+#if NUM_MODES != 4
+#error "audio.h does not match Tools/gen_tables.py, rerun it"
+#endif
+
+#if WAVETABLE_BITS == 8
+FASTDATA static const int16_t wavetable_data[][WAVETABLE_SIZE + 1] = {
+	// Piano level 0,1,2,3,4,5,6
+	{
+		    0,   104,   208,   311,   411,   509,   604,   695,   782,   864,   940,  1011,
+		 1076,  1134,  1186,  1231,  1270,  1301,  1325,  1342,  1352,  1356,  1353,  1344,
+		 1329,  1309,  1284,  1254,  1219,  1182,  1141,  1098,  1053,  1007,   961,   914,
+		  868,   823,   779,   738,   700,   665,   634,   606,   583,   565,   552,   543,
+		  540,   542,   550,   562,   580,   603,   630,   662,   699,   739,   782,   828,
+		  877,   928,   980,  1033,  1086,  1139,  1192,  1242,  1291,  1338,  1381,  1421,
+		 1457,  1488,  1515,  1536,  1552,  1563,  1567,  1565,  1557,  1543,  1523,  1496,
+		 1463,  1425,  1381,  1332,  1278,  1219,  1156,  1089,  1019,   947,   872,   796,
+		  719,   642,   564,   487,   412,   339,   267,   199,   134,    73,    16,   -36,
+		  -83,  -126,  -163,  -194,  -220,  -240,  -255,  -264,  -268,  -266,  -259,  -248,
+		 -232,  -213,  -189,  -163,  -133,  -102,   -69,   -35,     0,    35,    69,   102,
+		  133,   163,   189,   213,   232,   248,   259,   266,   268,   264,   255,   240,
+		  220,   194,   163,   126,    83,    36,   -16,   -73,  -134,  -199,  -267,  -339,
+		 -412,  -487,  -564,  -642,  -719,  -796,  -872,  -947, -1019, -1089, -1156, -1219,
+		-1278, -1332, -1381, -1425, -1463, -1496, -1523, -1543, -1557, -1565, -1567, -1563,
+		-1552, -1536, -1515, -1488, -1457, -1421, -1381, -1338, -1291, -1242, -1192, -1139,
+		-1086, -1033,  -980,  -928,  -877,  -828,  -782,  -739,  -699,  -662,  -630,  -603,
+		 -580,  -562,  -550,  -542,  -540,  -543,  -552,  -565,  -583,  -606,  -634,  -665,
+		 -700,  -738,  -779,  -823,  -868,  -914,  -961, -1007, -1053, -1098, -1141, -1182,
+		-1219, -1254, -1284, -1309, -1329, -1344, -1353, -1356, -1352, -1342, -1325, -1301,
+		-1270, -1231, -1186, -1134, -1076, -1011,  -940,  -864,  -782,  -695,  -604,  -509,
+		 -411,  -311,  -208,  -104,     0,
+	},
+	// Alt Sax level 0,1,2,3,4,5,6,7,8
+	{
+		    0,    50,   100,   151,   201,   251,   300,   350,   399,   449,   497,   546,
+		  594,   642,   690,   737,   783,   830,   875,   920,   965,  1009,  1052,  1095,
+		 1137,  1179,  1219,  1259,  1299,  1337,  1375,  1411,  1447,  1483,  1517,  1550,
+		 1582,  1614,  1644,  1674,  1702,  1729,  1756,  1781,  1805,  1828,  1850,  1871,
+		 1891,  1910,  1927,  1944,  1959,  1973,  1986,  1997,  2008,  2017,  2025,  2032,
+		 2037,  2041,  2045,  2046,  2047,  2046,  2045,  2041,  2037,  2032,  2025,  2017,
+		 2008,  1997,  1986,  1973,  1959,  1944,  1927,  1910,  1891,  1871,  1850,  1828,
+		 1805,  1781,  1756,  1729,  1702,  1674,  1644,  1614,  1582,  1550,  1517,  1483,
+		 1447,  1411,  1375,  1337,  1299,  1259,  1219,  1179,  1137,  1095,  1052,  1009,
+		  965,   920,   875,   830,   783,   737,   690,   642,   594,   546,   497,   449,
+		  399,   350,   300,   251,   201,   151,   100,    50,     0,   -50,  -100,  -151,
+		 -201,  -251,  -300,  -350,  -399,  -449,  -497,  -546,  -594,  -642,  -690,  -737,
+		 -783,  -830,  -875,  -920,  -965, -1009, -1052, -1095, -1137, -1179, -1219, -1259,
+		-1299, -1337, -1375, -1411, -1447, -1483, -1517, -1550, -1582, -1614, -1644, -1674,
+		-1702, -1729, -1756, -1781, -1805, -1828, -1850, -1871, -1891, -1910, -1927, -1944,
+		-1959, -1973, -1986, -1997, -2008, -2017, -2025, -2032, -2037, -2041, -2045, -2046,
+		-2047, -2046, -2045, -2041, -2037, -2032, -2025, -2017, -2008, -1997, -1986, -1973,
+		-1959, -1944, -1927, -1910, -1891, -1871, -1850, -1828, -1805, -1781, -1756, -1729,
+		-1702, -1674, -1644, -1614, -1582, -1550, -1517, -1483, -1447, -1411, -1375, -1337,
+		-1299, -1259, -1219, -1179, -1137, -1095, -1052, -1009,  -965,  -920,  -875,  -830,
+		 -783,  -737,  -690,  -642,  -594,  -546,  -497,  -449,  -399,  -350,  -300,  -251,
+		 -201,  -151,  -100,   -50,     0,
+	},
+	// Bright level 0,1,2,3,4,5,6
+	{
+		    0,   102,   203,   303,   402,   498,   591,   681,   767,   849,   926,   999,
+		 1066,  1127,  1182,  1232,  1275,  1311,  1342,  1366,  1383,  1395,  1400,  1400,
+		 1394,  1382,  1366,  1345,  1320,  1291,  1258,  1223,  1185,  1145,  1104,  1062,
+		 1020,   977,   935,   894,   855,   817,   782,   749,   719,   693,   670,   650,
+		  635,   623,   616,   612,   613,   617,   626,   638,   654,   673,   696,   721,
+		  749,   778,   810,   843,   877,   912,   947,   981,  1015,  1048,  1080,  1109,
+		 1137,  1161,  1183,  1202,  1217,  1229,  1236,  1240,  1240,  1235,  1226,  1212,
+		 1195,  1173,  1147,  1118,  1084,  1047,  1007,   964,   919,   871,   821,   770,
+		  717,   664,   610,   556,   503,   450,   398,   348,   300,   254,   210,   168,
+		  130,    94,    62,    33,     8,   -14,   -32,   -47,   -59,   -67,   -72,   -74,
+		  -74,   -70,   -65,   -57,   -48,   -37,   -25,   -13,     0,    13,    25,    37,
+		   48,    57,    65,    70,    74,    74,    72,    67,    59,    47,    32,    14,
+		   -8,   -33,   -62,   -94,  -130,  -168,  -210,  -254,  -300,  -348,  -398,  -450,
+		 -503,  -556,  -610,  -664,  -717,  -770,  -821,  -871,  -919,  -964, -1007, -1047,
+		-1084, -1118, -1147, -1173, -1195, -1212, -1226, -1235, -1240, -1240, -1236, -1229,
+		-1217, -1202, -1183, -1161, -1137, -1109, -1080, -1048, -1015,  -981,  -947,  -912,
+		 -877,  -843,  -810,  -778,  -749,  -721,  -696,  -673,  -654,  -638,  -626,  -617,
+		 -613,  -612,  -616,  -623,  -635,  -650,  -670,  -693,  -719,  -749,  -782,  -817,
+		 -855,  -894,  -935,  -977, -1020, -1062, -1104, -1145, -1185, -1223, -1258, -1291,
+		-1320, -1345, -1366, -1382, -1394, -1400, -1400, -1395, -1383, -1366, -1342, -1311,
+		-1275, -1232, -1182, -1127, -1066,  -999,  -926,  -849,  -767,  -681,  -591,  -498,
+		 -402,  -303,  -203,  -102,     0,
+	},
+	// Electric level 0,1,2,3,4,5,6
+	{
+		    0,    77,   153,   229,   304,   378,   451,   523,   593,   661,   727,   792,
+		  854,   913,   970,  1024,  1076,  1124,  1170,  1212,  1252,  1288,  1321,  1351,
+		 1379,  1403,  1424,  1442,  1457,  1470,  1480,  1488,  1493,  1496,  1496,  1495,
+		 1492,  1487,  1481,  1473,  1464,  1454,  1443,  1431,  1419,  1406,  1392,  1378,
+		 1364,  1350,  1336,  1323,  1309,  1295,  1282,  1269,  1257,  1244,  1233,  1221,
+		 1210,  1200,  1189,  1179,  1170,  1160,  1151,  1142,  1133,  1124,  1115,  1105,
+		 1096,  1086,  1077,  1066,  1056,  1045,  1033,  1021,  1008,   995,   980,   966,
+		  950,   934,   917,   900,   881,   862,   843,   823,   802,   780,   758,   736,
+		  713,   690,   666,   642,   618,   594,   569,   545,   520,   496,   471,   447,
+		  423,   399,   376,   352,   329,   306,   284,   262,   240,   219,   198,   177,
+		  156,   136,   116,    97,    77,    58,    38,    19,     0,   -19,   -38,   -58,
+		  -77,   -97,  -116,  -136,  -156,  -177,  -198,  -219,  -240,  -262,  -284,  -306,
+		 -329,  -352,  -376,  -399,  -423,  -447,  -471,  -496,  -520,  -545,  -569,  -594,
+		 -618,  -642,  -666,  -690,  -713,  -736,  -758,  -780,  -802,  -823,  -843,  -862,
+		 -881,  -900,  -917,  -934,  -950,  -966,  -980,  -995, -1008, -1021, -1033, -1045,
+		-1056, -1066, -1077, -1086, -1096, -1105, -1115, -1124, -1133, -1142, -1151, -1160,
+		-1170, -1179, -1189, -1200, -1210, -1221, -1233, -1244, -1257, -1269, -1282, -1295,
+		-1309, -1323, -1336, -1350, -1364, -1378, -1392, -1406, -1419, -1431, -1443, -1454,
+		-1464, -1473, -1481, -1487, -1492, -1495, -1496, -1496, -1493, -1488, -1480, -1470,
+		-1457, -1442, -1424, -1403, -1379, -1351, -1321, -1288, -1252, -1212, -1170, -1124,
+		-1076, -1024,  -970,  -913,  -854,  -792,  -727,  -661,  -593,  -523,  -451,  -378,
+		 -304,  -229,  -153,   -77,     0,
+	},
+#if MAX_NOTES > 48
+	// Piano level 7
+	{
+		    0,    37,    74,   111,   147,   184,   220,   256,   292,   328,   363,   398,
+		  432,   466,   500,   533,   566,   598,   629,   660,   690,   720,   749,   777,
+		  804,   831,   857,   882,   906,   929,   952,   973,   994,  1014,  1033,  1051,
+		 1068,  1084,  1099,  1114,  1127,  1139,  1151,  1161,  1171,  1179,  1187,  1193,
+		 1199,  1204,  1207,  1210,  1212,  1213,  1213,  1213,  1211,  1209,  1206,  1202,
+		 1197,  1191,  1185,  1178,  1170,  1161,  1152,  1142,  1131,  1120,  1109,  1096,
+		 1083,  1070,  1056,  1041,  1027,  1011,   995,   979,   963,   946,   928,   911,
+		  893,   874,   856,   837,   818,   799,   780,   760,   740,   720,   700,   680,
+		  660,   640,   619,   599,   578,   558,   537,   516,   495,   475,   454,   433,
+		  412,   392,   371,   350,   329,   309,   288,   267,   247,   226,   205,   185,
+		  164,   144,   123,   103,    82,    62,    41,    21,     0,   -21,   -41,   -62,
+		  -82,  -103,  -123,  -144,  -164,  -185,  -205,  -226,  -247,  -267,  -288,  -309,
+		 -329,  -350,  -371,  -392,  -412,  -433,  -454,  -475,  -495,  -516,  -537,  -558,
+		 -578,  -599,  -619,  -640,  -660,  -680,  -700,  -720,  -740,  -760,  -780,  -799,
+		 -818,  -837,  -856,  -874,  -893,  -911,  -928,  -946,  -963,  -979,  -995, -1011,
+		-1027, -1041, -1056, -1070, -1083, -1096, -1109, -1120, -1131, -1142, -1152, -1161,
+		-1170, -1178, -1185, -1191, -1197, -1202, -1206, -1209, -1211, -1213, -1213, -1213,
+		-1212, -1210, -1207, -1204, -1199, -1193, -1187, -1179, -1171, -1161, -1151, -1139,
+		-1127, -1114, -1099, -1084, -1068, -1051, -1033, -1014,  -994,  -973,  -952,  -929,
+		 -906,  -882,  -857,  -831,  -804,  -777,  -749,  -720,  -690,  -660,  -629,  -598,
+		 -566,  -533,  -500,  -466,  -432,  -398,  -363,  -328,  -292,  -256,  -220,  -184,
+		 -147,  -111,   -74,   -37,     0,
+	},
+	// Bright level 7
+	{
+		    0,    39,    77,   116,   155,   193,   231,   269,   306,   343,   380,   417,
+		  453,   488,   523,   557,   591,   624,   656,   688,   718,   748,   778,   806,
+		  834,   860,   886,   911,   934,   957,   979,  1000,  1020,  1038,  1056,  1073,
+		 1088,  1103,  1116,  1129,  1140,  1150,  1159,  1168,  1175,  1180,  1185,  1189,
+		 1192,  1194,  1195,  1195,  1193,  1191,  1188,  1184,  1179,  1174,  1167,  1160,
+		 1152,  1143,  1133,  1122,  1111,  1099,  1087,  1074,  1060,  1046,  1031,  1016,
+		 1000,   984,   968,   951,   933,   916,   898,   880,   861,   843,   824,   805,
+		  785,   766,   747,   727,   708,   688,   669,   649,   630,   610,   591,   571,
+		  552,   533,   513,   494,   476,   457,   438,   420,   401,   383,   365,   347,
+		  329,   312,   294,   277,   260,   243,   226,   209,   193,   176,   160,   143,
+		  127,   111,    95,    79,    63,    47,    32,    16,     0,   -16,   -32,   -47,
+		  -63,   -79,   -95,  -111,  -127,  -143,  -160,  -176,  -193,  -209,  -226,  -243,
+		 -260,  -277,  -294,  -312,  -329,  -347,  -365,  -383,  -401,  -420,  -438,  -457,
+		 -476,  -494,  -513,  -533,  -552,  -571,  -591,  -610,  -630,  -649,  -669,  -688,
+		 -708,  -727,  -747,  -766,  -785,  -805,  -824,  -843,  -861,  -880,  -898,  -916,
+		 -933,  -951,  -968,  -984, -1000, -1016, -1031, -1046, -1060, -1074, -1087, -1099,
+		-1111, -1122, -1133, -1143, -1152, -1160, -1167, -1174, -1179, -1184, -1188, -1191,
+		-1193, -1195, -1195, -1194, -1192, -1189, -1185, -1180, -1175, -1168, -1159, -1150,
+		-1140, -1129, -1116, -1103, -1088, -1073, -1056, -1038, -1020, -1000,  -979,  -957,
+		 -934,  -911,  -886,  -860,  -834,  -806,  -778,  -748,  -718,  -688,  -656,  -624,
+		 -591,  -557,  -523,  -488,  -453,  -417,  -380,  -343,  -306,  -269,  -231,  -193,
+		 -155,  -116,   -77,   -39,     0,
+	},
+	// Electric level 7
+	{
+		    0,    53,   105,   158,   210,   262,   313,   365,   415,   466,   515,   564,
+		  613,   660,   707,   753,   798,   842,   885,   927,   967,  1007,  1045,  1083,
+		 1118,  1153,  1186,  1218,  1248,  1277,  1304,  1330,  1355,  1378,  1399,  1419,
+		 1437,  1454,  1469,  1483,  1495,  1505,  1514,  1522,  1528,  1532,  1535,  1536,
+		 1536,  1535,  1532,  1528,  1523,  1516,  1508,  1498,  1488,  1476,  1463,  1449,
+		 1434,  1418,  1401,  1383,  1365,  1345,  1325,  1304,  1282,  1260,  1237,  1213,
+		 1189,  1165,  1140,  1115,  1089,  1064,  1038,  1011,   985,   959,   932,   906,
+		  879,   853,   827,   800,   774,   749,   723,   698,   672,   648,   623,   599,
+		  575,   552,   528,   506,   483,   461,   440,   419,   398,   378,   358,   338,
+		  319,   300,   282,   264,   247,   229,   212,   196,   180,   164,   148,   132,
+		  117,   102,    87,    72,    58,    43,    29,    14,     0,   -14,   -29,   -43,
+		  -58,   -72,   -87,  -102,  -117,  -132,  -148,  -164,  -180,  -196,  -212,  -229,
+		 -247,  -264,  -282,  -300,  -319,  -338,  -358,  -378,  -398,  -419,  -440,  -461,
+		 -483,  -506,  -528,  -552,  -575,  -599,  -623,  -648,  -672,  -698,  -723,  -749,
+		 -774,  -800,  -827,  -853,  -879,  -906,  -932,  -959,  -985, -1011, -1038, -1064,
+		-1089, -1115, -1140, -1165, -1189, -1213, -1237, -1260, -1282, -1304, -1325, -1345,
+		-1365, -1383, -1401, -1418, -1434, -1449, -1463, -1476, -1488, -1498, -1508, -1516,
+		-1523, -1528, -1532, -1535, -1536, -1536, -1535, -1532, -1528, -1522, -1514, -1505,
+		-1495, -1483, -1469, -1454, -1437, -1419, -1399, -1378, -1355, -1330, -1304, -1277,
+		-1248, -1218, -1186, -1153, -1118, -1083, -1045, -1007,  -967,  -927,  -885,  -842,
+		 -798,  -753,  -707,  -660,  -613,  -564,  -515,  -466,  -415,  -365,  -313,  -262,
+		 -210,  -158,  -105,   -53,     0,
+	},
+	// Piano level 8
+	{
+		    0,    29,    57,    86,   115,   143,   172,   200,   228,   256,   284,   312,
+		  340,   367,   394,   421,   448,   474,   500,   526,   551,   577,   601,   626,
+		  650,   674,   697,   720,   742,   764,   786,   807,   827,   847,   867,   886,
+		  904,   922,   940,   956,   973,   988,  1003,  1018,  1032,  1045,  1057,  1069,
+		 1081,  1091,  1101,  1111,  1119,  1127,  1135,  1141,  1147,  1152,  1157,  1161,
+		 1164,  1167,  1168,  1169,  1170,  1169,  1168,  1167,  1164,  1161,  1157,  1152,
+		 1147,  1141,  1135,  1127,  1119,  1111,  1101,  1091,  1081,  1069,  1057,  1045,
+		 1032,  1018,  1003,   988,   973,   956,   940,   922,   904,   886,   867,   847,
+		  827,   807,   786,   764,   742,   720,   697,   674,   650,   626,   601,   577,
+		  551,   526,   500,   474,   448,   421,   394,   367,   340,   312,   284,   256,
+		  228,   200,   172,   143,   115,    86,    57,    29,     0,   -29,   -57,   -86,
+		 -115,  -143,  -172,  -200,  -228,  -256,  -284,  -312,  -340,  -367,  -394,  -421,
+		 -448,  -474,  -500,  -526,  -551,  -577,  -601,  -626,  -650,  -674,  -697,  -720,
+		 -742,  -764,  -786,  -807,  -827,  -847,  -867,  -886,  -904,  -922,  -940,  -956,
+		 -973,  -988, -1003, -1018, -1032, -1045, -1057, -1069, -1081, -1091, -1101, -1111,
+		-1119, -1127, -1135, -1141, -1147, -1152, -1157, -1161, -1164, -1167, -1168, -1169,
+		-1170, -1169, -1168, -1167, -1164, -1161, -1157, -1152, -1147, -1141, -1135, -1127,
+		-1119, -1111, -1101, -1091, -1081, -1069, -1057, -1045, -1032, -1018, -1003,  -988,
+		 -973,  -956,  -940,  -922,  -904,  -886,  -867,  -847,  -827,  -807,  -786,  -764,
+		 -742,  -720,  -697,  -674,  -650,  -626,  -601,  -577,  -551,  -526,  -500,  -474,
+		 -448,  -421,  -394,  -367,  -340,  -312,  -284,  -256,  -228,  -200,  -172,  -143,
+		 -115,   -86,   -57,   -29,     0,
+	},
+	// Bright level 8
+	{
+		    0,    27,    55,    82,   109,   136,   163,   190,   217,   243,   270,   296,
+		  323,   349,   374,   400,   425,   450,   475,   500,   524,   548,   571,   595,
+		  617,   640,   662,   684,   705,   726,   746,   766,   786,   805,   823,   841,
+		  859,   876,   893,   909,   924,   939,   953,   967,   980,   993,  1005,  1016,
+		 1027,  1037,  1046,  1055,  1063,  1071,  1078,  1084,  1090,  1095,  1099,  1103,
+		 1106,  1108,  1110,  1111,  1111,  1111,  1110,  1108,  1106,  1103,  1099,  1095,
+		 1090,  1084,  1078,  1071,  1063,  1055,  1046,  1037,  1027,  1016,  1005,   993,
+		  980,   967,   953,   939,   924,   909,   893,   876,   859,   841,   823,   805,
+		  786,   766,   746,   726,   705,   684,   662,   640,   617,   595,   571,   548,
+		  524,   500,   475,   450,   425,   400,   374,   349,   323,   296,   270,   243,
+		  217,   190,   163,   136,   109,    82,    55,    27,     0,   -27,   -55,   -82,
+		 -109,  -136,  -163,  -190,  -217,  -243,  -270,  -296,  -323,  -349,  -374,  -400,
+		 -425,  -450,  -475,  -500,  -524,  -548,  -571,  -595,  -617,  -640,  -662,  -684,
+		 -705,  -726,  -746,  -766,  -786,  -805,  -823,  -841,  -859,  -876,  -893,  -909,
+		 -924,  -939,  -953,  -967,  -980,  -993, -1005, -1016, -1027, -1037, -1046, -1055,
+		-1063, -1071, -1078, -1084, -1090, -1095, -1099, -1103, -1106, -1108, -1110, -1111,
+		-1111, -1111, -1110, -1108, -1106, -1103, -1099, -1095, -1090, -1084, -1078, -1071,
+		-1063, -1055, -1046, -1037, -1027, -1016, -1005,  -993,  -980,  -967,  -953,  -939,
+		 -924,  -909,  -893,  -876,  -859,  -841,  -823,  -805,  -786,  -766,  -746,  -726,
+		 -705,  -684,  -662,  -640,  -617,  -595,  -571,  -548,  -524,  -500,  -475,  -450,
+		 -425,  -400,  -374,  -349,  -323,  -296,  -270,  -243,  -217,  -190,  -163,  -136,
+		 -109,   -82,   -55,   -27,     0,
+	},
+	// Electric level 8
+	{
+		    0,    33,    67,   100,   134,   167,   200,   233,   266,   299,   332,   364,
+		  396,   428,   460,   491,   522,   553,   583,   614,   643,   673,   702,   730,
+		  758,   786,   813,   840,   866,   891,   916,   941,   965,   988,  1011,  1033,
+		 1055,  1076,  1096,  1116,  1135,  1153,  1171,  1187,  1204,  1219,  1234,  1248,
+		 1261,  1273,  1285,  1296,  1306,  1315,  1324,  1332,  1338,  1345,  1350,  1354,
+		 1358,  1361,  1363,  1364,  1365,  1364,  1363,  1361,  1358,  1354,  1350,  1345,
+		 1338,  1332,  1324,  1315,  1306,  1296,  1285,  1273,  1261,  1248,  1234,  1219,
+		 1204,  1187,  1171,  1153,  1135,  1116,  1096,  1076,  1055,  1033,  1011,   988,
+		  965,   941,   916,   891,   866,   840,   813,   786,   758,   730,   702,   673,
+		  643,   614,   583,   553,   522,   491,   460,   428,   396,   364,   332,   299,
+		  266,   233,   200,   167,   134,   100,    67,    33,     0,   -33,   -67,  -100,
+		 -134,  -167,  -200,  -233,  -266,  -299,  -332,  -364,  -396,  -428,  -460,  -491,
+		 -522,  -553,  -583,  -614,  -643,  -673,  -702,  -730,  -758,  -786,  -813,  -840,
+		 -866,  -891,  -916,  -941,  -965,  -988, -1011, -1033, -1055, -1076, -1096, -1116,
+		-1135, -1153, -1171, -1187, -1204, -1219, -1234, -1248, -1261, -1273, -1285, -1296,
+		-1306, -1315, -1324, -1332, -1338, -1345, -1350, -1354, -1358, -1361, -1363, -1364,
+		-1365, -1364, -1363, -1361, -1358, -1354, -1350, -1345, -1338, -1332, -1324, -1315,
+		-1306, -1296, -1285, -1273, -1261, -1248, -1234, -1219, -1204, -1187, -1171, -1153,
+		-1135, -1116, -1096, -1076, -1055, -1033, -1011,  -988,  -965,  -941,  -916,  -891,
+		 -866,  -840,  -813,  -786,  -758,  -730,  -702,  -673,  -643,  -614,  -583,  -553,
+		 -522,  -491,  -460,  -428,  -396,  -364,  -332,  -299,  -266,  -233,  -200,  -167,
+		 -134,  -100,   -67,   -33,     0,
+	},
+#endif
+};
+
+FASTDATA const int16_t *const wavetables[NUM_MODES][MIPMAP_LEVELS] = {
+#if MAX_NOTES <= 48
+	{wavetable_data[0], wavetable_data[0], wavetable_data[0], wavetable_data[0], wavetable_data[0]}, // Piano
+	{wavetable_data[1], wavetable_data[1], wavetable_data[1], wavetable_data[1], wavetable_data[1]}, // Alt Sax
+	{wavetable_data[2], wavetable_data[2], wavetable_data[2], wavetable_data[2], wavetable_data[2]}, // Bright
+	{wavetable_data[3], wavetable_data[3], wavetable_data[3], wavetable_data[3], wavetable_data[3]}, // Electric
+#elif MAX_NOTES <= 96
+	{wavetable_data[0], wavetable_data[0], wavetable_data[0], wavetable_data[0], wavetable_data[0], wavetable_data[0], wavetable_data[0], wavetable_data[4], wavetable_data[7]}, // Piano
+	{wavetable_data[1], wavetable_data[1], wavetable_data[1], wavetable_data[1], wavetable_data[1], wavetable_data[1], wavetable_data[1], wavetable_data[1], wavetable_data[1]}, // Alt Sax
+	{wavetable_data[2], wavetable_data[2], wavetable_data[2], wavetable_data[2], wavetable_data[2], wavetable_data[2], wavetable_data[2], wavetable_data[5], wavetable_data[8]}, // Bright
+	{wavetable_data[3], wavetable_data[3], wavetable_data[3], wavetable_data[3], wavetable_data[3], wavetable_data[3], wavetable_data[3], wavetable_data[6], wavetable_data[9]}, // Electric
+#endif
+};
+#elif WAVETABLE_BITS == 10
+FASTDATA static const int16_t wavetable_data[][WAVETABLE_SIZE + 1] = {
+	// Piano level 0,1,2,3,4,5,6
+	{
+		    0,    26,    52,    78,   104,   131,   157,   182,   208,   234,   260,   285,
+		  311,   336,   361,   386,   411,   436,   461,   485,   509,   533,   557,   581,
+		  604,   627,   650,   673,   695,   717,   739,   760,   782,   803,   823,   844,
+		  864,   883,   903,   921,   940,   958,   976,   994,  1011,  1028,  1044,  1060,
+		 1076,  1091,  1106,  1120,  1134,  1148,  1161,  1174,  1186,  1198,  1210,  1221,
+		 1231,  1242,  1251,  1261,  1270,  1278,  1286,  1294,  1301,  1307,  1314,  1320,
+		 1325,  1330,  1334,  1338,  1342,  1345,  1348,  1350,  1352,  1354,  1355,  1356,
+		 1356,  1356,  1355,  1355,  1353,  1352,  1349,  1347,  1344,  1341,  1337,  1334,
+		 1329,  1325,  1320,  1315,  1309,  1303,  1297,  1290,  1284,  1276,  1269,  1261,
+		 1254,  1245,  1237,  1228,  1219,  1210,  1201,  1192,  1182,  1172,  1162,  1152,
+		 1141,  1131,  1120,  1109,  1098,  1087,  1076,  1065,  1053,  1042,  1030,  1019,
+		 1007,   996,   984,   972,   961,   949,   937,   925,   914,   902,   891,   879,
+		  868,   856,   845,   834,   823,   812,   801,   790,   779,   769,   759,   748,
+		  738,   729,   719,   709,   700,   691,   682,   674,   665,   657,   649,   641,
+		  634,   627,   620,   613,   606,   600,   594,   589,   583,   578,   574,   569,
+		  565,   561,   558,   555,   552,   549,   547,   545,   543,   542,   541,   541,
+		  540,   540,   541,   541,   542,   544,   545,   547,   550,   552,   555,   559,
+		  562,   566,   571,   575,   580,   585,   591,   597,   603,   609,   616,   623,
+		  630,   638,   646,   654,   662,   671,   680,   689,   699,   708,   718,   728,
+		  739,   749,   760,   771,   782,   793,   805,   816,   828,   840,   852,   865,
+		  877,   889,   902,   915,   928,   941,   954,   967,   980,   993,  1006,  1020,
+		 1033,  1046,  1059,  1073,  1086,  1099,  1113,  1126,  1139,  1152,  1166,  1179,
+		 1192,  1204,  1217,  1230,  1242,  1255,  1267,  1279,  1291,  1303,  1315,  1326,
+		 1338,  1349,  1360,  1371,  1381,  1391,  1402,  1411,  1421,  1430,  1440,  1448,
+		 1457,  1465,  1473,  1481,  1488,  1495,  1502,  1509,  1515,  1521,  1526,  1532,
+		 1536,  1541,  1545,  1549,  1552,  1556,  1558,  1561,  1563,  1564,  1566,  1566,
+		 1567,  1567,  1567,  1566,  1565,  1564,  1562,  1560,  1557,  1554,  1551,  1547,
+		 1543,  1538,  1534,  1528,  1523,  1516,  1510,  1503,  1496,  1488,  1480,  1472,
+		 1463,  1454,  1445,  1435,  1425,  1415,  1404,  1393,  1381,  1369,  1357,  1345,
+		 1332,  1319,  1305,  1292,  1278,  1263,  1249,  1234,  1219,  1203,  1188,  1172,
+		 1156,  1140,  1123,  1106,  1089,  1072,  1055,  1037,  1019,  1002,   984,   965,
+		  947,   929,   910,   891,   872,   854,   835,   815,   796,   777,   758,   738,
+		  719,   700,   680,   661,   642,   622,   603,   583,   564,   545,   526,   506,
+		  487,   468,   450,   431,   412,   393,   375,   357,   339,   321,   303,   285,
+		  267,   250,   233,   216,   199,   183,   166,   150,   134,   119,   103,    88,
+		   73,    59,    44,    30,    16,     3,   -10,   -23,   -36,   -48,   -60,   -72,
+		  -83,   -94,  -105,  -116,  -126,  -135,  -145,  -154,  -163,  -171,  -179,  -187,
+		 -194,  -201,  -208,  -214,  -220,  -226,  -231,  -236,  -240,  -244,  -248,  -252,
+		 -255,  -258,  -260,  -262,  -264,  -265,  -266,  -267,  -268,  -268,  -267,  -267,
+		 -266,  -265,  -263,  -262,  -259,  -257,  -254,  -251,  -248,  -245,  -241,  -237,
+		 -232,  -228,  -223,  -218,  -213,  -207,  -201,  -195,  -189,  -183,  -176,  -170,
+		 -163,  -156,  -148,  -141,  -133,  -126,  -118,  -110,  -102,   -94,   -86,   -77,
+		  -69,   -61,   -52,   -43,   -35,   -26,   -17,    -9,     0,     9,    17,    26,
+		   35,    43,    52,    61,    69,    77,    86,    94,   102,   110,   118,   126,
+		  133,   141,   148,   156,   163,   170,   176,   183,   189,   195,   201,   207,
+		  213,   218,   223,   228,   232,   237,   241,   245,   248,   251,   254,   257,
+		  259,   262,   263,   265,   266,   267,   267,   268,   268,   267,   266,   265,
+		  264,   262,   260,   258,   255,   252,   248,   244,   240,   236,   231,   226,
+		  220,   214,   208,   201,   194,   187,   179,   171,   163,   154,   145,   135,
+		  126,   116,   105,    94,    83,    72,    60,    48,    36,    23,    10,    -3,
+		  -16,   -30,   -44,   -59,   -73,   -88,  -103,  -119,  -134,  -150,  -166,  -183,
+		 -199,  -216,  -233,  -250,  -267,  -285,  -303,  -321,  -339,  -357,  -375,  -393,
+		 -412,  -431,  -450,  -468,  -487,  -506,  -526,  -545,  -564,  -583,  -603,  -622,
+		 -642,  -661,  -680,  -700,  -719,  -738,  -758,  -777,  -796,  -815,  -835,  -854,
+		 -872,  -891,  -910,  -929,  -947,  -965,  -984, -1002, -1019, -1037, -1055, -1072,
+		-1089, -1106, -1123, -1140, -1156, -1172, -1188, -1203, -1219, -1234, -1249, -1263,
+		-1278, -1292, -1305, -1319, -1332, -1345, -1357, -1369, -1381, -1393, -1404, -1415,
+		-1425, -1435, -1445, -1454, -1463, -1472, -1480, -1488, -1496, -1503, -1510, -1516,
+		-1523, -1528, -1534, -1538, -1543, -1547, -1551, -1554, -1557, -1560, -1562, -1564,
+		-1565, -1566, -1567, -1567, -1567, -1566, -1566, -1564, -1563, -1561, -1558, -1556,
+		-1552, -1549, -1545, -1541, -1536, -1532, -1526, -1521, -1515, -1509, -1502, -1495,
+		-1488, -1481, -1473, -1465, -1457, -1448, -1440, -1430, -1421, -1411, -1402, -1391,
+		-1381, -1371, -1360, -1349, -1338, -1326, -1315, -1303, -1291, -1279, -1267, -1255,
+		-1242, -1230, -1217, -1204, -1192, -1179, -1166, -1152, -1139, -1126, -1113, -1099,
+		-1086, -1073, -1059, -1046, -1033, -1020, -1006,  -993,  -980,  -967,  -954,  -941,
+		 -928,  -915,  -902,  -889,  -877,  -865,  -852,  -840,  -828,  -816,  -805,  -793,
+		 -782,  -771,  -760,  -749,  -739,  -728,  -718,  -708,  -699,  -689,  -680,  -671,
+		 -662,  -654,  -646,  -638,  -630,  -623,  -616,  -609,  -603,  -597,  -591,  -585,
+		 -580,  -575,  -571,  -566,  -562,  -559,  -555,  -552,  -550,  -547,  -545,  -544,
+		 -542,  -541,  -541,  -540,  -540,  -541,  -541,  -542,  -543,  -545,  -547,  -549,
+		 -552,  -555,  -558,  -561,  -565,  -569,  -574,  -578,  -583,  -589,  -594,  -600,
+		 -606,  -613,  -620,  -627,  -634,  -641,  -649,  -657,  -665,  -674,  -682,  -691,
+		 -700,  -709,  -719,  -729,  -738,  -748,  -759,  -769,  -779,  -790,  -801,  -812,
+		 -823,  -834,  -845,  -856,  -868,  -879,  -891,  -902,  -914,  -925,  -937,  -949,
+		 -961,  -972,  -984,  -996, -1007, -1019, -1030, -1042, -1053, -1065, -1076, -1087,
+		-1098, -1109, -1120, -1131, -1141, -1152, -1162, -1172, -1182, -1192, -1201, -1210,
+		-1219, -1228, -1237, -1245, -1254, -1261, -1269, -1276, -1284, -1290, -1297, -1303,
+		-1309, -1315, -1320, -1325, -1329, -1334, -1337, -1341, -1344, -1347, -1349, -1352,
+		-1353, -1355, -1355, -1356, -1356, -1356, -1355, -1354, -1352, -1350, -1348, -1345,
+		-1342, -1338, -1334, -1330, -1325, -1320, -1314, -1307, -1301, -1294, -1286, -1278,
+		-1270, -1261, -1251, -1242, -1231, -1221, -1210, -1198, -1186, -1174, -1161, -1148,
+		-1134, -1120, -1106, -1091, -1076, -1060, -1044, -1028, -1011,  -994,  -976,  -958,
+		 -940,  -921,  -903,  -883,  -864,  -844,  -823,  -803,  -782,  -760,  -739,  -717,
+		 -695,  -673,  -650,  -627,  -604,  -581,  -557,  -533,  -509,  -485,  -461,  -436,
+		 -411,  -386,  -361,  -336,  -311,  -285,  -260,  -234,  -208,  -182,  -157,  -131,
+		 -104,   -78,   -52,   -26,     0,
+	},
+	// Alt Sax level 0,1,2,3,4,5,6,7,8
+	{
+		    0,    13,    25,    38,    50,    63,    75,    88,   100,   113,   126,   138,
+		  151,   163,   176,   188,   201,   213,   226,   238,   251,   263,   275,   288,
+		  300,   313,   325,   338,   350,   362,   375,   387,   399,   412,   424,   436,
+		  449,   461,   473,   485,   497,   510,   522,   534,   546,   558,   570,   582,
+		  594,   606,   618,   630,   642,   654,   666,   678,   690,   701,   713,   725,
+		  737,   748,   760,   772,   783,   795,   807,   818,   830,   841,   852,   864,
+		  875,   887,   898,   909,   920,   932,   943,   954,   965,   976,   987,   998,
+		 1009,  1020,  1031,  1042,  1052,  1063,  1074,  1085,  1095,  1106,  1116,  1127,
+		 1137,  1148,  1158,  1168,  1179,  1189,  1199,  1209,  1219,  1229,  1239,  1249,
+		 1259,  1269,  1279,  1289,  1299,  1308,  1318,  1328,  1337,  1347,  1356,  1365,
+		 1375,  1384,  1393,  1402,  1411,  1421,  1430,  1439,  1447,  1456,  1465,  1474,
+		 1483,  1491,  1500,  1508,  1517,  1525,  1533,  1542,  1550,  1558,  1566,  1574,
+		 1582,  1590,  1598,  1606,  1614,  1621,  1629,  1637,  1644,  1652,  1659,  1666,
+		 1674,  1681,  1688,  1695,  1702,  1709,  1716,  1723,  1729,  1736,  1743,  1749,
+		 1756,  1762,  1769,  1775,  1781,  1787,  1793,  1799,  1805,  1811,  1817,  1823,
+		 1828,  1834,  1840,  1845,  1850,  1856,  1861,  1866,  1871,  1876,  1881,  1886,
+		 1891,  1896,  1901,  1905,  1910,  1914,  1919,  1923,  1927,  1932,  1936,  1940,
+		 1944,  1948,  1951,  1955,  1959,  1962,  1966,  1969,  1973,  1976,  1979,  1983,
+		 1986,  1989,  1992,  1994,  1997,  2000,  2003,  2005,  2008,  2010,  2012,  2015,
+		 2017,  2019,  2021,  2023,  2025,  2027,  2028,  2030,  2032,  2033,  2035,  2036,
+		 2037,  2038,  2039,  2040,  2041,  2042,  2043,  2044,  2045,  2045,  2046,  2046,
+		 2046,  2047,  2047,  2047,  2047,  2047,  2047,  2047,  2046,  2046,  2046,  2045,
+		 2045,  2044,  2043,  2042,  2041,  2040,  2039,  2038,  2037,  2036,  2035,  2033,
+		 2032,  2030,  2028,  2027,  2025,  2023,  2021,  2019,  2017,  2015,  2012,  2010,
+		 2008,  2005,  2003,  2000,  1997,  1994,  1992,  1989,  1986,  1983,  1979,  1976,
+		 1973,  1969,  1966,  1962,  1959,  1955,  1951,  1948,  1944,  1940,  1936,  1932,
+		 1927,  1923,  1919,  1914,  1910,  1905,  1901,  1896,  1891,  1886,  1881,  1876,
+		 1871,  1866,  1861,  1856,  1850,  1845,  1840,  1834,  1828,  1823,  1817,  1811,
+		 1805,  1799,  1793,  1787,  1781,  1775,  1769,  1762,  1756,  1749,  1743,  1736,
+		 1729,  1723,  1716,  1709,  1702,  1695,  1688,  1681,  1674,  1666,  1659,  1652,
+		 1644,  1637,  1629,  1621,  1614,  1606,  1598,  1590,  1582,  1574,  1566,  1558,
+		 1550,  1542,  1533,  1525,  1517,  1508,  1500,  1491,  1483,  1474,  1465,  1456,
+		 1447,  1439,  1430,  1421,  1411,  1402,  1393,  1384,  1375,  1365,  1356,  1347,
+		 1337,  1328,  1318,  1308,  1299,  1289,  1279,  1269,  1259,  1249,  1239,  1229,
+		 1219,  1209,  1199,  1189,  1179,  1168,  1158,  1148,  1137,  1127,  1116,  1106,
+		 1095,  1085,  1074,  1063,  1052,  1042,  1031,  1020,  1009,   998,   987,   976,
+		  965,   954,   943,   932,   920,   909,   898,   887,   875,   864,   852,   841,
+		  830,   818,   807,   795,   783,   772,   760,   748,   737,   725,   713,   701,
+		  690,   678,   666,   654,   642,   630,   618,   606,   594,   582,   570,   558,
+		  546,   534,   522,   510,   497,   485,   473,   461,   449,   436,   424,   412,
+		  399,   387,   375,   362,   350,   338,   325,   313,   300,   288,   275,   263,
+		  251,   238,   226,   213,   201,   188,   176,   163,   151,   138,   126,   113,
+		  100,    88,    75,    63,    50,    38,    25,    13,     0,   -13,   -25,   -38,
+		  -50,   -63,   -75,   -88,  -100,  -113,  -126,  -138,  -151,  -163,  -176,  -188,
+		 -201,  -213,  -226,  -238,  -251,  -263,  -275,  -288,  -300,  -313,  -325,  -338,
+		 -350,  -362,  -375,  -387,  -399,  -412,  -424,  -436,  -449,  -461,  -473,  -485,
+		 -497,  -510,  -522,  -534,  -546,  -558,  -570,  -582,  -594,  -606,  -618,  -630,
+		 -642,  -654,  -666,  -678,  -690,  -701,  -713,  -725,  -737,  -748,  -760,  -772,
+		 -783,  -795,  -807,  -818,  -830,  -841,  -852,  -864,  -875,  -887,  -898,  -909,
+		 -920,  -932,  -943,  -954,  -965,  -976,  -987,  -998, -1009, -1020, -1031, -1042,
+		-1052, -1063, -1074, -1085, -1095, -1106, -1116, -1127, -1137, -1148, -1158, -1168,
+		-1179, -1189, -1199, -1209, -1219, -1229, -1239, -1249, -1259, -1269, -1279, -1289,
+		-1299, -1308, -1318, -1328, -1337, -1347, -1356, -1365, -1375, -1384, -1393, -1402,
+		-1411, -1421, -1430, -1439, -1447, -1456, -1465, -1474, -1483, -1491, -1500, -1508,
+		-1517, -1525, -1533, -1542, -1550, -1558, -1566, -1574, -1582, -1590, -1598, -1606,
+		-1614, -1621, -1629, -1637, -1644, -1652, -1659, -1666, -1674, -1681, -1688, -1695,
+		-1702, -1709, -1716, -1723, -1729, -1736, -1743, -1749, -1756, -1762, -1769, -1775,
+		-1781, -1787, -1793, -1799, -1805, -1811, -1817, -1823, -1828, -1834, -1840, -1845,
+		-1850, -1856, -1861, -1866, -1871, -1876, -1881, -1886, -1891, -1896, -1901, -1905,
+		-1910, -1914, -1919, -1923, -1927, -1932, -1936, -1940, -1944, -1948, -1951, -1955,
+		-1959, -1962, -1966, -1969, -1973, -1976, -1979, -1983, -1986, -1989, -1992, -1994,
+		-1997, -2000, -2003, -2005, -2008, -2010, -2012, -2015, -2017, -2019, -2021, -2023,
+		-2025, -2027, -2028, -2030, -2032, -2033, -2035, -2036, -2037, -2038, -2039, -2040,
+		-2041, -2042, -2043, -2044, -2045, -2045, -2046, -2046, -2046, -2047, -2047, -2047,
+		-2047, -2047, -2047, -2047, -2046, -2046, -2046, -2045, -2045, -2044, -2043, -2042,
+		-2041, -2040, -2039, -2038, -2037, -2036, -2035, -2033, -2032, -2030, -2028, -2027,
+		-2025, -2023, -2021, -2019, -2017, -2015, -2012, -2010, -2008, -2005, -2003, -2000,
+		-1997, -1994, -1992, -1989, -1986, -1983, -1979, -1976, -1973, -1969, -1966, -1962,
+		-1959, -1955, -1951, -1948, -1944, -1940, -1936, -1932, -1927, -1923, -1919, -1914,
+		-1910, -1905, -1901, -1896, -1891, -1886, -1881, -1876, -1871, -1866, -1861, -1856,
+		-1850, -1845, -1840, -1834, -1828, -1823, -1817, -1811, -1805, -1799, -1793, -1787,
+		-1781, -1775, -1769, -1762, -1756, -1749, -1743, -1736, -1729, -1723, -1716, -1709,
+		-1702, -1695, -1688, -1681, -1674, -1666, -1659, -1652, -1644, -1637, -1629, -1621,
+		-1614, -1606, -1598, -1590, -1582, -1574, -1566, -1558, -1550, -1542, -1533, -1525,
+		-1517, -1508, -1500, -1491, -1483, -1474, -1465, -1456, -1447, -1439, -1430, -1421,
+		-1411, -1402, -1393, -1384, -1375, -1365, -1356, -1347, -1337, -1328, -1318, -1308,
+		-1299, -1289, -1279, -1269, -1259, -1249, -1239, -1229, -1219, -1209, -1199, -1189,
+		-1179, -1168, -1158, -1148, -1137, -1127, -1116, -1106, -1095, -1085, -1074, -1063,
+		-1052, -1042, -1031, -1020, -1009,  -998,  -987,  -976,  -965,  -954,  -943,  -932,
+		 -920,  -909,  -898,  -887,  -875,  -864,  -852,  -841,  -830,  -818,  -807,  -795,
+		 -783,  -772,  -760,  -748,  -737,  -725,  -713,  -701,  -690,  -678,  -666,  -654,
+		 -642,  -630,  -618,  -606,  -594,  -582,  -570,  -558,  -546,  -534,  -522,  -510,
+		 -497,  -485,  -473,  -461,  -449,  -436,  -424,  -412,  -399,  -387,  -375,  -362,
+		 -350,  -338,  -325,  -313,  -300,  -288,  -275,  -263,  -251,  -238,  -226,  -213,
+		 -201,  -188,  -176,  -163,  -151,  -138,  -126,  -113,  -100,   -88,   -75,   -63,
+		  -50,   -38,   -25,   -13,     0,
+	},
+	// Bright level 0,1,2,3,4,5,6
+	{
+		    0,    25,    51,    76,   102,   127,   153,   178,   203,   228,   253,   278,
+		  303,   328,   353,   377,   402,   426,   450,   474,   498,   521,   545,   568,
+		  591,   614,   636,   659,   681,   703,   725,   746,   767,   788,   809,   829,
+		  849,   869,   888,   908,   926,   945,   963,   981,   999,  1016,  1033,  1049,
+		 1066,  1082,  1097,  1112,  1127,  1141,  1155,  1169,  1182,  1195,  1208,  1220,
+		 1232,  1243,  1254,  1265,  1275,  1284,  1294,  1303,  1311,  1320,  1327,  1335,
+		 1342,  1348,  1355,  1360,  1366,  1371,  1375,  1380,  1383,  1387,  1390,  1393,
+		 1395,  1397,  1398,  1400,  1400,  1401,  1401,  1400,  1400,  1399,  1398,  1396,
+		 1394,  1391,  1389,  1386,  1382,  1379,  1375,  1371,  1366,  1361,  1356,  1351,
+		 1345,  1339,  1333,  1326,  1320,  1313,  1306,  1298,  1291,  1283,  1275,  1267,
+		 1258,  1250,  1241,  1232,  1223,  1214,  1204,  1195,  1185,  1175,  1165,  1155,
+		 1145,  1135,  1125,  1115,  1104,  1094,  1083,  1073,  1062,  1052,  1041,  1030,
+		 1020,  1009,   998,   988,   977,   967,   956,   946,   935,   925,   915,   904,
+		  894,   884,   874,   865,   855,   845,   836,   826,   817,   808,   799,   791,
+		  782,   773,   765,   757,   749,   741,   734,   726,   719,   712,   706,   699,
+		  693,   687,   681,   675,   670,   664,   659,   655,   650,   646,   642,   638,
+		  635,   631,   628,   626,   623,   621,   619,   617,   616,   614,   613,   613,
+		  612,   612,   612,   612,   613,   613,   614,   616,   617,   619,   621,   623,
+		  626,   629,   632,   635,   638,   642,   646,   650,   654,   659,   663,   668,
+		  673,   679,   684,   690,   696,   702,   708,   714,   721,   728,   734,   741,
+		  749,   756,   763,   771,   778,   786,   794,   802,   810,   818,   827,   835,
+		  843,   852,   860,   869,   877,   886,   895,   903,   912,   921,   929,   938,
+		  947,   956,   964,   973,   981,   990,   999,  1007,  1015,  1024,  1032,  1040,
+		 1048,  1056,  1064,  1072,  1080,  1087,  1095,  1102,  1109,  1116,  1123,  1130,
+		 1137,  1143,  1149,  1156,  1161,  1167,  1173,  1178,  1183,  1188,  1193,  1198,
+		 1202,  1206,  1210,  1214,  1217,  1221,  1224,  1226,  1229,  1231,  1233,  1235,
+		 1236,  1238,  1239,  1240,  1240,  1240,  1240,  1240,  1240,  1239,  1238,  1236,
+		 1235,  1233,  1231,  1228,  1226,  1223,  1220,  1216,  1212,  1208,  1204,  1200,
+		 1195,  1190,  1184,  1179,  1173,  1167,  1161,  1154,  1147,  1140,  1133,  1125,
+		 1118,  1110,  1101,  1093,  1084,  1075,  1066,  1057,  1047,  1038,  1028,  1018,
+		 1007,   997,   986,   975,   964,   953,   942,   931,   919,   907,   895,   883,
+		  871,   859,   846,   834,   821,   808,   796,   783,   770,   757,   744,   730,
+		  717,   704,   691,   677,   664,   650,   637,   624,   610,   597,   583,   570,
+		  556,   543,   529,   516,   503,   490,   476,   463,   450,   437,   424,   411,
+		  398,   386,   373,   361,   348,   336,   324,   312,   300,   288,   276,   265,
+		  254,   242,   231,   220,   210,   199,   189,   178,   168,   158,   149,   139,
+		  130,   121,   112,   103,    94,    86,    78,    70,    62,    55,    47,    40,
+		   33,    27,    20,    14,     8,     2,    -3,    -9,   -14,   -19,   -24,   -28,
+		  -32,   -36,   -40,   -44,   -47,   -50,   -53,   -56,   -59,   -61,   -63,   -65,
+		  -67,   -69,   -70,   -71,   -72,   -73,   -74,   -74,   -74,   -74,   -74,   -74,
+		  -74,   -73,   -72,   -71,   -70,   -69,   -68,   -66,   -65,   -63,   -61,   -59,
+		  -57,   -55,   -53,   -50,   -48,   -45,   -43,   -40,   -37,   -34,   -31,   -28,
+		  -25,   -22,   -19,   -16,   -13,   -10,    -6,    -3,     0,     3,     6,    10,
+		   13,    16,    19,    22,    25,    28,    31,    34,    37,    40,    43,    45,
+		   48,    50,    53,    55,    57,    59,    61,    63,    65,    66,    68,    69,
+		   70,    71,    72,    73,    74,    74,    74,    74,    74,    74,    74,    73,
+		   72,    71,    70,    69,    67,    65,    63,    61,    59,    56,    53,    50,
+		   47,    44,    40,    36,    32,    28,    24,    19,    14,     9,     3,    -2,
+		   -8,   -14,   -20,   -27,   -33,   -40,   -47,   -55,   -62,   -70,   -78,   -86,
+		  -94,  -103,  -112,  -121,  -130,  -139,  -149,  -158,  -168,  -178,  -189,  -199,
+		 -210,  -220,  -231,  -242,  -254,  -265,  -276,  -288,  -300,  -312,  -324,  -336,
+		 -348,  -361,  -373,  -386,  -398,  -411,  -424,  -437,  -450,  -463,  -476,  -490,
+		 -503,  -516,  -529,  -543,  -556,  -570,  -583,  -597,  -610,  -624,  -637,  -650,
+		 -664,  -677,  -691,  -704,  -717,  -730,  -744,  -757,  -770,  -783,  -796,  -808,
+		 -821,  -834,  -846,  -859,  -871,  -883,  -895,  -907,  -919,  -931,  -942,  -953,
+		 -964,  -975,  -986,  -997, -1007, -1018, -1028, -1038, -1047, -1057, -1066, -1075,
+		-1084, -1093, -1101, -1110, -1118, -1125, -1133, -1140, -1147, -1154, -1161, -1167,
+		-1173, -1179, -1184, -1190, -1195, -1200, -1204, -1208, -1212, -1216, -1220, -1223,
+		-1226, -1228, -1231, -1233, -1235, -1236, -1238, -1239, -1240, -1240, -1240, -1240,
+		-1240, -1240, -1239, -1238, -1236, -1235, -1233, -1231, -1229, -1226, -1224, -1221,
+		-1217, -1214, -1210, -1206, -1202, -1198, -1193, -1188, -1183, -1178, -1173, -1167,
+		-1161, -1156, -1149, -1143, -1137, -1130, -1123, -1116, -1109, -1102, -1095, -1087,
+		-1080, -1072, -1064, -1056, -1048, -1040, -1032, -1024, -1015, -1007,  -999,  -990,
+		 -981,  -973,  -964,  -956,  -947,  -938,  -929,  -921,  -912,  -903,  -895,  -886,
+		 -877,  -869,  -860,  -852,  -843,  -835,  -827,  -818,  -810,  -802,  -794,  -786,
+		 -778,  -771,  -763,  -756,  -749,  -741,  -734,  -728,  -721,  -714,  -708,  -702,
+		 -696,  -690,  -684,  -679,  -673,  -668,  -663,  -659,  -654,  -650,  -646,  -642,
+		 -638,  -635,  -632,  -629,  -626,  -623,  -621,  -619,  -617,  -616,  -614,  -613,
+		 -613,  -612,  -612,  -612,  -612,  -613,  -613,  -614,  -616,  -617,  -619,  -621,
+		 -623,  -626,  -628,  -631,  -635,  -638,  -642,  -646,  -650,  -655,  -659,  -664,
+		 -670,  -675,  -681,  -687,  -693,  -699,  -706,  -712,  -719,  -726,  -734,  -741,
+		 -749,  -757,  -765,  -773,  -782,  -791,  -799,  -808,  -817,  -826,  -836,  -845,
+		 -855,  -865,  -874,  -884,  -894,  -904,  -915,  -925,  -935,  -946,  -956,  -967,
+		 -977,  -988,  -998, -1009, -1020, -1030, -1041, -1052, -1062, -1073, -1083, -1094,
+		-1104, -1115, -1125, -1135, -1145, -1155, -1165, -1175, -1185, -1195, -1204, -1214,
+		-1223, -1232, -1241, -1250, -1258, -1267, -1275, -1283, -1291, -1298, -1306, -1313,
+		-1320, -1326, -1333, -1339, -1345, -1351, -1356, -1361, -1366, -1371, -1375, -1379,
+		-1382, -1386, -1389, -1391, -1394, -1396, -1398, -1399, -1400, -1400, -1401, -1401,
+		-1400, -1400, -1398, -1397, -1395, -1393, -1390, -1387, -1383, -1380, -1375, -1371,
+		-1366, -1360, -1355, -1348, -1342, -1335, -1327, -1320, -1311, -1303, -1294, -1284,
+		-1275, -1265, -1254, -1243, -1232, -1220, -1208, -1195, -1182, -1169, -1155, -1141,
+		-1127, -1112, -1097, -1082, -1066, -1049, -1033, -1016,  -999,  -981,  -963,  -945,
+		 -926,  -908,  -888,  -869,  -849,  -829,  -809,  -788,  -767,  -746,  -725,  -703,
+		 -681,  -659,  -636,  -614,  -591,  -568,  -545,  -521,  -498,  -474,  -450,  -426,
+		 -402,  -377,  -353,  -328,  -303,  -278,  -253,  -228,  -203,  -178,  -153,  -127,
+		 -102,   -76,   -51,   -25,     0,
+	},
+	// Electric level 0,1,2,3,4,5,6
+	{
+		    0,    19,    38,    57,    77,    96,   115,   134,   153,   172,   191,   210,
+		  229,   247,   266,   285,   304,   322,   341,   359,   378,   396,   415,   433,
+		  451,   469,   487,   505,   523,   540,   558,   575,   593,   610,   627,   644,
+		  661,   678,   694,   711,   727,   744,   760,   776,   792,   807,   823,   838,
+		  854,   869,   884,   898,   913,   927,   942,   956,   970,   984,   997,  1011,
+		 1024,  1037,  1050,  1063,  1076,  1088,  1100,  1112,  1124,  1136,  1147,  1158,
+		 1170,  1180,  1191,  1202,  1212,  1222,  1232,  1242,  1252,  1261,  1270,  1279,
+		 1288,  1297,  1305,  1313,  1321,  1329,  1337,  1344,  1351,  1358,  1365,  1372,
+		 1379,  1385,  1391,  1397,  1403,  1408,  1414,  1419,  1424,  1429,  1433,  1438,
+		 1442,  1446,  1450,  1454,  1457,  1461,  1464,  1467,  1470,  1473,  1475,  1478,
+		 1480,  1482,  1484,  1486,  1488,  1489,  1490,  1492,  1493,  1494,  1494,  1495,
+		 1496,  1496,  1496,  1496,  1496,  1496,  1496,  1496,  1495,  1494,  1494,  1493,
+		 1492,  1491,  1490,  1488,  1487,  1486,  1484,  1482,  1481,  1479,  1477,  1475,
+		 1473,  1471,  1469,  1466,  1464,  1462,  1459,  1457,  1454,  1451,  1449,  1446,
+		 1443,  1440,  1437,  1434,  1431,  1428,  1425,  1422,  1419,  1415,  1412,  1409,
+		 1406,  1402,  1399,  1395,  1392,  1389,  1385,  1382,  1378,  1375,  1371,  1368,
+		 1364,  1361,  1357,  1354,  1350,  1347,  1343,  1340,  1336,  1333,  1329,  1326,
+		 1323,  1319,  1316,  1312,  1309,  1305,  1302,  1299,  1295,  1292,  1289,  1285,
+		 1282,  1279,  1276,  1272,  1269,  1266,  1263,  1260,  1257,  1254,  1251,  1247,
+		 1244,  1241,  1239,  1236,  1233,  1230,  1227,  1224,  1221,  1219,  1216,  1213,
+		 1210,  1208,  1205,  1202,  1200,  1197,  1194,  1192,  1189,  1187,  1184,  1182,
+		 1179,  1177,  1175,  1172,  1170,  1167,  1165,  1163,  1160,  1158,  1156,  1153,
+		 1151,  1149,  1146,  1144,  1142,  1140,  1137,  1135,  1133,  1131,  1128,  1126,
+		 1124,  1121,  1119,  1117,  1115,  1112,  1110,  1108,  1105,  1103,  1101,  1098,
+		 1096,  1094,  1091,  1089,  1086,  1084,  1082,  1079,  1077,  1074,  1071,  1069,
+		 1066,  1064,  1061,  1058,  1056,  1053,  1050,  1047,  1045,  1042,  1039,  1036,
+		 1033,  1030,  1027,  1024,  1021,  1018,  1014,  1011,  1008,  1005,  1001,   998,
+		  995,   991,   988,   984,   980,   977,   973,   969,   966,   962,   958,   954,
+		  950,   946,   942,   938,   934,   930,   926,   922,   917,   913,   909,   904,
+		  900,   895,   891,   886,   881,   877,   872,   867,   862,   858,   853,   848,
+		  843,   838,   833,   828,   823,   817,   812,   807,   802,   796,   791,   786,
+		  780,   775,   769,   764,   758,   753,   747,   741,   736,   730,   724,   719,
+		  713,   707,   701,   695,   690,   684,   678,   672,   666,   660,   654,   648,
+		  642,   636,   630,   624,   618,   612,   606,   600,   594,   588,   581,   575,
+		  569,   563,   557,   551,   545,   539,   532,   526,   520,   514,   508,   502,
+		  496,   490,   484,   477,   471,   465,   459,   453,   447,   441,   435,   429,
+		  423,   417,   411,   405,   399,   393,   387,   381,   376,   370,   364,   358,
+		  352,   346,   341,   335,   329,   323,   318,   312,   306,   301,   295,   290,
+		  284,   278,   273,   267,   262,   256,   251,   246,   240,   235,   229,   224,
+		  219,   213,   208,   203,   198,   192,   187,   182,   177,   172,   167,   161,
+		  156,   151,   146,   141,   136,   131,   126,   121,   116,   111,   106,   101,
+		   97,    92,    87,    82,    77,    72,    67,    62,    58,    53,    48,    43,
+		   38,    34,    29,    24,    19,    14,    10,     5,     0,    -5,   -10,   -14,
+		  -19,   -24,   -29,   -34,   -38,   -43,   -48,   -53,   -58,   -62,   -67,   -72,
+		  -77,   -82,   -87,   -92,   -97,  -101,  -106,  -111,  -116,  -121,  -126,  -131,
+		 -136,  -141,  -146,  -151,  -156,  -161,  -167,  -172,  -177,  -182,  -187,  -192,
+		 -198,  -203,  -208,  -213,  -219,  -224,  -229,  -235,  -240,  -246,  -251,  -256,
+		 -262,  -267,  -273,  -278,  -284,  -290,  -295,  -301,  -306,  -312,  -318,  -323,
+		 -329,  -335,  -341,  -346,  -352,  -358,  -364,  -370,  -376,  -381,  -387,  -393,
+		 -399,  -405,  -411,  -417,  -423,  -429,  -435,  -441,  -447,  -453,  -459,  -465,
+		 -471,  -477,  -484,  -490,  -496,  -502,  -508,  -514,  -520,  -526,  -532,  -539,
+		 -545,  -551,  -557,  -563,  -569,  -575,  -581,  -588,  -594,  -600,  -606,  -612,
+		 -618,  -624,  -630,  -636,  -642,  -648,  -654,  -660,  -666,  -672,  -678,  -684,
+		 -690,  -695,  -701,  -707,  -713,  -719,  -724,  -730,  -736,  -741,  -747,  -753,
+		 -758,  -764,  -769,  -775,  -780,  -786,  -791,  -796,  -802,  -807,  -812,  -817,
+		 -823,  -828,  -833,  -838,  -843,  -848,  -853,  -858,  -862,  -867,  -872,  -877,
+		 -881,  -886,  -891,  -895,  -900,  -904,  -909,  -913,  -917,  -922,  -926,  -930,
+		 -934,  -938,  -942,  -946,  -950,  -954,  -958,  -962,  -966,  -969,  -973,  -977,
+		 -980,  -984,  -988,  -991,  -995,  -998, -1001, -1005, -1008, -1011, -1014, -1018,
+		-1021, -1024, -1027, -1030, -1033, -1036, -1039, -1042, -1045, -1047, -1050, -1053,
+		-1056, -1058, -1061, -1064, -1066, -1069, -1071, -1074, -1077, -1079, -1082, -1084,
+		-1086, -1089, -1091, -1094, -1096, -1098, -1101, -1103, -1105, -1108, -1110, -1112,
+		-1115, -1117, -1119, -1121, -1124, -1126, -1128, -1131, -1133, -1135, -1137, -1140,
+		-1142, -1144, -1146, -1149, -1151, -1153, -1156, -1158, -1160, -1163, -1165, -1167,
+		-1170, -1172, -1175, -1177, -1179, -1182, -1184, -1187, -1189, -1192, -1194, -1197,
+		-1200, -1202, -1205, -1208, -1210, -1213, -1216, -1219, -1221, -1224, -1227, -1230,
+		-1233, -1236, -1239, -1241, -1244, -1247, -1251, -1254, -1257, -1260, -1263, -1266,
+		-1269, -1272, -1276, -1279, -1282, -1285, -1289, -1292, -1295, -1299, -1302, -1305,
+		-1309, -1312, -1316, -1319, -1323, -1326, -1329, -1333, -1336, -1340, -1343, -1347,
+		-1350, -1354, -1357, -1361, -1364, -1368, -1371, -1375, -1378, -1382, -1385, -1389,
+		-1392, -1395, -1399, -1402, -1406, -1409, -1412, -1415, -1419, -1422, -1425, -1428,
+		-1431, -1434, -1437, -1440, -1443, -1446, -1449, -1451, -1454, -1457, -1459, -1462,
+		-1464, -1466, -1469, -1471, -1473, -1475, -1477, -1479, -1481, -1482, -1484, -1486,
+		-1487, -1488, -1490, -1491, -1492, -1493, -1494, -1494, -1495, -1496, -1496, -1496,
+		-1496, -1496, -1496, -1496, -1496, -1495, -1494, -1494, -1493, -1492, -1490, -1489,
+		-1488, -1486, -1484, -1482, -1480, -1478, -1475, -1473, -1470, -1467, -1464, -1461,
+		-1457, -1454, -1450, -1446, -1442, -1438, -1433, -1429, -1424, -1419, -1414, -1408,
+		-1403, -1397, -1391, -1385, -1379, -1372, -1365, -1358, -1351, -1344, -1337, -1329,
+		-1321, -1313, -1305, -1297, -1288, -1279, -1270, -1261, -1252, -1242, -1232, -1222,
+		-1212, -1202, -1191, -1180, -1170, -1158, -1147, -1136, -1124, -1112, -1100, -1088,
+		-1076, -1063, -1050, -1037, -1024, -1011,  -997,  -984,  -970,  -956,  -942,  -927,
+		 -913,  -898,  -884,  -869,  -854,  -838,  -823,  -807,  -792,  -776,  -760,  -744,
+		 -727,  -711,  -694,  -678,  -661,  -644,  -627,  -610,  -593,  -575,  -558,  -540,
+		 -523,  -505,  -487,  -469,  -451,  -433,  -415,  -396,  -378,  -359,  -341,  -322,
+		 -304,  -285,  -266,  -247,  -229,  -210,  -191,  -172,  -153,  -134,  -115,   -96,
+		  -77,   -57,   -38,   -19,     0,
+	},
+#if MAX_NOTES > 48
+	// Piano level 7
+	{
+		    0,     9,    18,    28,    37,    46,    55,    65,    74,    83,    92,   101,
+		  111,   120,   129,   138,   147,   156,   166,   175,   184,   193,   202,   211,
+		  220,   229,   238,   247,   256,   265,   274,   283,   292,   301,   310,   319,
+		  328,   337,   345,   354,   363,   372,   380,   389,   398,   407,   415,   424,
+		  432,   441,   449,   458,   466,   475,   483,   492,   500,   508,   517,   525,
+		  533,   541,   550,   558,   566,   574,   582,   590,   598,   606,   614,   621,
+		  629,   637,   645,   652,   660,   668,   675,   683,   690,   698,   705,   713,
+		  720,   727,   734,   742,   749,   756,   763,   770,   777,   784,   791,   797,
+		  804,   811,   818,   824,   831,   837,   844,   850,   857,   863,   869,   876,
+		  882,   888,   894,   900,   906,   912,   918,   924,   929,   935,   941,   946,
+		  952,   957,   963,   968,   973,   979,   984,   989,   994,   999,  1004,  1009,
+		 1014,  1019,  1024,  1028,  1033,  1038,  1042,  1047,  1051,  1055,  1060,  1064,
+		 1068,  1072,  1076,  1080,  1084,  1088,  1092,  1096,  1099,  1103,  1107,  1110,
+		 1114,  1117,  1120,  1124,  1127,  1130,  1133,  1136,  1139,  1142,  1145,  1148,
+		 1151,  1153,  1156,  1159,  1161,  1164,  1166,  1168,  1171,  1173,  1175,  1177,
+		 1179,  1181,  1183,  1185,  1187,  1188,  1190,  1192,  1193,  1195,  1196,  1198,
+		 1199,  1200,  1201,  1202,  1204,  1205,  1206,  1206,  1207,  1208,  1209,  1210,
+		 1210,  1211,  1211,  1212,  1212,  1213,  1213,  1213,  1213,  1213,  1213,  1213,
+		 1213,  1213,  1213,  1213,  1213,  1212,  1212,  1212,  1211,  1211,  1210,  1209,
+		 1209,  1208,  1207,  1206,  1206,  1205,  1204,  1203,  1202,  1200,  1199,  1198,
+		 1197,  1195,  1194,  1193,  1191,  1190,  1188,  1186,  1185,  1183,  1181,  1179,
+		 1178,  1176,  1174,  1172,  1170,  1168,  1166,  1163,  1161,  1159,  1157,  1154,
+		 1152,  1150,  1147,  1145,  1142,  1139,  1137,  1134,  1131,  1129,  1126,  1123,
+		 1120,  1117,  1115,  1112,  1109,  1106,  1102,  1099,  1096,  1093,  1090,  1087,
+		 1083,  1080,  1077,  1073,  1070,  1066,  1063,  1059,  1056,  1052,  1049,  1045,
+		 1041,  1038,  1034,  1030,  1027,  1023,  1019,  1015,  1011,  1007,  1003,   999,
+		  995,   991,   987,   983,   979,   975,   971,   967,   963,   958,   954,   950,
+		  946,   941,   937,   933,   928,   924,   919,   915,   911,   906,   902,   897,
+		  893,   888,   884,   879,   874,   870,   865,   861,   856,   851,   847,   842,
+		  837,   832,   828,   823,   818,   813,   809,   804,   799,   794,   789,   784,
+		  780,   775,   770,   765,   760,   755,   750,   745,   740,   735,   730,   725,
+		  720,   715,   710,   705,   700,   695,   690,   685,   680,   675,   670,   665,
+		  660,   655,   650,   645,   640,   635,   629,   624,   619,   614,   609,   604,
+		  599,   594,   588,   583,   578,   573,   568,   563,   558,   552,   547,   542,
+		  537,   532,   527,   521,   516,   511,   506,   501,   495,   490,   485,   480,
+		  475,   470,   464,   459,   454,   449,   444,   438,   433,   428,   423,   418,
+		  412,   407,   402,   397,   392,   387,   381,   376,   371,   366,   361,   355,
+		  350,   345,   340,   335,   329,   324,   319,   314,   309,   304,   298,   293,
+		  288,   283,   278,   273,   267,   262,   257,   252,   247,   242,   236,   231,
+		  226,   221,   216,   211,   205,   200,   195,   190,   185,   180,   175,   169,
+		  164,   159,   154,   149,   144,   139,   133,   128,   123,   118,   113,   108,
+		  103,    97,    92,    87,    82,    77,    72,    67,    62,    56,    51,    46,
+		   41,    36,    31,    26,    21,    15,    10,     5,     0,    -5,   -10,   -15,
+		  -21,   -26,   -31,   -36,   -41,   -46,   -51,   -56,   -62,   -67,   -72,   -77,
+		  -82,   -87,   -92,   -97,  -103,  -108,  -113,  -118,  -123,  -128,  -133,  -139,
+		 -144,  -149,  -154,  -159,  -164,  -169,  -175,  -180,  -185,  -190,  -195,  -200,
+		 -205,  -211,  -216,  -221,  -226,  -231,  -236,  -242,  -247,  -252,  -257,  -262,
+		 -267,  -273,  -278,  -283,  -288,  -293,  -298,  -304,  -309,  -314,  -319,  -324,
+		 -329,  -335,  -340,  -345,  -350,  -355,  -361,  -366,  -371,  -376,  -381,  -387,
+		 -392,  -397,  -402,  -407,  -412,  -418,  -423,  -428,  -433,  -438,  -444,  -449,
+		 -454,  -459,  -464,  -470,  -475,  -480,  -485,  -490,  -495,  -501,  -506,  -511,
+		 -516,  -521,  -527,  -532,  -537,  -542,  -547,  -552,  -558,  -563,  -568,  -573,
+		 -578,  -583,  -588,  -594,  -599,  -604,  -609,  -614,  -619,  -624,  -629,  -635,
+		 -640,  -645,  -650,  -655,  -660,  -665,  -670,  -675,  -680,  -685,  -690,  -695,
+		 -700,  -705,  -710,  -715,  -720,  -725,  -730,  -735,  -740,  -745,  -750,  -755,
+		 -760,  -765,  -770,  -775,  -780,  -784,  -789,  -794,  -799,  -804,  -809,  -813,
+		 -818,  -823,  -828,  -832,  -837,  -842,  -847,  -851,  -856,  -861,  -865,  -870,
+		 -874,  -879,  -884,  -888,  -893,  -897,  -902,  -906,  -911,  -915,  -919,  -924,
+		 -928,  -933,  -937,  -941,  -946,  -950,  -954,  -958,  -963,  -967,  -971,  -975,
+		 -979,  -983,  -987,  -991,  -995,  -999, -1003, -1007, -1011, -1015, -1019, -1023,
+		-1027, -1030, -1034, -1038, -1041, -1045, -1049, -1052, -1056, -1059, -1063, -1066,
+		-1070, -1073, -1077, -1080, -1083, -1087, -1090, -1093, -1096, -1099, -1102, -1106,
+		-1109, -1112, -1115, -1117, -1120, -1123, -1126, -1129, -1131, -1134, -1137, -1139,
+		-1142, -1145, -1147, -1150, -1152, -1154, -1157, -1159, -1161, -1163, -1166, -1168,
+		-1170, -1172, -1174, -1176, -1178, -1179, -1181, -1183, -1185, -1186, -1188, -1190,
+		-1191, -1193, -1194, -1195, -1197, -1198, -1199, -1200, -1202, -1203, -1204, -1205,
+		-1206, -1206, -1207, -1208, -1209, -1209, -1210, -1211, -1211, -1212, -1212, -1212,
+		-1213, -1213, -1213, -1213, -1213, -1213, -1213, -1213, -1213, -1213, -1213, -1213,
+		-1212, -1212, -1211, -1211, -1210, -1210, -1209, -1208, -1207, -1206, -1206, -1205,
+		-1204, -1202, -1201, -1200, -1199, -1198, -1196, -1195, -1193, -1192, -1190, -1188,
+		-1187, -1185, -1183, -1181, -1179, -1177, -1175, -1173, -1171, -1168, -1166, -1164,
+		-1161, -1159, -1156, -1153, -1151, -1148, -1145, -1142, -1139, -1136, -1133, -1130,
+		-1127, -1124, -1120, -1117, -1114, -1110, -1107, -1103, -1099, -1096, -1092, -1088,
+		-1084, -1080, -1076, -1072, -1068, -1064, -1060, -1055, -1051, -1047, -1042, -1038,
+		-1033, -1028, -1024, -1019, -1014, -1009, -1004,  -999,  -994,  -989,  -984,  -979,
+		 -973,  -968,  -963,  -957,  -952,  -946,  -941,  -935,  -929,  -924,  -918,  -912,
+		 -906,  -900,  -894,  -888,  -882,  -876,  -869,  -863,  -857,  -850,  -844,  -837,
+		 -831,  -824,  -818,  -811,  -804,  -797,  -791,  -784,  -777,  -770,  -763,  -756,
+		 -749,  -742,  -734,  -727,  -720,  -713,  -705,  -698,  -690,  -683,  -675,  -668,
+		 -660,  -652,  -645,  -637,  -629,  -621,  -614,  -606,  -598,  -590,  -582,  -574,
+		 -566,  -558,  -550,  -541,  -533,  -525,  -517,  -508,  -500,  -492,  -483,  -475,
+		 -466,  -458,  -449,  -441,  -432,  -424,  -415,  -407,  -398,  -389,  -380,  -372,
+		 -363,  -354,  -345,  -337,  -328,  -319,  -310,  -301,  -292,  -283,  -274,  -265,
+		 -256,  -247,  -238,  -229,  -220,  -211,  -202,  -193,  -184,  -175,  -166,  -156,
+		 -147,  -138,  -129,  -120,  -111,  -101,   -92,   -83,   -74,   -65,   -55,   -46,
+		  -37,   -28,   -18,    -9,     0,
+	},
+	// Bright level 7
+	{
+		    0,    10,    19,    29,    39,    48,    58,    68,    77,    87,    97,   106,
+		  116,   126,   135,   145,   155,   164,   174,   183,   193,   202,   212,   221,
+		  231,   240,   250,   259,   269,   278,   288,   297,   306,   316,   325,   334,
+		  343,   353,   362,   371,   380,   389,   399,   408,   417,   426,   435,   444,
+		  453,   461,   470,   479,   488,   497,   505,   514,   523,   531,   540,   549,
+		  557,   566,   574,   582,   591,   599,   607,   615,   624,   632,   640,   648,
+		  656,   664,   672,   680,   688,   695,   703,   711,   718,   726,   733,   741,
+		  748,   756,   763,   770,   778,   785,   792,   799,   806,   813,   820,   827,
+		  834,   840,   847,   854,   860,   867,   873,   879,   886,   892,   898,   904,
+		  911,   917,   923,   929,   934,   940,   946,   952,   957,   963,   968,   974,
+		  979,   984,   990,   995,  1000,  1005,  1010,  1015,  1020,  1024,  1029,  1034,
+		 1038,  1043,  1047,  1052,  1056,  1060,  1065,  1069,  1073,  1077,  1081,  1085,
+		 1088,  1092,  1096,  1099,  1103,  1106,  1110,  1113,  1116,  1120,  1123,  1126,
+		 1129,  1132,  1135,  1137,  1140,  1143,  1145,  1148,  1150,  1153,  1155,  1157,
+		 1159,  1162,  1164,  1166,  1168,  1169,  1171,  1173,  1175,  1176,  1178,  1179,
+		 1180,  1182,  1183,  1184,  1185,  1186,  1187,  1188,  1189,  1190,  1191,  1191,
+		 1192,  1193,  1193,  1194,  1194,  1194,  1194,  1195,  1195,  1195,  1195,  1195,
+		 1195,  1194,  1194,  1194,  1193,  1193,  1192,  1192,  1191,  1191,  1190,  1189,
+		 1188,  1187,  1186,  1185,  1184,  1183,  1182,  1181,  1179,  1178,  1177,  1175,
+		 1174,  1172,  1171,  1169,  1167,  1165,  1164,  1162,  1160,  1158,  1156,  1154,
+		 1152,  1149,  1147,  1145,  1143,  1140,  1138,  1135,  1133,  1130,  1128,  1125,
+		 1122,  1120,  1117,  1114,  1111,  1108,  1105,  1102,  1099,  1096,  1093,  1090,
+		 1087,  1084,  1081,  1077,  1074,  1071,  1067,  1064,  1060,  1057,  1053,  1050,
+		 1046,  1042,  1039,  1035,  1031,  1028,  1024,  1020,  1016,  1012,  1008,  1004,
+		 1000,   996,   992,   988,   984,   980,   976,   972,   968,   963,   959,   955,
+		  951,   946,   942,   938,   933,   929,   925,   920,   916,   911,   907,   902,
+		  898,   893,   889,   884,   880,   875,   870,   866,   861,   857,   852,   847,
+		  843,   838,   833,   828,   824,   819,   814,   809,   805,   800,   795,   790,
+		  785,   781,   776,   771,   766,   761,   757,   752,   747,   742,   737,   732,
+		  727,   722,   718,   713,   708,   703,   698,   693,   688,   683,   678,   674,
+		  669,   664,   659,   654,   649,   644,   639,   634,   630,   625,   620,   615,
+		  610,   605,   600,   595,   591,   586,   581,   576,   571,   566,   561,   557,
+		  552,   547,   542,   537,   533,   528,   523,   518,   513,   509,   504,   499,
+		  494,   490,   485,   480,   476,   471,   466,   461,   457,   452,   447,   443,
+		  438,   433,   429,   424,   420,   415,   410,   406,   401,   397,   392,   388,
+		  383,   378,   374,   369,   365,   360,   356,   352,   347,   343,   338,   334,
+		  329,   325,   320,   316,   312,   307,   303,   299,   294,   290,   286,   281,
+		  277,   273,   268,   264,   260,   256,   251,   247,   243,   239,   234,   230,
+		  226,   222,   218,   213,   209,   205,   201,   197,   193,   188,   184,   180,
+		  176,   172,   168,   164,   160,   156,   152,   148,   143,   139,   135,   131,
+		  127,   123,   119,   115,   111,   107,   103,    99,    95,    91,    87,    83,
+		   79,    75,    71,    67,    63,    59,    55,    51,    47,    43,    40,    36,
+		   32,    28,    24,    20,    16,    12,     8,     4,     0,    -4,    -8,   -12,
+		  -16,   -20,   -24,   -28,   -32,   -36,   -40,   -43,   -47,   -51,   -55,   -59,
+		  -63,   -67,   -71,   -75,   -79,   -83,   -87,   -91,   -95,   -99,  -103,  -107,
+		 -111,  -115,  -119,  -123,  -127,  -131,  -135,  -139,  -143,  -148,  -152,  -156,
+		 -160,  -164,  -168,  -172,  -176,  -180,  -184,  -188,  -193,  -197,  -201,  -205,
+		 -209,  -213,  -218,  -222,  -226,  -230,  -234,  -239,  -243,  -247,  -251,  -256,
+		 -260,  -264,  -268,  -273,  -277,  -281,  -286,  -290,  -294,  -299,  -303,  -307,
+		 -312,  -316,  -320,  -325,  -329,  -334,  -338,  -343,  -347,  -352,  -356,  -360,
+		 -365,  -369,  -374,  -378,  -383,  -388,  -392,  -397,  -401,  -406,  -410,  -415,
+		 -420,  -424,  -429,  -433,  -438,  -443,  -447,  -452,  -457,  -461,  -466,  -471,
+		 -476,  -480,  -485,  -490,  -494,  -499,  -504,  -509,  -513,  -518,  -523,  -528,
+		 -533,  -537,  -542,  -547,  -552,  -557,  -561,  -566,  -571,  -576,  -581,  -586,
+		 -591,  -595,  -600,  -605,  -610,  -615,  -620,  -625,  -630,  -634,  -639,  -644,
+		 -649,  -654,  -659,  -664,  -669,  -674,  -678,  -683,  -688,  -693,  -698,  -703,
+		 -708,  -713,  -718,  -722,  -727,  -732,  -737,  -742,  -747,  -752,  -757,  -761,
+		 -766,  -771,  -776,  -781,  -785,  -790,  -795,  -800,  -805,  -809,  -814,  -819,
+		 -824,  -828,  -833,  -838,  -843,  -847,  -852,  -857,  -861,  -866,  -870,  -875,
+		 -880,  -884,  -889,  -893,  -898,  -902,  -907,  -911,  -916,  -920,  -925,  -929,
+		 -933,  -938,  -942,  -946,  -951,  -955,  -959,  -963,  -968,  -972,  -976,  -980,
+		 -984,  -988,  -992,  -996, -1000, -1004, -1008, -1012, -1016, -1020, -1024, -1028,
+		-1031, -1035, -1039, -1042, -1046, -1050, -1053, -1057, -1060, -1064, -1067, -1071,
+		-1074, -1077, -1081, -1084, -1087, -1090, -1093, -1096, -1099, -1102, -1105, -1108,
+		-1111, -1114, -1117, -1120, -1122, -1125, -1128, -1130, -1133, -1135, -1138, -1140,
+		-1143, -1145, -1147, -1149, -1152, -1154, -1156, -1158, -1160, -1162, -1164, -1165,
+		-1167, -1169, -1171, -1172, -1174, -1175, -1177, -1178, -1179, -1181, -1182, -1183,
+		-1184, -1185, -1186, -1187, -1188, -1189, -1190, -1191, -1191, -1192, -1192, -1193,
+		-1193, -1194, -1194, -1194, -1195, -1195, -1195, -1195, -1195, -1195, -1194, -1194,
+		-1194, -1194, -1193, -1193, -1192, -1191, -1191, -1190, -1189, -1188, -1187, -1186,
+		-1185, -1184, -1183, -1182, -1180, -1179, -1178, -1176, -1175, -1173, -1171, -1169,
+		-1168, -1166, -1164, -1162, -1159, -1157, -1155, -1153, -1150, -1148, -1145, -1143,
+		-1140, -1137, -1135, -1132, -1129, -1126, -1123, -1120, -1116, -1113, -1110, -1106,
+		-1103, -1099, -1096, -1092, -1088, -1085, -1081, -1077, -1073, -1069, -1065, -1060,
+		-1056, -1052, -1047, -1043, -1038, -1034, -1029, -1024, -1020, -1015, -1010, -1005,
+		-1000,  -995,  -990,  -984,  -979,  -974,  -968,  -963,  -957,  -952,  -946,  -940,
+		 -934,  -929,  -923,  -917,  -911,  -904,  -898,  -892,  -886,  -879,  -873,  -867,
+		 -860,  -854,  -847,  -840,  -834,  -827,  -820,  -813,  -806,  -799,  -792,  -785,
+		 -778,  -770,  -763,  -756,  -748,  -741,  -733,  -726,  -718,  -711,  -703,  -695,
+		 -688,  -680,  -672,  -664,  -656,  -648,  -640,  -632,  -624,  -615,  -607,  -599,
+		 -591,  -582,  -574,  -566,  -557,  -549,  -540,  -531,  -523,  -514,  -505,  -497,
+		 -488,  -479,  -470,  -461,  -453,  -444,  -435,  -426,  -417,  -408,  -399,  -389,
+		 -380,  -371,  -362,  -353,  -343,  -334,  -325,  -316,  -306,  -297,  -288,  -278,
+		 -269,  -259,  -250,  -240,  -231,  -221,  -212,  -202,  -193,  -183,  -174,  -164,
+		 -155,  -145,  -135,  -126,  -116,  -106,   -97,   -87,   -77,   -68,   -58,   -48,
+		  -39,   -29,   -19,   -10,     0,
+	},
+	// Electric level 7
+	{
+		    0,    13,    26,    39,    53,    66,    79,    92,   105,   118,   131,   145,
+		  158,   171,   184,   197,   210,   223,   236,   249,   262,   275,   288,   301,
+		  313,   326,   339,   352,   365,   377,   390,   403,   415,   428,   441,   453,
+		  466,   478,   491,   503,   515,   528,   540,   552,   564,   577,   589,   601,
+		  613,   625,   637,   649,   660,   672,   684,   695,   707,   719,   730,   742,
+		  753,   764,   776,   787,   798,   809,   820,   831,   842,   853,   864,   874,
+		  885,   895,   906,   916,   927,   937,   947,   957,   967,   977,   987,   997,
+		 1007,  1017,  1026,  1036,  1045,  1055,  1064,  1073,  1083,  1092,  1101,  1110,
+		 1118,  1127,  1136,  1144,  1153,  1161,  1170,  1178,  1186,  1194,  1202,  1210,
+		 1218,  1226,  1233,  1241,  1248,  1256,  1263,  1270,  1277,  1284,  1291,  1298,
+		 1304,  1311,  1318,  1324,  1330,  1337,  1343,  1349,  1355,  1361,  1367,  1372,
+		 1378,  1383,  1389,  1394,  1399,  1404,  1409,  1414,  1419,  1424,  1428,  1433,
+		 1437,  1442,  1446,  1450,  1454,  1458,  1462,  1466,  1469,  1473,  1476,  1480,
+		 1483,  1486,  1489,  1492,  1495,  1498,  1500,  1503,  1505,  1508,  1510,  1512,
+		 1514,  1516,  1518,  1520,  1522,  1523,  1525,  1526,  1528,  1529,  1530,  1531,
+		 1532,  1533,  1534,  1534,  1535,  1536,  1536,  1536,  1536,  1537,  1537,  1537,
+		 1536,  1536,  1536,  1536,  1535,  1534,  1534,  1533,  1532,  1531,  1530,  1529,
+		 1528,  1527,  1525,  1524,  1523,  1521,  1519,  1518,  1516,  1514,  1512,  1510,
+		 1508,  1505,  1503,  1501,  1498,  1496,  1493,  1490,  1488,  1485,  1482,  1479,
+		 1476,  1473,  1470,  1466,  1463,  1460,  1456,  1453,  1449,  1445,  1442,  1438,
+		 1434,  1430,  1426,  1422,  1418,  1414,  1410,  1406,  1401,  1397,  1392,  1388,
+		 1383,  1379,  1374,  1369,  1365,  1360,  1355,  1350,  1345,  1340,  1335,  1330,
+		 1325,  1320,  1314,  1309,  1304,  1298,  1293,  1288,  1282,  1276,  1271,  1265,
+		 1260,  1254,  1248,  1243,  1237,  1231,  1225,  1219,  1213,  1207,  1201,  1195,
+		 1189,  1183,  1177,  1171,  1165,  1159,  1152,  1146,  1140,  1134,  1127,  1121,
+		 1115,  1108,  1102,  1096,  1089,  1083,  1076,  1070,  1064,  1057,  1051,  1044,
+		 1038,  1031,  1024,  1018,  1011,  1005,   998,   992,   985,   978,   972,   965,
+		  959,   952,   945,   939,   932,   926,   919,   912,   906,   899,   893,   886,
+		  879,   873,   866,   860,   853,   846,   840,   833,   827,   820,   814,   807,
+		  800,   794,   787,   781,   774,   768,   762,   755,   749,   742,   736,   729,
+		  723,   717,   710,   704,   698,   691,   685,   679,   672,   666,   660,   654,
+		  648,   641,   635,   629,   623,   617,   611,   605,   599,   593,   587,   581,
+		  575,   569,   563,   557,   552,   546,   540,   534,   528,   523,   517,   511,
+		  506,   500,   494,   489,   483,   478,   472,   467,   461,   456,   451,   445,
+		  440,   434,   429,   424,   419,   413,   408,   403,   398,   393,   388,   383,
+		  378,   373,   368,   363,   358,   353,   348,   343,   338,   333,   329,   324,
+		  319,   314,   310,   305,   300,   296,   291,   287,   282,   278,   273,   269,
+		  264,   260,   255,   251,   247,   242,   238,   234,   229,   225,   221,   217,
+		  212,   208,   204,   200,   196,   192,   188,   184,   180,   175,   171,   167,
+		  164,   160,   156,   152,   148,   144,   140,   136,   132,   128,   125,   121,
+		  117,   113,   109,   106,   102,    98,    94,    91,    87,    83,    80,    76,
+		   72,    69,    65,    61,    58,    54,    50,    47,    43,    40,    36,    32,
+		   29,    25,    22,    18,    14,    11,     7,     4,     0,    -4,    -7,   -11,
+		  -14,   -18,   -22,   -25,   -29,   -32,   -36,   -40,   -43,   -47,   -50,   -54,
+		  -58,   -61,   -65,   -69,   -72,   -76,   -80,   -83,   -87,   -91,   -94,   -98,
+		 -102,  -106,  -109,  -113,  -117,  -121,  -125,  -128,  -132,  -136,  -140,  -144,
+		 -148,  -152,  -156,  -160,  -164,  -167,  -171,  -175,  -180,  -184,  -188,  -192,
+		 -196,  -200,  -204,  -208,  -212,  -217,  -221,  -225,  -229,  -234,  -238,  -242,
+		 -247,  -251,  -255,  -260,  -264,  -269,  -273,  -278,  -282,  -287,  -291,  -296,
+		 -300,  -305,  -310,  -314,  -319,  -324,  -329,  -333,  -338,  -343,  -348,  -353,
+		 -358,  -363,  -368,  -373,  -378,  -383,  -388,  -393,  -398,  -403,  -408,  -413,
+		 -419,  -424,  -429,  -434,  -440,  -445,  -451,  -456,  -461,  -467,  -472,  -478,
+		 -483,  -489,  -494,  -500,  -506,  -511,  -517,  -523,  -528,  -534,  -540,  -546,
+		 -552,  -557,  -563,  -569,  -575,  -581,  -587,  -593,  -599,  -605,  -611,  -617,
+		 -623,  -629,  -635,  -641,  -648,  -654,  -660,  -666,  -672,  -679,  -685,  -691,
+		 -698,  -704,  -710,  -717,  -723,  -729,  -736,  -742,  -749,  -755,  -762,  -768,
+		 -774,  -781,  -787,  -794,  -800,  -807,  -814,  -820,  -827,  -833,  -840,  -846,
+		 -853,  -860,  -866,  -873,  -879,  -886,  -893,  -899,  -906,  -912,  -919,  -926,
+		 -932,  -939,  -945,  -952,  -959,  -965,  -972,  -978,  -985,  -992,  -998, -1005,
+		-1011, -1018, -1024, -1031, -1038, -1044, -1051, -1057, -1064, -1070, -1076, -1083,
+		-1089, -1096, -1102, -1108, -1115, -1121, -1127, -1134, -1140, -1146, -1152, -1159,
+		-1165, -1171, -1177, -1183, -1189, -1195, -1201, -1207, -1213, -1219, -1225, -1231,
+		-1237, -1243, -1248, -1254, -1260, -1265, -1271, -1276, -1282, -1288, -1293, -1298,
+		-1304, -1309, -1314, -1320, -1325, -1330, -1335, -1340, -1345, -1350, -1355, -1360,
+		-1365, -1369, -1374, -1379, -1383, -1388, -1392, -1397, -1401, -1406, -1410, -1414,
+		-1418, -1422, -1426, -1430, -1434, -1438, -1442, -1445, -1449, -1453, -1456, -1460,
+		-1463, -1466, -1470, -1473, -1476, -1479, -1482, -1485, -1488, -1490, -1493, -1496,
+		-1498, -1501, -1503, -1505, -1508, -1510, -1512, -1514, -1516, -1518, -1519, -1521,
+		-1523, -1524, -1525, -1527, -1528, -1529, -1530, -1531, -1532, -1533, -1534, -1534,
+		-1535, -1536, -1536, -1536, -1536, -1537, -1537, -1537, -1536, -1536, -1536, -1536,
+		-1535, -1534, -1534, -1533, -1532, -1531, -1530, -1529, -1528, -1526, -1525, -1523,
+		-1522, -1520, -1518, -1516, -1514, -1512, -1510, -1508, -1505, -1503, -1500, -1498,
+		-1495, -1492, -1489, -1486, -1483, -1480, -1476, -1473, -1469, -1466, -1462, -1458,
+		-1454, -1450, -1446, -1442, -1437, -1433, -1428, -1424, -1419, -1414, -1409, -1404,
+		-1399, -1394, -1389, -1383, -1378, -1372, -1367, -1361, -1355, -1349, -1343, -1337,
+		-1330, -1324, -1318, -1311, -1304, -1298, -1291, -1284, -1277, -1270, -1263, -1256,
+		-1248, -1241, -1233, -1226, -1218, -1210, -1202, -1194, -1186, -1178, -1170, -1161,
+		-1153, -1144, -1136, -1127, -1118, -1110, -1101, -1092, -1083, -1073, -1064, -1055,
+		-1045, -1036, -1026, -1017, -1007,  -997,  -987,  -977,  -967,  -957,  -947,  -937,
+		 -927,  -916,  -906,  -895,  -885,  -874,  -864,  -853,  -842,  -831,  -820,  -809,
+		 -798,  -787,  -776,  -764,  -753,  -742,  -730,  -719,  -707,  -695,  -684,  -672,
+		 -660,  -649,  -637,  -625,  -613,  -601,  -589,  -577,  -564,  -552,  -540,  -528,
+		 -515,  -503,  -491,  -478,  -466,  -453,  -441,  -428,  -415,  -403,  -390,  -377,
+		 -365,  -352,  -339,  -326,  -313,  -301,  -288,  -275,  -262,  -249,  -236,  -223,
+		 -210,  -197,  -184,  -171,  -158,  -145,  -131,  -118,  -105,   -92,   -79,   -66,
+		  -53,   -39,   -26,   -13,     0,
+	},
+	// Piano level 8
+	{
+		    0,     7,    14,    22,    29,    36,    43,    50,    57,    65,    72,    79,
+		   86,    93,   100,   108,   115,   122,   129,   136,   143,   150,   157,   165,
+		  172,   179,   186,   193,   200,   207,   214,   221,   228,   235,   242,   249,
+		  256,   263,   270,   277,   284,   291,   298,   305,   312,   319,   326,   333,
+		  340,   346,   353,   360,   367,   374,   381,   387,   394,   401,   408,   414,
+		  421,   428,   434,   441,   448,   454,   461,   467,   474,   481,   487,   494,
+		  500,   507,   513,   519,   526,   532,   539,   545,   551,   558,   564,   570,
+		  577,   583,   589,   595,   601,   607,   614,   620,   626,   632,   638,   644,
+		  650,   656,   662,   668,   674,   679,   685,   691,   697,   703,   708,   714,
+		  720,   725,   731,   736,   742,   748,   753,   759,   764,   769,   775,   780,
+		  786,   791,   796,   801,   807,   812,   817,   822,   827,   832,   837,   842,
+		  847,   852,   857,   862,   867,   872,   876,   881,   886,   890,   895,   900,
+		  904,   909,   913,   918,   922,   927,   931,   935,   940,   944,   948,   952,
+		  956,   960,   965,   969,   973,   977,   980,   984,   988,   992,   996,  1000,
+		 1003,  1007,  1011,  1014,  1018,  1021,  1025,  1028,  1032,  1035,  1038,  1042,
+		 1045,  1048,  1051,  1054,  1057,  1060,  1063,  1066,  1069,  1072,  1075,  1078,
+		 1081,  1083,  1086,  1089,  1091,  1094,  1096,  1099,  1101,  1104,  1106,  1108,
+		 1111,  1113,  1115,  1117,  1119,  1121,  1123,  1125,  1127,  1129,  1131,  1133,
+		 1135,  1136,  1138,  1140,  1141,  1143,  1144,  1146,  1147,  1149,  1150,  1151,
+		 1152,  1154,  1155,  1156,  1157,  1158,  1159,  1160,  1161,  1162,  1163,  1163,
+		 1164,  1165,  1165,  1166,  1167,  1167,  1168,  1168,  1168,  1169,  1169,  1169,
+		 1169,  1170,  1170,  1170,  1170,  1170,  1170,  1170,  1169,  1169,  1169,  1169,
+		 1168,  1168,  1168,  1167,  1167,  1166,  1165,  1165,  1164,  1163,  1163,  1162,
+		 1161,  1160,  1159,  1158,  1157,  1156,  1155,  1154,  1152,  1151,  1150,  1149,
+		 1147,  1146,  1144,  1143,  1141,  1140,  1138,  1136,  1135,  1133,  1131,  1129,
+		 1127,  1125,  1123,  1121,  1119,  1117,  1115,  1113,  1111,  1108,  1106,  1104,
+		 1101,  1099,  1096,  1094,  1091,  1089,  1086,  1083,  1081,  1078,  1075,  1072,
+		 1069,  1066,  1063,  1060,  1057,  1054,  1051,  1048,  1045,  1042,  1038,  1035,
+		 1032,  1028,  1025,  1021,  1018,  1014,  1011,  1007,  1003,  1000,   996,   992,
+		  988,   984,   980,   977,   973,   969,   965,   960,   956,   952,   948,   944,
+		  940,   935,   931,   927,   922,   918,   913,   909,   904,   900,   895,   890,
+		  886,   881,   876,   872,   867,   862,   857,   852,   847,   842,   837,   832,
+		  827,   822,   817,   812,   807,   801,   796,   791,   786,   780,   775,   769,
+		  764,   759,   753,   748,   742,   736,   731,   725,   720,   714,   708,   703,
+		  697,   691,   685,   679,   674,   668,   662,   656,   650,   644,   638,   632,
+		  626,   620,   614,   607,   601,   595,   589,   583,   577,   570,   564,   558,
+		  551,   545,   539,   532,   526,   519,   513,   507,   500,   494,   487,   481,
+		  474,   467,   461,   454,   448,   441,   434,   428,   421,   414,   408,   401,
+		  394,   387,   381,   374,   367,   360,   353,   346,   340,   333,   326,   319,
+		  312,   305,   298,   291,   284,   277,   270,   263,   256,   249,   242,   235,
+		  228,   221,   214,   207,   200,   193,   186,   179,   172,   165,   157,   150,
+		  143,   136,   129,   122,   115,   108,   100,    93,    86,    79,    72,    65,
+		   57,    50,    43,    36,    29,    22,    14,     7,     0,    -7,   -14,   -22,
+		  -29,   -36,   -43,   -50,   -57,   -65,   -72,   -79,   -86,   -93,  -100,  -108,
+		 -115,  -122,  -129,  -136,  -143,  -150,  -157,  -165,  -172,  -179,  -186,  -193,
+		 -200,  -207,  -214,  -221,  -228,  -235,  -242,  -249,  -256,  -263,  -270,  -277,
+		 -284,  -291,  -298,  -305,  -312,  -319,  -326,  -333,  -340,  -346,  -353,  -360,
+		 -367,  -374,  -381,  -387,  -394,  -401,  -408,  -414,  -421,  -428,  -434,  -441,
+		 -448,  -454,  -461,  -467,  -474,  -481,  -487,  -494,  -500,  -507,  -513,  -519,
+		 -526,  -532,  -539,  -545,  -551,  -558,  -564,  -570,  -577,  -583,  -589,  -595,
+		 -601,  -607,  -614,  -620,  -626,  -632,  -638,  -644,  -650,  -656,  -662,  -668,
+		 -674,  -679,  -685,  -691,  -697,  -703,  -708,  -714,  -720,  -725,  -731,  -736,
+		 -742,  -748,  -753,  -759,  -764,  -769,  -775,  -780,  -786,  -791,  -796,  -801,
+		 -807,  -812,  -817,  -822,  -827,  -832,  -837,  -842,  -847,  -852,  -857,  -862,
+		 -867,  -872,  -876,  -881,  -886,  -890,  -895,  -900,  -904,  -909,  -913,  -918,
+		 -922,  -927,  -931,  -935,  -940,  -944,  -948,  -952,  -956,  -960,  -965,  -969,
+		 -973,  -977,  -980,  -984,  -988,  -992,  -996, -1000, -1003, -1007, -1011, -1014,
+		-1018, -1021, -1025, -1028, -1032, -1035, -1038, -1042, -1045, -1048, -1051, -1054,
+		-1057, -1060, -1063, -1066, -1069, -1072, -1075, -1078, -1081, -1083, -1086, -1089,
+		-1091, -1094, -1096, -1099, -1101, -1104, -1106, -1108, -1111, -1113, -1115, -1117,
+		-1119, -1121, -1123, -1125, -1127, -1129, -1131, -1133, -1135, -1136, -1138, -1140,
+		-1141, -1143, -1144, -1146, -1147, -1149, -1150, -1151, -1152, -1154, -1155, -1156,
+		-1157, -1158, -1159, -1160, -1161, -1162, -1163, -1163, -1164, -1165, -1165, -1166,
+		-1167, -1167, -1168, -1168, -1168, -1169, -1169, -1169, -1169, -1170, -1170, -1170,
+		-1170, -1170, -1170, -1170, -1169, -1169, -1169, -1169, -1168, -1168, -1168, -1167,
+		-1167, -1166, -1165, -1165, -1164, -1163, -1163, -1162, -1161, -1160, -1159, -1158,
+		-1157, -1156, -1155, -1154, -1152, -1151, -1150, -1149, -1147, -1146, -1144, -1143,
+		-1141, -1140, -1138, -1136, -1135, -1133, -1131, -1129, -1127, -1125, -1123, -1121,
+		-1119, -1117, -1115, -1113, -1111, -1108, -1106, -1104, -1101, -1099, -1096, -1094,
+		-1091, -1089, -1086, -1083, -1081, -1078, -1075, -1072, -1069, -1066, -1063, -1060,
+		-1057, -1054, -1051, -1048, -1045, -1042, -1038, -1035, -1032, -1028, -1025, -1021,
+		-1018, -1014, -1011, -1007, -1003, -1000,  -996,  -992,  -988,  -984,  -980,  -977,
+		 -973,  -969,  -965,  -960,  -956,  -952,  -948,  -944,  -940,  -935,  -931,  -927,
+		 -922,  -918,  -913,  -909,  -904,  -900,  -895,  -890,  -886,  -881,  -876,  -872,
+		 -867,  -862,  -857,  -852,  -847,  -842,  -837,  -832,  -827,  -822,  -817,  -812,
+		 -807,  -801,  -796,  -791,  -786,  -780,  -775,  -769,  -764,  -759,  -753,  -748,
+		 -742,  -736,  -731,  -725,  -720,  -714,  -708,  -703,  -697,  -691,  -685,  -679,
+		 -674,  -668,  -662,  -656,  -650,  -644,  -638,  -632,  -626,  -620,  -614,  -607,
+		 -601,  -595,  -589,  -583,  -577,  -570,  -564,  -558,  -551,  -545,  -539,  -532,
+		 -526,  -519,  -513,  -507,  -500,  -494,  -487,  -481,  -474,  -467,  -461,  -454,
+		 -448,  -441,  -434,  -428,  -421,  -414,  -408,  -401,  -394,  -387,  -381,  -374,
+		 -367,  -360,  -353,  -346,  -340,  -333,  -326,  -319,  -312,  -305,  -298,  -291,
+		 -284,  -277,  -270,  -263,  -256,  -249,  -242,  -235,  -228,  -221,  -214,  -207,
+		 -200,  -193,  -186,  -179,  -172,  -165,  -157,  -150,  -143,  -136,  -129,  -122,
+		 -115,  -108,  -100,   -93,   -86,   -79,   -72,   -65,   -57,   -50,   -43,   -36,
+		  -29,   -22,   -14,    -7,     0,
+	},
+	// Bright level 8
+	{
+		    0,     7,    14,    20,    27,    34,    41,    48,    55,    61,    68,    75,
+		   82,    89,    95,   102,   109,   116,   122,   129,   136,   143,   150,   156,
+		  163,   170,   177,   183,   190,   197,   203,   210,   217,   223,   230,   237,
+		  243,   250,   257,   263,   270,   277,   283,   290,   296,   303,   309,   316,
+		  323,   329,   336,   342,   349,   355,   361,   368,   374,   381,   387,   394,
+		  400,   406,   413,   419,   425,   432,   438,   444,   450,   457,   463,   469,
+		  475,   481,   487,   494,   500,   506,   512,   518,   524,   530,   536,   542,
+		  548,   554,   560,   565,   571,   577,   583,   589,   595,   600,   606,   612,
+		  617,   623,   629,   634,   640,   645,   651,   656,   662,   667,   673,   678,
+		  684,   689,   694,   700,   705,   710,   715,   721,   726,   731,   736,   741,
+		  746,   751,   756,   761,   766,   771,   776,   781,   786,   791,   795,   800,
+		  805,   809,   814,   819,   823,   828,   832,   837,   841,   846,   850,   855,
+		  859,   863,   868,   872,   876,   880,   884,   888,   893,   897,   901,   905,
+		  909,   912,   916,   920,   924,   928,   931,   935,   939,   942,   946,   950,
+		  953,   957,   960,   963,   967,   970,   974,   977,   980,   983,   986,   989,
+		  993,   996,   999,  1002,  1005,  1007,  1010,  1013,  1016,  1019,  1021,  1024,
+		 1027,  1029,  1032,  1034,  1037,  1039,  1042,  1044,  1046,  1049,  1051,  1053,
+		 1055,  1057,  1059,  1061,  1063,  1065,  1067,  1069,  1071,  1073,  1075,  1076,
+		 1078,  1080,  1081,  1083,  1084,  1086,  1087,  1089,  1090,  1091,  1092,  1094,
+		 1095,  1096,  1097,  1098,  1099,  1100,  1101,  1102,  1103,  1104,  1104,  1105,
+		 1106,  1107,  1107,  1108,  1108,  1109,  1109,  1110,  1110,  1110,  1110,  1111,
+		 1111,  1111,  1111,  1111,  1111,  1111,  1111,  1111,  1111,  1111,  1110,  1110,
+		 1110,  1110,  1109,  1109,  1108,  1108,  1107,  1107,  1106,  1105,  1104,  1104,
+		 1103,  1102,  1101,  1100,  1099,  1098,  1097,  1096,  1095,  1094,  1092,  1091,
+		 1090,  1089,  1087,  1086,  1084,  1083,  1081,  1080,  1078,  1076,  1075,  1073,
+		 1071,  1069,  1067,  1065,  1063,  1061,  1059,  1057,  1055,  1053,  1051,  1049,
+		 1046,  1044,  1042,  1039,  1037,  1034,  1032,  1029,  1027,  1024,  1021,  1019,
+		 1016,  1013,  1010,  1007,  1005,  1002,   999,   996,   993,   989,   986,   983,
+		  980,   977,   974,   970,   967,   963,   960,   957,   953,   950,   946,   942,
+		  939,   935,   931,   928,   924,   920,   916,   912,   909,   905,   901,   897,
+		  893,   888,   884,   880,   876,   872,   868,   863,   859,   855,   850,   846,
+		  841,   837,   832,   828,   823,   819,   814,   809,   805,   800,   795,   791,
+		  786,   781,   776,   771,   766,   761,   756,   751,   746,   741,   736,   731,
+		  726,   721,   715,   710,   705,   700,   694,   689,   684,   678,   673,   667,
+		  662,   656,   651,   645,   640,   634,   629,   623,   617,   612,   606,   600,
+		  595,   589,   583,   577,   571,   565,   560,   554,   548,   542,   536,   530,
+		  524,   518,   512,   506,   500,   494,   487,   481,   475,   469,   463,   457,
+		  450,   444,   438,   432,   425,   419,   413,   406,   400,   394,   387,   381,
+		  374,   368,   361,   355,   349,   342,   336,   329,   323,   316,   309,   303,
+		  296,   290,   283,   277,   270,   263,   257,   250,   243,   237,   230,   223,
+		  217,   210,   203,   197,   190,   183,   177,   170,   163,   156,   150,   143,
+		  136,   129,   122,   116,   109,   102,    95,    89,    82,    75,    68,    61,
+		   55,    48,    41,    34,    27,    20,    14,     7,     0,    -7,   -14,   -20,
+		  -27,   -34,   -41,   -48,   -55,   -61,   -68,   -75,   -82,   -89,   -95,  -102,
+		 -109,  -116,  -122,  -129,  -136,  -143,  -150,  -156,  -163,  -170,  -177,  -183,
+		 -190,  -197,  -203,  -210,  -217,  -223,  -230,  -237,  -243,  -250,  -257,  -263,
+		 -270,  -277,  -283,  -290,  -296,  -303,  -309,  -316,  -323,  -329,  -336,  -342,
+		 -349,  -355,  -361,  -368,  -374,  -381,  -387,  -394,  -400,  -406,  -413,  -419,
+		 -425,  -432,  -438,  -444,  -450,  -457,  -463,  -469,  -475,  -481,  -487,  -494,
+		 -500,  -506,  -512,  -518,  -524,  -530,  -536,  -542,  -548,  -554,  -560,  -565,
+		 -571,  -577,  -583,  -589,  -595,  -600,  -606,  -612,  -617,  -623,  -629,  -634,
+		 -640,  -645,  -651,  -656,  -662,  -667,  -673,  -678,  -684,  -689,  -694,  -700,
+		 -705,  -710,  -715,  -721,  -726,  -731,  -736,  -741,  -746,  -751,  -756,  -761,
+		 -766,  -771,  -776,  -781,  -786,  -791,  -795,  -800,  -805,  -809,  -814,  -819,
+		 -823,  -828,  -832,  -837,  -841,  -846,  -850,  -855,  -859,  -863,  -868,  -872,
+		 -876,  -880,  -884,  -888,  -893,  -897,  -901,  -905,  -909,  -912,  -916,  -920,
+		 -924,  -928,  -931,  -935,  -939,  -942,  -946,  -950,  -953,  -957,  -960,  -963,
+		 -967,  -970,  -974,  -977,  -980,  -983,  -986,  -989,  -993,  -996,  -999, -1002,
+		-1005, -1007, -1010, -1013, -1016, -1019, -1021, -1024, -1027, -1029, -1032, -1034,
+		-1037, -1039, -1042, -1044, -1046, -1049, -1051, -1053, -1055, -1057, -1059, -1061,
+		-1063, -1065, -1067, -1069, -1071, -1073, -1075, -1076, -1078, -1080, -1081, -1083,
+		-1084, -1086, -1087, -1089, -1090, -1091, -1092, -1094, -1095, -1096, -1097, -1098,
+		-1099, -1100, -1101, -1102, -1103, -1104, -1104, -1105, -1106, -1107, -1107, -1108,
+		-1108, -1109, -1109, -1110, -1110, -1110, -1110, -1111, -1111, -1111, -1111, -1111,
+		-1111, -1111, -1111, -1111, -1111, -1111, -1110, -1110, -1110, -1110, -1109, -1109,
+		-1108, -1108, -1107, -1107, -1106, -1105, -1104, -1104, -1103, -1102, -1101, -1100,
+		-1099, -1098, -1097, -1096, -1095, -1094, -1092, -1091, -1090, -1089, -1087, -1086,
+		-1084, -1083, -1081, -1080, -1078, -1076, -1075, -1073, -1071, -1069, -1067, -1065,
+		-1063, -1061, -1059, -1057, -1055, -1053, -1051, -1049, -1046, -1044, -1042, -1039,
+		-1037, -1034, -1032, -1029, -1027, -1024, -1021, -1019, -1016, -1013, -1010, -1007,
+		-1005, -1002,  -999,  -996,  -993,  -989,  -986,  -983,  -980,  -977,  -974,  -970,
+		 -967,  -963,  -960,  -957,  -953,  -950,  -946,  -942,  -939,  -935,  -931,  -928,
+		 -924,  -920,  -916,  -912,  -909,  -905,  -901,  -897,  -893,  -888,  -884,  -880,
+		 -876,  -872,  -868,  -863,  -859,  -855,  -850,  -846,  -841,  -837,  -832,  -828,
+		 -823,  -819,  -814,  -809,  -805,  -800,  -795,  -791,  -786,  -781,  -776,  -771,
+		 -766,  -761,  -756,  -751,  -746,  -741,  -736,  -731,  -726,  -721,  -715,  -710,
+		 -705,  -700,  -694,  -689,  -684,  -678,  -673,  -667,  -662,  -656,  -651,  -645,
+		 -640,  -634,  -629,  -623,  -617,  -612,  -606,  -600,  -595,  -589,  -583,  -577,
+		 -571,  -565,  -560,  -554,  -548,  -542,  -536,  -530,  -524,  -518,  -512,  -506,
+		 -500,  -494,  -487,  -481,  -475,  -469,  -463,  -457,  -450,  -444,  -438,  -432,
+		 -425,  -419,  -413,  -406,  -400,  -394,  -387,  -381,  -374,  -368,  -361,  -355,
+		 -349,  -342,  -336,  -329,  -323,  -316,  -309,  -303,  -296,  -290,  -283,  -277,
+		 -270,  -263,  -257,  -250,  -243,  -237,  -230,  -223,  -217,  -210,  -203,  -197,
+		 -190,  -183,  -177,  -170,  -163,  -156,  -150,  -143,  -136,  -129,  -122,  -116,
+		 -109,  -102,   -95,   -89,   -82,   -75,   -68,   -61,   -55,   -48,   -41,   -34,
+		  -27,   -20,   -14,    -7,     0,
+	},
+	// Electric level 8
+	{
+		    0,     8,    17,    25,    33,    42,    50,    59,    67,    75,    84,    92,
+		  100,   109,   117,   125,   134,   142,   150,   159,   167,   175,   184,   192,
+		  200,   209,   217,   225,   233,   242,   250,   258,   266,   274,   283,   291,
+		  299,   307,   315,   323,   332,   340,   348,   356,   364,   372,   380,   388,
+		  396,   404,   412,   420,   428,   436,   444,   452,   460,   468,   475,   483,
+		  491,   499,   507,   514,   522,   530,   538,   545,   553,   561,   568,   576,
+		  583,   591,   599,   606,   614,   621,   628,   636,   643,   651,   658,   665,
+		  673,   680,   687,   694,   702,   709,   716,   723,   730,   737,   744,   751,
+		  758,   765,   772,   779,   786,   793,   799,   806,   813,   820,   826,   833,
+		  840,   846,   853,   859,   866,   872,   879,   885,   891,   898,   904,   910,
+		  916,   923,   929,   935,   941,   947,   953,   959,   965,   971,   977,   983,
+		  988,   994,  1000,  1006,  1011,  1017,  1022,  1028,  1033,  1039,  1044,  1050,
+		 1055,  1060,  1065,  1071,  1076,  1081,  1086,  1091,  1096,  1101,  1106,  1111,
+		 1116,  1121,  1125,  1130,  1135,  1139,  1144,  1148,  1153,  1157,  1162,  1166,
+		 1171,  1175,  1179,  1183,  1187,  1191,  1196,  1200,  1204,  1207,  1211,  1215,
+		 1219,  1223,  1226,  1230,  1234,  1237,  1241,  1244,  1248,  1251,  1254,  1258,
+		 1261,  1264,  1267,  1270,  1273,  1276,  1279,  1282,  1285,  1288,  1290,  1293,
+		 1296,  1298,  1301,  1303,  1306,  1308,  1311,  1313,  1315,  1317,  1320,  1322,
+		 1324,  1326,  1328,  1330,  1332,  1333,  1335,  1337,  1338,  1340,  1342,  1343,
+		 1345,  1346,  1347,  1349,  1350,  1351,  1352,  1353,  1354,  1355,  1356,  1357,
+		 1358,  1359,  1360,  1360,  1361,  1362,  1362,  1363,  1363,  1363,  1364,  1364,
+		 1364,  1364,  1365,  1365,  1365,  1365,  1365,  1364,  1364,  1364,  1364,  1363,
+		 1363,  1363,  1362,  1362,  1361,  1360,  1360,  1359,  1358,  1357,  1356,  1355,
+		 1354,  1353,  1352,  1351,  1350,  1349,  1347,  1346,  1345,  1343,  1342,  1340,
+		 1338,  1337,  1335,  1333,  1332,  1330,  1328,  1326,  1324,  1322,  1320,  1317,
+		 1315,  1313,  1311,  1308,  1306,  1303,  1301,  1298,  1296,  1293,  1290,  1288,
+		 1285,  1282,  1279,  1276,  1273,  1270,  1267,  1264,  1261,  1258,  1254,  1251,
+		 1248,  1244,  1241,  1237,  1234,  1230,  1226,  1223,  1219,  1215,  1211,  1207,
+		 1204,  1200,  1196,  1191,  1187,  1183,  1179,  1175,  1171,  1166,  1162,  1157,
+		 1153,  1148,  1144,  1139,  1135,  1130,  1125,  1121,  1116,  1111,  1106,  1101,
+		 1096,  1091,  1086,  1081,  1076,  1071,  1065,  1060,  1055,  1050,  1044,  1039,
+		 1033,  1028,  1022,  1017,  1011,  1006,  1000,   994,   988,   983,   977,   971,
+		  965,   959,   953,   947,   941,   935,   929,   923,   916,   910,   904,   898,
+		  891,   885,   879,   872,   866,   859,   853,   846,   840,   833,   826,   820,
+		  813,   806,   799,   793,   786,   779,   772,   765,   758,   751,   744,   737,
+		  730,   723,   716,   709,   702,   694,   687,   680,   673,   665,   658,   651,
+		  643,   636,   628,   621,   614,   606,   599,   591,   583,   576,   568,   561,
+		  553,   545,   538,   530,   522,   514,   507,   499,   491,   483,   475,   468,
+		  460,   452,   444,   436,   428,   420,   412,   404,   396,   388,   380,   372,
+		  364,   356,   348,   340,   332,   323,   315,   307,   299,   291,   283,   274,
+		  266,   258,   250,   242,   233,   225,   217,   209,   200,   192,   184,   175,
+		  167,   159,   150,   142,   134,   125,   117,   109,   100,    92,    84,    75,
+		   67,    59,    50,    42,    33,    25,    17,     8,     0,    -8,   -17,   -25,
+		  -33,   -42,   -50,   -59,   -67,   -75,   -84,   -92,  -100,  -109,  -117,  -125,
+		 -134,  -142,  -150,  -159,  -167,  -175,  -184,  -192,  -200,  -209,  -217,  -225,
+		 -233,  -242,  -250,  -258,  -266,  -274,  -283,  -291,  -299,  -307,  -315,  -323,
+		 -332,  -340,  -348,  -356,  -364,  -372,  -380,  -388,  -396,  -404,  -412,  -420,
+		 -428,  -436,  -444,  -452,  -460,  -468,  -475,  -483,  -491,  -499,  -507,  -514,
+		 -522,  -530,  -538,  -545,  -553,  -561,  -568,  -576,  -583,  -591,  -599,  -606,
+		 -614,  -621,  -628,  -636,  -643,  -651,  -658,  -665,  -673,  -680,  -687,  -694,
+		 -702,  -709,  -716,  -723,  -730,  -737,  -744,  -751,  -758,  -765,  -772,  -779,
+		 -786,  -793,  -799,  -806,  -813,  -820,  -826,  -833,  -840,  -846,  -853,  -859,
+		 -866,  -872,  -879,  -885,  -891,  -898,  -904,  -910,  -916,  -923,  -929,  -935,
+		 -941,  -947,  -953,  -959,  -965,  -971,  -977,  -983,  -988,  -994, -1000, -1006,
+		-1011, -1017, -1022, -1028, -1033, -1039, -1044, -1050, -1055, -1060, -1065, -1071,
+		-1076, -1081, -1086, -1091, -1096, -1101, -1106, -1111, -1116, -1121, -1125, -1130,
+		-1135, -1139, -1144, -1148, -1153, -1157, -1162, -1166, -1171, -1175, -1179, -1183,
+		-1187, -1191, -1196, -1200, -1204, -1207, -1211, -1215, -1219, -1223, -1226, -1230,
+		-1234, -1237, -1241, -1244, -1248, -1251, -1254, -1258, -1261, -1264, -1267, -1270,
+		-1273, -1276, -1279, -1282, -1285, -1288, -1290, -1293, -1296, -1298, -1301, -1303,
+		-1306, -1308, -1311, -1313, -1315, -1317, -1320, -1322, -1324, -1326, -1328, -1330,
+		-1332, -1333, -1335, -1337, -1338, -1340, -1342, -1343, -1345, -1346, -1347, -1349,
+		-1350, -1351, -1352, -1353, -1354, -1355, -1356, -1357, -1358, -1359, -1360, -1360,
+		-1361, -1362, -1362, -1363, -1363, -1363, -1364, -1364, -1364, -1364, -1365, -1365,
+		-1365, -1365, -1365, -1364, -1364, -1364, -1364, -1363, -1363, -1363, -1362, -1362,
+		-1361, -1360, -1360, -1359, -1358, -1357, -1356, -1355, -1354, -1353, -1352, -1351,
+		-1350, -1349, -1347, -1346, -1345, -1343, -1342, -1340, -1338, -1337, -1335, -1333,
+		-1332, -1330, -1328, -1326, -1324, -1322, -1320, -1317, -1315, -1313, -1311, -1308,
+		-1306, -1303, -1301, -1298, -1296, -1293, -1290, -1288, -1285, -1282, -1279, -1276,
+		-1273, -1270, -1267, -1264, -1261, -1258, -1254, -1251, -1248, -1244, -1241, -1237,
+		-1234, -1230, -1226, -1223, -1219, -1215, -1211, -1207, -1204, -1200, -1196, -1191,
+		-1187, -1183, -1179, -1175, -1171, -1166, -1162, -1157, -1153, -1148, -1144, -1139,
+		-1135, -1130, -1125, -1121, -1116, -1111, -1106, -1101, -1096, -1091, -1086, -1081,
+		-1076, -1071, -1065, -1060, -1055, -1050, -1044, -1039, -1033, -1028, -1022, -1017,
+		-1011, -1006, -1000,  -994,  -988,  -983,  -977,  -971,  -965,  -959,  -953,  -947,
+		 -941,  -935,  -929,  -923,  -916,  -910,  -904,  -898,  -891,  -885,  -879,  -872,
+		 -866,  -859,  -853,  -846,  -840,  -833,  -826,  -820,  -813,  -806,  -799,  -793,
+		 -786,  -779,  -772,  -765,  -758,  -751,  -744,  -737,  -730,  -723,  -716,  -709,
+		 -702,  -694,  -687,  -680,  -673,  -665,  -658,  -651,  -643,  -636,  -628,  -621,
+		 -614,  -606,  -599,  -591,  -583,  -576,  -568,  -561,  -553,  -545,  -538,  -530,
+		 -522,  -514,  -507,  -499,  -491,  -483,  -475,  -468,  -460,  -452,  -444,  -436,
+		 -428,  -420,  -412,  -404,  -396,  -388,  -380,  -372,  -364,  -356,  -348,  -340,
+		 -332,  -323,  -315,  -307,  -299,  -291,  -283,  -274,  -266,  -258,  -250,  -242,
+		 -233,  -225,  -217,  -209,  -200,  -192,  -184,  -175,  -167,  -159,  -150,  -142,
+		 -134,  -125,  -117,  -109,  -100,   -92,   -84,   -75,   -67,   -59,   -50,   -42,
+		  -33,   -25,   -17,    -8,     0,
+	},
+#endif
+};
+
+FASTDATA const int16_t *const wavetables[NUM_MODES][MIPMAP_LEVELS] = {
+#if MAX_NOTES <= 48
+	{wavetable_data[0], wavetable_data[0], wavetable_data[0], wavetable_data[0], wavetable_data[0]}, // Piano
+	{wavetable_data[1], wavetable_data[1], wavetable_data[1], wavetable_data[1], wavetable_data[1]}, // Alt Sax
+	{wavetable_data[2], wavetable_data[2], wavetable_data[2], wavetable_data[2], wavetable_data[2]}, // Bright
+	{wavetable_data[3], wavetable_data[3], wavetable_data[3], wavetable_data[3], wavetable_data[3]}, // Electric
+#elif MAX_NOTES <= 96
+	{wavetable_data[0], wavetable_data[0], wavetable_data[0], wavetable_data[0], wavetable_data[0], wavetable_data[0], wavetable_data[0], wavetable_data[4], wavetable_data[7]}, // Piano
+	{wavetable_data[1], wavetable_data[1], wavetable_data[1], wavetable_data[1], wavetable_data[1], wavetable_data[1], wavetable_data[1], wavetable_data[1], wavetable_data[1]}, // Alt Sax
+	{wavetable_data[2], wavetable_data[2], wavetable_data[2], wavetable_data[2], wavetable_data[2], wavetable_data[2], wavetable_data[2], wavetable_data[5], wavetable_data[8]}, // Bright
+	{wavetable_data[3], wavetable_data[3], wavetable_data[3], wavetable_data[3], wavetable_data[3], wavetable_data[3], wavetable_data[3], wavetable_data[6], wavetable_data[9]}, // Electric
+#endif
+};
+#elif WAVETABLE_BITS == 11
+FASTDATA static const int16_t wavetable_data[][WAVETABLE_SIZE + 1] = {
+	// Piano level 0,1,2,3,4,5,6
+	{
+		    0,    13,    26,    39,    52,    65,    78,    91,   104,   117,   131,   144,
+		  157,   169,   182,   195,   208,   221,   234,   247,   260,   273,   285,   298,
+		  311,   323,   336,   349,   361,   374,   386,   399,   411,   424,   436,   448,
+		  461,   473,   485,   497,   509,   521,   533,   545,   557,   569,   581,   592,
+		  604,   616,   627,   639,   650,   661,   673,   684,   695,   706,   717,   728,
+		  739,   750,   760,   771,   782,   792,   803,   813,   823,   833,   844,   854,
+		  864,   873,   883,   893,   903,   912,   921,   931,   940,   949,   958,   967,
+		  976,   985,   994,  1002,  1011,  1019,  1028,  1036,  1044,  1052,  1060,  1068,
+		 1076,  1084,  1091,  1099,  1106,  1113,  1120,  1127,  1134,  1141,  1148,  1155,
+		 1161,  1168,  1174,  1180,  1186,  1192,  1198,  1204,  1210,  1215,  1221,  1226,
+		 1231,  1237,  1242,  1247,  1251,  1256,  1261,  1265,  1270,  1274,  1278,  1282,
+		 1286,  1290,  1294,  1297,  1301,  1304,  1307,  1311,  1314,  1317,  1320,  1322,
+		 1325,  1327,  1330,  1332,  1334,  1336,  1338,  1340,  1342,  1344,  1345,  1347,
+		 1348,  1349,  1350,  1352,  1352,  1353,  1354,  1355,  1355,  1355,  1356,  1356,
+		 1356,  1356,  1356,  1356,  1355,  1355,  1355,  1354,  1353,  1352,  1352,  1351,
+		 1349,  1348,  1347,  1346,  1344,  1343,  1341,  1339,  1337,  1336,  1334,  1331,
+		 1329,  1327,  1325,  1322,  1320,  1317,  1315,  1312,  1309,  1306,  1303,  1300,
+		 1297,  1294,  1290,  1287,  1284,  1280,  1276,  1273,  1269,  1265,  1261,  1257,
+		 1254,  1249,  1245,  1241,  1237,  1233,  1228,  1224,  1219,  1215,  1210,  1206,
+		 1201,  1196,  1192,  1187,  1182,  1177,  1172,  1167,  1162,  1157,  1152,  1146,
+		 1141,  1136,  1131,  1125,  1120,  1115,  1109,  1104,  1098,  1093,  1087,  1082,
+		 1076,  1070,  1065,  1059,  1053,  1048,  1042,  1036,  1030,  1025,  1019,  1013,
+		 1007,  1001,   996,   990,   984,   978,   972,   966,   961,   955,   949,   943,
+		  937,   931,   925,   920,   914,   908,   902,   896,   891,   885,   879,   873,
+		  868,   862,   856,   851,   845,   839,   834,   828,   823,   817,   812,   806,
+		  801,   795,   790,   785,   779,   774,   769,   764,   759,   754,   748,   743,
+		  738,   733,   729,   724,   719,   714,   709,   705,   700,   696,   691,   687,
+		  682,   678,   674,   669,   665,   661,   657,   653,   649,   645,   641,   637,
+		  634,   630,   627,   623,   620,   616,   613,   610,   606,   603,   600,   597,
+		  594,   591,   589,   586,   583,   581,   578,   576,   574,   571,   569,   567,
+		  565,   563,   561,   559,   558,   556,   555,   553,   552,   550,   549,   548,
+		  547,   546,   545,   544,   543,   543,   542,   542,   541,   541,   541,   540,
+		  540,   540,   540,   540,   541,   541,   541,   542,   542,   543,   544,   545,
+		  545,   546,   547,   549,   550,   551,   552,   554,   555,   557,   559,   561,
+		  562,   564,   566,   569,   571,   573,   575,   578,   580,   583,   585,   588,
+		  591,   594,   597,   600,   603,   606,   609,   613,   616,   620,   623,   627,
+		  630,   634,   638,   642,   646,   650,   654,   658,   662,   667,   671,   676,
+		  680,   685,   689,   694,   699,   703,   708,   713,   718,   723,   728,   733,
+		  739,   744,   749,   754,   760,   765,   771,   776,   782,   788,   793,   799,
+		  805,   811,   816,   822,   828,   834,   840,   846,   852,   858,   865,   871,
+		  877,   883,   889,   896,   902,   908,   915,   921,   928,   934,   941,   947,
+		  954,   960,   967,   973,   980,   986,   993,  1000,  1006,  1013,  1020,  1026,
+		 1033,  1039,  1046,  1053,  1059,  1066,  1073,  1079,  1086,  1093,  1099,  1106,
+		 1113,  1119,  1126,  1133,  1139,  1146,  1152,  1159,  1166,  1172,  1179,  1185,
+		 1192,  1198,  1204,  1211,  1217,  1224,  1230,  1236,  1242,  1249,  1255,  1261,
+		 1267,  1273,  1279,  1285,  1291,  1297,  1303,  1309,  1315,  1321,  1326,  1332,
+		 1338,  1343,  1349,  1354,  1360,  1365,  1371,  1376,  1381,  1386,  1391,  1397,
+		 1402,  1407,  1411,  1416,  1421,  1426,  1430,  1435,  1440,  1444,  1448,  1453,
+		 1457,  1461,  1465,  1469,  1473,  1477,  1481,  1485,  1488,  1492,  1495,  1499,
+		 1502,  1506,  1509,  1512,  1515,  1518,  1521,  1524,  1526,  1529,  1532,  1534,
+		 1536,  1539,  1541,  1543,  1545,  1547,  1549,  1551,  1552,  1554,  1556,  1557,
+		 1558,  1560,  1561,  1562,  1563,  1564,  1564,  1565,  1566,  1566,  1566,  1567,
+		 1567,  1567,  1567,  1567,  1567,  1567,  1566,  1566,  1565,  1565,  1564,  1563,
+		 1562,  1561,  1560,  1559,  1557,  1556,  1554,  1553,  1551,  1549,  1547,  1545,
+		 1543,  1541,  1538,  1536,  1534,  1531,  1528,  1525,  1523,  1520,  1516,  1513,
+		 1510,  1507,  1503,  1500,  1496,  1492,  1488,  1484,  1480,  1476,  1472,  1468,
+		 1463,  1459,  1454,  1450,  1445,  1440,  1435,  1430,  1425,  1420,  1415,  1409,
+		 1404,  1398,  1393,  1387,  1381,  1375,  1369,  1363,  1357,  1351,  1345,  1338,
+		 1332,  1325,  1319,  1312,  1305,  1298,  1292,  1285,  1278,  1270,  1263,  1256,
+		 1249,  1241,  1234,  1226,  1219,  1211,  1203,  1196,  1188,  1180,  1172,  1164,
+		 1156,  1148,  1140,  1131,  1123,  1115,  1106,  1098,  1089,  1081,  1072,  1063,
+		 1055,  1046,  1037,  1028,  1019,  1011,  1002,   993,   984,   974,   965,   956,
+		  947,   938,   929,   919,   910,   901,   891,   882,   872,   863,   854,   844,
+		  835,   825,   815,   806,   796,   787,   777,   767,   758,   748,   738,   729,
+		  719,   709,   700,   690,   680,   671,   661,   651,   642,   632,   622,   612,
+		  603,   593,   583,   574,   564,   554,   545,   535,   526,   516,   506,   497,
+		  487,   478,   468,   459,   450,   440,   431,   421,   412,   403,   393,   384,
+		  375,   366,   357,   348,   339,   330,   321,   312,   303,   294,   285,   276,
+		  267,   259,   250,   241,   233,   224,   216,   208,   199,   191,   183,   174,
+		  166,   158,   150,   142,   134,   126,   119,   111,   103,    96,    88,    81,
+		   73,    66,    59,    51,    44,    37,    30,    23,    16,    10,     3,    -4,
+		  -10,   -17,   -23,   -30,   -36,   -42,   -48,   -54,   -60,   -66,   -72,   -78,
+		  -83,   -89,   -94,  -100,  -105,  -110,  -116,  -121,  -126,  -131,  -135,  -140,
+		 -145,  -149,  -154,  -158,  -163,  -167,  -171,  -175,  -179,  -183,  -187,  -190,
+		 -194,  -198,  -201,  -204,  -208,  -211,  -214,  -217,  -220,  -223,  -226,  -228,
+		 -231,  -233,  -236,  -238,  -240,  -242,  -244,  -246,  -248,  -250,  -252,  -253,
+		 -255,  -256,  -258,  -259,  -260,  -261,  -262,  -263,  -264,  -265,  -265,  -266,
+		 -266,  -267,  -267,  -267,  -268,  -268,  -268,  -268,  -267,  -267,  -267,  -267,
+		 -266,  -266,  -265,  -264,  -263,  -263,  -262,  -261,  -259,  -258,  -257,  -256,
+		 -254,  -253,  -251,  -250,  -248,  -246,  -245,  -243,  -241,  -239,  -237,  -235,
+		 -232,  -230,  -228,  -225,  -223,  -221,  -218,  -215,  -213,  -210,  -207,  -204,
+		 -201,  -198,  -195,  -192,  -189,  -186,  -183,  -180,  -176,  -173,  -170,  -166,
+		 -163,  -159,  -156,  -152,  -148,  -145,  -141,  -137,  -133,  -130,  -126,  -122,
+		 -118,  -114,  -110,  -106,  -102,   -98,   -94,   -90,   -86,   -82,   -77,   -73,
+		  -69,   -65,   -61,   -56,   -52,   -48,   -43,   -39,   -35,   -30,   -26,   -22,
+		  -17,   -13,    -9,    -4,     0,     4,     9,    13,    17,    22,    26,    30,
+		   35,    39,    43,    48,    52,    56,    61,    65,    69,    73,    77,    82,
+		   86,    90,    94,    98,   102,   106,   110,   114,   118,   122,   126,   130,
+		  133,   137,   141,   145,   148,   152,   156,   159,   163,   166,   170,   173,
+		  176,   180,   183,   186,   189,   192,   195,   198,   201,   204,   207,   210,
+		  213,   215,   218,   221,   223,   225,   228,   230,   232,   235,   237,   239,
+		  241,   243,   245,   246,   248,   250,   251,   253,   254,   256,   257,   258,
+		  259,   261,   262,   263,   263,   264,   265,   266,   266,   267,   267,   267,
+		  267,   268,   268,   268,   268,   267,   267,   267,   266,   266,   265,   265,
+		  264,   263,   262,   261,   260,   259,   258,   256,   255,   253,   252,   250,
+		  248,   246,   244,   242,   240,   238,   236,   233,   231,   228,   226,   223,
+		  220,   217,   214,   211,   208,   204,   201,   198,   194,   190,   187,   183,
+		  179,   175,   171,   167,   163,   158,   154,   149,   145,   140,   135,   131,
+		  126,   121,   116,   110,   105,   100,    94,    89,    83,    78,    72,    66,
+		   60,    54,    48,    42,    36,    30,    23,    17,    10,     4,    -3,   -10,
+		  -16,   -23,   -30,   -37,   -44,   -51,   -59,   -66,   -73,   -81,   -88,   -96,
+		 -103,  -111,  -119,  -126,  -134,  -142,  -150,  -158,  -166,  -174,  -183,  -191,
+		 -199,  -208,  -216,  -224,  -233,  -241,  -250,  -259,  -267,  -276,  -285,  -294,
+		 -303,  -312,  -321,  -330,  -339,  -348,  -357,  -366,  -375,  -384,  -393,  -403,
+		 -412,  -421,  -431,  -440,  -450,  -459,  -468,  -478,  -487,  -497,  -506,  -516,
+		 -526,  -535,  -545,  -554,  -564,  -574,  -583,  -593,  -603,  -612,  -622,  -632,
+		 -642,  -651,  -661,  -671,  -680,  -690,  -700,  -709,  -719,  -729,  -738,  -748,
+		 -758,  -767,  -777,  -787,  -796,  -806,  -815,  -825,  -835,  -844,  -854,  -863,
+		 -872,  -882,  -891,  -901,  -910,  -919,  -929,  -938,  -947,  -956,  -965,  -974,
+		 -984,  -993, -1002, -1011, -1019, -1028, -1037, -1046, -1055, -1063, -1072, -1081,
+		-1089, -1098, -1106, -1115, -1123, -1131, -1140, -1148, -1156, -1164, -1172, -1180,
+		-1188, -1196, -1203, -1211, -1219, -1226, -1234, -1241, -1249, -1256, -1263, -1270,
+		-1278, -1285, -1292, -1298, -1305, -1312, -1319, -1325, -1332, -1338, -1345, -1351,
+		-1357, -1363, -1369, -1375, -1381, -1387, -1393, -1398, -1404, -1409, -1415, -1420,
+		-1425, -1430, -1435, -1440, -1445, -1450, -1454, -1459, -1463, -1468, -1472, -1476,
+		-1480, -1484, -1488, -1492, -1496, -1500, -1503, -1507, -1510, -1513, -1516, -1520,
+		-1523, -1525, -1528, -1531, -1534, -1536, -1538, -1541, -1543, -1545, -1547, -1549,
+		-1551, -1553, -1554, -1556, -1557, -1559, -1560, -1561, -1562, -1563, -1564, -1565,
+		-1565, -1566, -1566, -1567, -1567, -1567, -1567, -1567, -1567, -1567, -1566, -1566,
+		-1566, -1565, -1564, -1564, -1563, -1562, -1561, -1560, -1558, -1557, -1556, -1554,
+		-1552, -1551, -1549, -1547, -1545, -1543, -1541, -1539, -1536, -1534, -1532, -1529,
+		-1526, -1524, -1521, -1518, -1515, -1512, -1509, -1506, -1502, -1499, -1495, -1492,
+		-1488, -1485, -1481, -1477, -1473, -1469, -1465, -1461, -1457, -1453, -1448, -1444,
+		-1440, -1435, -1430, -1426, -1421, -1416, -1411, -1407, -1402, -1397, -1391, -1386,
+		-1381, -1376, -1371, -1365, -1360, -1354, -1349, -1343, -1338, -1332, -1326, -1321,
+		-1315, -1309, -1303, -1297, -1291, -1285, -1279, -1273, -1267, -1261, -1255, -1249,
+		-1242, -1236, -1230, -1224, -1217, -1211, -1204, -1198, -1192, -1185, -1179, -1172,
+		-1166, -1159, -1152, -1146, -1139, -1133, -1126, -1119, -1113, -1106, -1099, -1093,
+		-1086, -1079, -1073, -1066, -1059, -1053, -1046, -1039, -1033, -1026, -1020, -1013,
+		-1006, -1000,  -993,  -986,  -980,  -973,  -967,  -960,  -954,  -947,  -941,  -934,
+		 -928,  -921,  -915,  -908,  -902,  -896,  -889,  -883,  -877,  -871,  -865,  -858,
+		 -852,  -846,  -840,  -834,  -828,  -822,  -816,  -811,  -805,  -799,  -793,  -788,
+		 -782,  -776,  -771,  -765,  -760,  -754,  -749,  -744,  -739,  -733,  -728,  -723,
+		 -718,  -713,  -708,  -703,  -699,  -694,  -689,  -685,  -680,  -676,  -671,  -667,
+		 -662,  -658,  -654,  -650,  -646,  -642,  -638,  -634,  -630,  -627,  -623,  -620,
+		 -616,  -613,  -609,  -606,  -603,  -600,  -597,  -594,  -591,  -588,  -585,  -583,
+		 -580,  -578,  -575,  -573,  -571,  -569,  -566,  -564,  -562,  -561,  -559,  -557,
+		 -555,  -554,  -552,  -551,  -550,  -549,  -547,  -546,  -545,  -545,  -544,  -543,
+		 -542,  -542,  -541,  -541,  -541,  -540,  -540,  -540,  -540,  -540,  -541,  -541,
+		 -541,  -542,  -542,  -543,  -543,  -544,  -545,  -546,  -547,  -548,  -549,  -550,
+		 -552,  -553,  -555,  -556,  -558,  -559,  -561,  -563,  -565,  -567,  -569,  -571,
+		 -574,  -576,  -578,  -581,  -583,  -586,  -589,  -591,  -594,  -597,  -600,  -603,
+		 -606,  -610,  -613,  -616,  -620,  -623,  -627,  -630,  -634,  -637,  -641,  -645,
+		 -649,  -653,  -657,  -661,  -665,  -669,  -674,  -678,  -682,  -687,  -691,  -696,
+		 -700,  -705,  -709,  -714,  -719,  -724,  -729,  -733,  -738,  -743,  -748,  -754,
+		 -759,  -764,  -769,  -774,  -779,  -785,  -790,  -795,  -801,  -806,  -812,  -817,
+		 -823,  -828,  -834,  -839,  -845,  -851,  -856,  -862,  -868,  -873,  -879,  -885,
+		 -891,  -896,  -902,  -908,  -914,  -920,  -925,  -931,  -937,  -943,  -949,  -955,
+		 -961,  -966,  -972,  -978,  -984,  -990,  -996, -1001, -1007, -1013, -1019, -1025,
+		-1030, -1036, -1042, -1048, -1053, -1059, -1065, -1070, -1076, -1082, -1087, -1093,
+		-1098, -1104, -1109, -1115, -1120, -1125, -1131, -1136, -1141, -1146, -1152, -1157,
+		-1162, -1167, -1172, -1177, -1182, -1187, -1192, -1196, -1201, -1206, -1210, -1215,
+		-1219, -1224, -1228, -1233, -1237, -1241, -1245, -1249, -1254, -1257, -1261, -1265,
+		-1269, -1273, -1276, -1280, -1284, -1287, -1290, -1294, -1297, -1300, -1303, -1306,
+		-1309, -1312, -1315, -1317, -1320, -1322, -1325, -1327, -1329, -1331, -1334, -1336,
+		-1337, -1339, -1341, -1343, -1344, -1346, -1347, -1348, -1349, -1351, -1352, -1352,
+		-1353, -1354, -1355, -1355, -1355, -1356, -1356, -1356, -1356, -1356, -1356, -1355,
+		-1355, -1355, -1354, -1353, -1352, -1352, -1350, -1349, -1348, -1347, -1345, -1344,
+		-1342, -1340, -1338, -1336, -1334, -1332, -1330, -1327, -1325, -1322, -1320, -1317,
+		-1314, -1311, -1307, -1304, -1301, -1297, -1294, -1290, -1286, -1282, -1278, -1274,
+		-1270, -1265, -1261, -1256, -1251, -1247, -1242, -1237, -1231, -1226, -1221, -1215,
+		-1210, -1204, -1198, -1192, -1186, -1180, -1174, -1168, -1161, -1155, -1148, -1141,
+		-1134, -1127, -1120, -1113, -1106, -1099, -1091, -1084, -1076, -1068, -1060, -1052,
+		-1044, -1036, -1028, -1019, -1011, -1002,  -994,  -985,  -976,  -967,  -958,  -949,
+		 -940,  -931,  -921,  -912,  -903,  -893,  -883,  -873,  -864,  -854,  -844,  -833,
+		 -823,  -813,  -803,  -792,  -782,  -771,  -760,  -750,  -739,  -728,  -717,  -706,
+		 -695,  -684,  -673,  -661,  -650,  -639,  -627,  -616,  -604,  -592,  -581,  -569,
+		 -557,  -545,  -533,  -521,  -509,  -497,  -485,  -473,  -461,  -448,  -436,  -424,
+		 -411,  -399,  -386,  -374,  -361,  -349,  -336,  -323,  -311,  -298,  -285,  -273,
+		 -260,  -247,  -234,  -221,  -208,  -195,  -182,  -169,  -157,  -144,  -131,  -117,
+		 -104,   -91,   -78,   -65,   -52,   -39,   -26,   -13,     0,
+	},
+	// Alt Sax level 0,1,2,3,4,5,6,7,8
+	{
+		    0,     6,    13,    19,    25,    31,    38,    44,    50,    57,    63,    69,
+		   75,    82,    88,    94,   100,   107,   113,   119,   126,   132,   138,   144,
+		  151,   157,   163,   169,   176,   182,   188,   194,   201,   207,   213,   219,
+		  226,   232,   238,   244,   251,   257,   263,   269,   275,   282,   288,   294,
+		  300,   307,   313,   319,   325,   331,   338,   344,   350,   356,   362,   369,
+		  375,   381,   387,   393,   399,   406,   412,   418,   424,   430,   436,   442,
+		  449,   455,   461,   467,   473,   479,   485,   491,   497,   503,   510,   516,
+		  522,   528,   534,   540,   546,   552,   558,   564,   570,   576,   582,   588,
+		  594,   600,   606,   612,   618,   624,   630,   636,   642,   648,   654,   660,
+		  666,   672,   678,   684,   690,   696,   701,   707,   713,   719,   725,   731,
+		  737,   743,   748,   754,   760,   766,   772,   778,   783,   789,   795,   801,
+		  807,   812,   818,   824,   830,   835,   841,   847,   852,   858,   864,   870,
+		  875,   881,   887,   892,   898,   903,   909,   915,   920,   926,   932,   937,
+		  943,   948,   954,   959,   965,   970,   976,   982,   987,   993,   998,  1003,
+		 1009,  1014,  1020,  1025,  1031,  1036,  1042,  1047,  1052,  1058,  1063,  1068,
+		 1074,  1079,  1085,  1090,  1095,  1100,  1106,  1111,  1116,  1122,  1127,  1132,
+		 1137,  1142,  1148,  1153,  1158,  1163,  1168,  1174,  1179,  1184,  1189,  1194,
+		 1199,  1204,  1209,  1214,  1219,  1224,  1229,  1234,  1239,  1244,  1249,  1254,
+		 1259,  1264,  1269,  1274,  1279,  1284,  1289,  1294,  1299,  1303,  1308,  1313,
+		 1318,  1323,  1328,  1332,  1337,  1342,  1347,  1351,  1356,  1361,  1365,  1370,
+		 1375,  1379,  1384,  1389,  1393,  1398,  1402,  1407,  1411,  1416,  1421,  1425,
+		 1430,  1434,  1439,  1443,  1447,  1452,  1456,  1461,  1465,  1469,  1474,  1478,
+		 1483,  1487,  1491,  1495,  1500,  1504,  1508,  1513,  1517,  1521,  1525,  1529,
+		 1533,  1538,  1542,  1546,  1550,  1554,  1558,  1562,  1566,  1570,  1574,  1578,
+		 1582,  1586,  1590,  1594,  1598,  1602,  1606,  1610,  1614,  1618,  1621,  1625,
+		 1629,  1633,  1637,  1640,  1644,  1648,  1652,  1655,  1659,  1663,  1666,  1670,
+		 1674,  1677,  1681,  1684,  1688,  1691,  1695,  1699,  1702,  1705,  1709,  1712,
+		 1716,  1719,  1723,  1726,  1729,  1733,  1736,  1739,  1743,  1746,  1749,  1753,
+		 1756,  1759,  1762,  1765,  1769,  1772,  1775,  1778,  1781,  1784,  1787,  1790,
+		 1793,  1796,  1799,  1802,  1805,  1808,  1811,  1814,  1817,  1820,  1823,  1826,
+		 1828,  1831,  1834,  1837,  1840,  1842,  1845,  1848,  1850,  1853,  1856,  1858,
+		 1861,  1864,  1866,  1869,  1871,  1874,  1876,  1879,  1881,  1884,  1886,  1889,
+		 1891,  1894,  1896,  1898,  1901,  1903,  1905,  1908,  1910,  1912,  1914,  1917,
+		 1919,  1921,  1923,  1925,  1927,  1929,  1932,  1934,  1936,  1938,  1940,  1942,
+		 1944,  1946,  1948,  1950,  1951,  1953,  1955,  1957,  1959,  1961,  1962,  1964,
+		 1966,  1968,  1969,  1971,  1973,  1975,  1976,  1978,  1979,  1981,  1983,  1984,
+		 1986,  1987,  1989,  1990,  1992,  1993,  1994,  1996,  1997,  1999,  2000,  2001,
+		 2003,  2004,  2005,  2006,  2008,  2009,  2010,  2011,  2012,  2014,  2015,  2016,
+		 2017,  2018,  2019,  2020,  2021,  2022,  2023,  2024,  2025,  2026,  2027,  2028,
+		 2028,  2029,  2030,  2031,  2032,  2032,  2033,  2034,  2035,  2035,  2036,  2037,
+		 2037,  2038,  2038,  2039,  2039,  2040,  2040,  2041,  2041,  2042,  2042,  2043,
+		 2043,  2044,  2044,  2044,  2045,  2045,  2045,  2045,  2046,  2046,  2046,  2046,
+		 2046,  2047,  2047,  2047,  2047,  2047,  2047,  2047,  2047,  2047,  2047,  2047,
+		 2047,  2047,  2047,  2047,  2046,  2046,  2046,  2046,  2046,  2045,  2045,  2045,
+		 2045,  2044,  2044,  2044,  2043,  2043,  2042,  2042,  2041,  2041,  2040,  2040,
+		 2039,  2039,  2038,  2038,  2037,  2037,  2036,  2035,  2035,  2034,  2033,  2032,
+		 2032,  2031,  2030,  2029,  2028,  2028,  2027,  2026,  2025,  2024,  2023,  2022,
+		 2021,  2020,  2019,  2018,  2017,  2016,  2015,  2014,  2012,  2011,  2010,  2009,
+		 2008,  2006,  2005,  2004,  2003,  2001,  2000,  1999,  1997,  1996,  1994,  1993,
+		 1992,  1990,  1989,  1987,  1986,  1984,  1983,  1981,  1979,  1978,  1976,  1975,
+		 1973,  1971,  1969,  1968,  1966,  1964,  1962,  1961,  1959,  1957,  1955,  1953,
+		 1951,  1950,  1948,  1946,  1944,  1942,  1940,  1938,  1936,  1934,  1932,  1929,
+		 1927,  1925,  1923,  1921,  1919,  1917,  1914,  1912,  1910,  1908,  1905,  1903,
+		 1901,  1898,  1896,  1894,  1891,  1889,  1886,  1884,  1881,  1879,  1876,  1874,
+		 1871,  1869,  1866,  1864,  1861,  1858,  1856,  1853,  1850,  1848,  1845,  1842,
+		 1840,  1837,  1834,  1831,  1828,  1826,  1823,  1820,  1817,  1814,  1811,  1808,
+		 1805,  1802,  1799,  1796,  1793,  1790,  1787,  1784,  1781,  1778,  1775,  1772,
+		 1769,  1765,  1762,  1759,  1756,  1753,  1749,  1746,  1743,  1739,  1736,  1733,
+		 1729,  1726,  1723,  1719,  1716,  1712,  1709,  1705,  1702,  1699,  1695,  1691,
+		 1688,  1684,  1681,  1677,  1674,  1670,  1666,  1663,  1659,  1655,  1652,  1648,
+		 1644,  1640,  1637,  1633,  1629,  1625,  1621,  1618,  1614,  1610,  1606,  1602,
+		 1598,  1594,  1590,  1586,  1582,  1578,  1574,  1570,  1566,  1562,  1558,  1554,
+		 1550,  1546,  1542,  1538,  1533,  1529,  1525,  1521,  1517,  1513,  1508,  1504,
+		 1500,  1495,  1491,  1487,  1483,  1478,  1474,  1469,  1465,  1461,  1456,  1452,
+		 1447,  1443,  1439,  1434,  1430,  1425,  1421,  1416,  1411,  1407,  1402,  1398,
+		 1393,  1389,  1384,  1379,  1375,  1370,  1365,  1361,  1356,  1351,  1347,  1342,
+		 1337,  1332,  1328,  1323,  1318,  1313,  1308,  1303,  1299,  1294,  1289,  1284,
+		 1279,  1274,  1269,  1264,  1259,  1254,  1249,  1244,  1239,  1234,  1229,  1224,
+		 1219,  1214,  1209,  1204,  1199,  1194,  1189,  1184,  1179,  1174,  1168,  1163,
+		 1158,  1153,  1148,  1142,  1137,  1132,  1127,  1122,  1116,  1111,  1106,  1100,
+		 1095,  1090,  1085,  1079,  1074,  1068,  1063,  1058,  1052,  1047,  1042,  1036,
+		 1031,  1025,  1020,  1014,  1009,  1003,   998,   993,   987,   982,   976,   970,
+		  965,   959,   954,   948,   943,   937,   932,   926,   920,   915,   909,   903,
+		  898,   892,   887,   881,   875,   870,   864,   858,   852,   847,   841,   835,
+		  830,   824,   818,   812,   807,   801,   795,   789,   783,   778,   772,   766,
+		  760,   754,   748,   743,   737,   731,   725,   719,   713,   707,   701,   696,
+		  690,   684,   678,   672,   666,   660,   654,   648,   642,   636,   630,   624,
+		  618,   612,   606,   600,   594,   588,   582,   576,   570,   564,   558,   552,
+		  546,   540,   534,   528,   522,   516,   510,   503,   497,   491,   485,   479,
+		  473,   467,   461,   455,   449,   442,   436,   430,   424,   418,   412,   406,
+		  399,   393,   387,   381,   375,   369,   362,   356,   350,   344,   338,   331,
+		  325,   319,   313,   307,   300,   294,   288,   282,   275,   269,   263,   257,
+		  251,   244,   238,   232,   226,   219,   213,   207,   201,   194,   188,   182,
+		  176,   169,   163,   157,   151,   144,   138,   132,   126,   119,   113,   107,
+		  100,    94,    88,    82,    75,    69,    63,    57,    50,    44,    38,    31,
+		   25,    19,    13,     6,     0,    -6,   -13,   -19,   -25,   -31,   -38,   -44,
+		  -50,   -57,   -63,   -69,   -75,   -82,   -88,   -94,  -100,  -107,  -113,  -119,
+		 -126,  -132,  -138,  -144,  -151,  -157,  -163,  -169,  -176,  -182,  -188,  -194,
+		 -201,  -207,  -213,  -219,  -226,  -232,  -238,  -244,  -251,  -257,  -263,  -269,
+		 -275,  -282,  -288,  -294,  -300,  -307,  -313,  -319,  -325,  -331,  -338,  -344,
+		 -350,  -356,  -362,  -369,  -375,  -381,  -387,  -393,  -399,  -406,  -412,  -418,
+		 -424,  -430,  -436,  -442,  -449,  -455,  -461,  -467,  -473,  -479,  -485,  -491,
+		 -497,  -503,  -510,  -516,  -522,  -528,  -534,  -540,  -546,  -552,  -558,  -564,
+		 -570,  -576,  -582,  -588,  -594,  -600,  -606,  -612,  -618,  -624,  -630,  -636,
+		 -642,  -648,  -654,  -660,  -666,  -672,  -678,  -684,  -690,  -696,  -701,  -707,
+		 -713,  -719,  -725,  -731,  -737,  -743,  -748,  -754,  -760,  -766,  -772,  -778,
+		 -783,  -789,  -795,  -801,  -807,  -812,  -818,  -824,  -830,  -835,  -841,  -847,
+		 -852,  -858,  -864,  -870,  -875,  -881,  -887,  -892,  -898,  -903,  -909,  -915,
+		 -920,  -926,  -932,  -937,  -943,  -948,  -954,  -959,  -965,  -970,  -976,  -982,
+		 -987,  -993,  -998, -1003, -1009, -1014, -1020, -1025, -1031, -1036, -1042, -1047,
+		-1052, -1058, -1063, -1068, -1074, -1079, -1085, -1090, -1095, -1100, -1106, -1111,
+		-1116, -1122, -1127, -1132, -1137, -1142, -1148, -1153, -1158, -1163, -1168, -1174,
+		-1179, -1184, -1189, -1194, -1199, -1204, -1209, -1214, -1219, -1224, -1229, -1234,
+		-1239, -1244, -1249, -1254, -1259, -1264, -1269, -1274, -1279, -1284, -1289, -1294,
+		-1299, -1303, -1308, -1313, -1318, -1323, -1328, -1332, -1337, -1342, -1347, -1351,
+		-1356, -1361, -1365, -1370, -1375, -1379, -1384, -1389, -1393, -1398, -1402, -1407,
+		-1411, -1416, -1421, -1425, -1430, -1434, -1439, -1443, -1447, -1452, -1456, -1461,
+		-1465, -1469, -1474, -1478, -1483, -1487, -1491, -1495, -1500, -1504, -1508, -1513,
+		-1517, -1521, -1525, -1529, -1533, -1538, -1542, -1546, -1550, -1554, -1558, -1562,
+		-1566, -1570, -1574, -1578, -1582, -1586, -1590, -1594, -1598, -1602, -1606, -1610,
+		-1614, -1618, -1621, -1625, -1629, -1633, -1637, -1640, -1644, -1648, -1652, -1655,
+		-1659, -1663, -1666, -1670, -1674, -1677, -1681, -1684, -1688, -1691, -1695, -1699,
+		-1702, -1705, -1709, -1712, -1716, -1719, -1723, -1726, -1729, -1733, -1736, -1739,
+		-1743, -1746, -1749, -1753, -1756, -1759, -1762, -1765, -1769, -1772, -1775, -1778,
+		-1781, -1784, -1787, -1790, -1793, -1796, -1799, -1802, -1805, -1808, -1811, -1814,
+		-1817, -1820, -1823, -1826, -1828, -1831, -1834, -1837, -1840, -1842, -1845, -1848,
+		-1850, -1853, -1856, -1858, -1861, -1864, -1866, -1869, -1871, -1874, -1876, -1879,
+		-1881, -1884, -1886, -1889, -1891, -1894, -1896, -1898, -1901, -1903, -1905, -1908,
+		-1910, -1912, -1914, -1917, -1919, -1921, -1923, -1925, -1927, -1929, -1932, -1934,
+		-1936, -1938, -1940, -1942, -1944, -1946, -1948, -1950, -1951, -1953, -1955, -1957,
+		-1959, -1961, -1962, -1964, -1966, -1968, -1969, -1971, -1973, -1975, -1976, -1978,
+		-1979, -1981, -1983, -1984, -1986, -1987, -1989, -1990, -1992, -1993, -1994, -1996,
+		-1997, -1999, -2000, -2001, -2003, -2004, -2005, -2006, -2008, -2009, -2010, -2011,
+		-2012, -2014, -2015, -2016, -2017, -2018, -2019, -2020, -2021, -2022, -2023, -2024,
+		-2025, -2026, -2027, -2028, -2028, -2029, -2030, -2031, -2032, -2032, -2033, -2034,
+		-2035, -2035, -2036, -2037, -2037, -2038, -2038, -2039, -2039, -2040, -2040, -2041,
+		-2041, -2042, -2042, -2043, -2043, -2044, -2044, -2044, -2045, -2045, -2045, -2045,
+		-2046, -2046, -2046, -2046, -2046, -2047, -2047, -2047, -2047, -2047, -2047, -2047,
+		-2047, -2047, -2047, -2047, -2047, -2047, -2047, -2047, -2046, -2046, -2046, -2046,
+		-2046, -2045, -2045, -2045, -2045, -2044, -2044, -2044, -2043, -2043, -2042, -2042,
+		-2041, -2041, -2040, -2040, -2039, -2039, -2038, -2038, -2037, -2037, -2036, -2035,
+		-2035, -2034, -2033, -2032, -2032, -2031, -2030, -2029, -2028, -2028, -2027, -2026,
+		-2025, -2024, -2023, -2022, -2021, -2020, -2019, -2018, -2017, -2016, -2015, -2014,
+		-2012, -2011, -2010, -2009, -2008, -2006, -2005, -2004, -2003, -2001, -2000, -1999,
+		-1997, -1996, -1994, -1993, -1992, -1990, -1989, -1987, -1986, -1984, -1983, -1981,
+		-1979, -1978, -1976, -1975, -1973, -1971, -1969, -1968, -1966, -1964, -1962, -1961,
+		-1959, -1957, -1955, -1953, -1951, -1950, -1948, -1946, -1944, -1942, -1940, -1938,
+		-1936, -1934, -1932, -1929, -1927, -1925, -1923, -1921, -1919, -1917, -1914, -1912,
+		-1910, -1908, -1905, -1903, -1901, -1898, -1896, -1894, -1891, -1889, -1886, -1884,
+		-1881, -1879, -1876, -1874, -1871, -1869, -1866, -1864, -1861, -1858, -1856, -1853,
+		-1850, -1848, -1845, -1842, -1840, -1837, -1834, -1831, -1828, -1826, -1823, -1820,
+		-1817, -1814, -1811, -1808, -1805, -1802, -1799, -1796, -1793, -1790, -1787, -1784,
+		-1781, -1778, -1775, -1772, -1769, -1765, -1762, -1759, -1756, -1753, -1749, -1746,
+		-1743, -1739, -1736, -1733, -1729, -1726, -1723, -1719, -1716, -1712, -1709, -1705,
+		-1702, -1699, -1695, -1691, -1688, -1684, -1681, -1677, -1674, -1670, -1666, -1663,
+		-1659, -1655, -1652, -1648, -1644, -1640, -1637, -1633, -1629, -1625, -1621, -1618,
+		-1614, -1610, -1606, -1602, -1598, -1594, -1590, -1586, -1582, -1578, -1574, -1570,
+		-1566, -1562, -1558, -1554, -1550, -1546, -1542, -1538, -1533, -1529, -1525, -1521,
+		-1517, -1513, -1508, -1504, -1500, -1495, -1491, -1487, -1483, -1478, -1474, -1469,
+		-1465, -1461, -1456, -1452, -1447, -1443, -1439, -1434, -1430, -1425, -1421, -1416,
+		-1411, -1407, -1402, -1398, -1393, -1389, -1384, -1379, -1375, -1370, -1365, -1361,
+		-1356, -1351, -1347, -1342, -1337, -1332, -1328, -1323, -1318, -1313, -1308, -1303,
+		-1299, -1294, -1289, -1284, -1279, -1274, -1269, -1264, -1259, -1254, -1249, -1244,
+		-1239, -1234, -1229, -1224, -1219, -1214, -1209, -1204, -1199, -1194, -1189, -1184,
+		-1179, -1174, -1168, -1163, -1158, -1153, -1148, -1142, -1137, -1132, -1127, -1122,
+		-1116, -1111, -1106, -1100, -1095, -1090, -1085, -1079, -1074, -1068, -1063, -1058,
+		-1052, -1047, -1042, -1036, -1031, -1025, -1020, -1014, -1009, -1003,  -998,  -993,
+		 -987,  -982,  -976,  -970,  -965,  -959,  -954,  -948,  -943,  -937,  -932,  -926,
+		 -920,  -915,  -909,  -903,  -898,  -892,  -887,  -881,  -875,  -870,  -864,  -858,
+		 -852,  -847,  -841,  -835,  -830,  -824,  -818,  -812,  -807,  -801,  -795,  -789,
+		 -783,  -778,  -772,  -766,  -760,  -754,  -748,  -743,  -737,  -731,  -725,  -719,
+		 -713,  -707,  -701,  -696,  -690,  -684,  -678,  -672,  -666,  -660,  -654,  -648,
+		 -642,  -636,  -630,  -624,  -618,  -612,  -606,  -600,  -594,  -588,  -582,  -576,
+		 -570,  -564,  -558,  -552,  -546,  -540,  -534,  -528,  -522,  -516,  -510,  -503,
+		 -497,  -491,  -485,  -479,  -473,  -467,  -461,  -455,  -449,  -442,  -436,  -430,
+		 -424,  -418,  -412,  -406,  -399,  -393,  -387,  -381,  -375,  -369,  -362,  -356,
+		 -350,  -344,  -338,  -331,  -325,  -319,  -313,  -307,  -300,  -294,  -288,  -282,
+		 -275,  -269,  -263,  -257,  -251,  -244,  -238,  -232,  -226,  -219,  -213,  -207,
+		 -201,  -194,  -188,  -182,  -176,  -169,  -163,  -157,  -151,  -144,  -138,  -132,
+		 -126,  -119,  -113,  -107,  -100,   -94,   -88,   -82,   -75,   -69,   -63,   -57,
+		  -50,   -44,   -38,   -31,   -25,   -19,   -13,    -6,     0,
+	},
+	// Bright level 0,1,2,3,4,5,6
+	{
+		    0,    13,    25,    38,    51,    64,    76,    89,   102,   115,   127,   140,
+		  153,   165,   178,   190,   203,   216,   228,   241,   253,   266,   278,   291,
+		  303,   316,   328,   340,   353,   365,   377,   389,   402,   414,   426,   438,
+		  450,   462,   474,   486,   498,   509,   521,   533,   545,   556,   568,   579,
+		  591,   602,   614,   625,   636,   648,   659,   670,   681,   692,   703,   714,
+		  725,   735,   746,   757,   767,   778,   788,   798,   809,   819,   829,   839,
+		  849,   859,   869,   879,   888,   898,   908,   917,   926,   936,   945,   954,
+		  963,   972,   981,   990,   999,  1007,  1016,  1024,  1033,  1041,  1049,  1058,
+		 1066,  1074,  1082,  1089,  1097,  1105,  1112,  1120,  1127,  1134,  1141,  1148,
+		 1155,  1162,  1169,  1176,  1182,  1189,  1195,  1202,  1208,  1214,  1220,  1226,
+		 1232,  1237,  1243,  1249,  1254,  1259,  1265,  1270,  1275,  1280,  1284,  1289,
+		 1294,  1298,  1303,  1307,  1311,  1316,  1320,  1324,  1327,  1331,  1335,  1338,
+		 1342,  1345,  1348,  1352,  1355,  1358,  1360,  1363,  1366,  1368,  1371,  1373,
+		 1375,  1378,  1380,  1382,  1383,  1385,  1387,  1388,  1390,  1391,  1393,  1394,
+		 1395,  1396,  1397,  1398,  1398,  1399,  1400,  1400,  1400,  1401,  1401,  1401,
+		 1401,  1401,  1400,  1400,  1400,  1399,  1399,  1398,  1398,  1397,  1396,  1395,
+		 1394,  1393,  1391,  1390,  1389,  1387,  1386,  1384,  1382,  1381,  1379,  1377,
+		 1375,  1373,  1371,  1368,  1366,  1364,  1361,  1359,  1356,  1353,  1351,  1348,
+		 1345,  1342,  1339,  1336,  1333,  1330,  1326,  1323,  1320,  1316,  1313,  1309,
+		 1306,  1302,  1298,  1295,  1291,  1287,  1283,  1279,  1275,  1271,  1267,  1262,
+		 1258,  1254,  1250,  1245,  1241,  1236,  1232,  1227,  1223,  1218,  1214,  1209,
+		 1204,  1200,  1195,  1190,  1185,  1180,  1175,  1170,  1165,  1160,  1155,  1150,
+		 1145,  1140,  1135,  1130,  1125,  1120,  1115,  1109,  1104,  1099,  1094,  1089,
+		 1083,  1078,  1073,  1067,  1062,  1057,  1052,  1046,  1041,  1036,  1030,  1025,
+		 1020,  1014,  1009,  1004,   998,   993,   988,   982,   977,   972,   967,   961,
+		  956,   951,   946,   940,   935,   930,   925,   920,   915,   910,   904,   899,
+		  894,   889,   884,   879,   874,   869,   865,   860,   855,   850,   845,   841,
+		  836,   831,   826,   822,   817,   813,   808,   804,   799,   795,   791,   786,
+		  782,   778,   773,   769,   765,   761,   757,   753,   749,   745,   741,   738,
+		  734,   730,   726,   723,   719,   716,   712,   709,   706,   702,   699,   696,
+		  693,   690,   687,   684,   681,   678,   675,   672,   670,   667,   664,   662,
+		  659,   657,   655,   652,   650,   648,   646,   644,   642,   640,   638,   636,
+		  635,   633,   631,   630,   628,   627,   626,   624,   623,   622,   621,   620,
+		  619,   618,   617,   616,   616,   615,   614,   614,   613,   613,   613,   612,
+		  612,   612,   612,   612,   612,   612,   612,   612,   613,   613,   613,   614,
+		  614,   615,   616,   617,   617,   618,   619,   620,   621,   622,   623,   625,
+		  626,   627,   629,   630,   632,   633,   635,   636,   638,   640,   642,   644,
+		  646,   648,   650,   652,   654,   656,   659,   661,   663,   666,   668,   671,
+		  673,   676,   679,   681,   684,   687,   690,   693,   696,   699,   702,   705,
+		  708,   711,   714,   718,   721,   724,   728,   731,   734,   738,   741,   745,
+		  749,   752,   756,   760,   763,   767,   771,   775,   778,   782,   786,   790,
+		  794,   798,   802,   806,   810,   814,   818,   822,   827,   831,   835,   839,
+		  843,   847,   852,   856,   860,   864,   869,   873,   877,   882,   886,   890,
+		  895,   899,   903,   908,   912,   916,   921,   925,   929,   934,   938,   942,
+		  947,   951,   956,   960,   964,   969,   973,   977,   981,   986,   990,   994,
+		  999,  1003,  1007,  1011,  1015,  1020,  1024,  1028,  1032,  1036,  1040,  1044,
+		 1048,  1052,  1056,  1060,  1064,  1068,  1072,  1076,  1080,  1084,  1087,  1091,
+		 1095,  1098,  1102,  1106,  1109,  1113,  1116,  1120,  1123,  1127,  1130,  1133,
+		 1137,  1140,  1143,  1146,  1149,  1152,  1156,  1159,  1161,  1164,  1167,  1170,
+		 1173,  1175,  1178,  1181,  1183,  1186,  1188,  1191,  1193,  1195,  1198,  1200,
+		 1202,  1204,  1206,  1208,  1210,  1212,  1214,  1216,  1217,  1219,  1221,  1222,
+		 1224,  1225,  1226,  1228,  1229,  1230,  1231,  1232,  1233,  1234,  1235,  1236,
+		 1236,  1237,  1238,  1238,  1239,  1239,  1240,  1240,  1240,  1240,  1240,  1240,
+		 1240,  1240,  1240,  1240,  1240,  1239,  1239,  1238,  1238,  1237,  1236,  1236,
+		 1235,  1234,  1233,  1232,  1231,  1230,  1228,  1227,  1226,  1224,  1223,  1221,
+		 1220,  1218,  1216,  1214,  1212,  1210,  1208,  1206,  1204,  1202,  1200,  1197,
+		 1195,  1192,  1190,  1187,  1184,  1182,  1179,  1176,  1173,  1170,  1167,  1164,
+		 1161,  1157,  1154,  1151,  1147,  1144,  1140,  1137,  1133,  1129,  1125,  1122,
+		 1118,  1114,  1110,  1106,  1101,  1097,  1093,  1089,  1084,  1080,  1075,  1071,
+		 1066,  1062,  1057,  1052,  1047,  1043,  1038,  1033,  1028,  1023,  1018,  1013,
+		 1007,  1002,   997,   992,   986,   981,   975,   970,   964,   959,   953,   948,
+		  942,   936,   931,   925,   919,   913,   907,   901,   895,   889,   883,   877,
+		  871,   865,   859,   853,   846,   840,   834,   828,   821,   815,   808,   802,
+		  796,   789,   783,   776,   770,   763,   757,   750,   744,   737,   730,   724,
+		  717,   711,   704,   697,   691,   684,   677,   671,   664,   657,   650,   644,
+		  637,   630,   624,   617,   610,   603,   597,   590,   583,   576,   570,   563,
+		  556,   550,   543,   536,   529,   523,   516,   509,   503,   496,   490,   483,
+		  476,   470,   463,   457,   450,   444,   437,   431,   424,   418,   411,   405,
+		  398,   392,   386,   379,   373,   367,   361,   354,   348,   342,   336,   330,
+		  324,   318,   312,   306,   300,   294,   288,   282,   276,   271,   265,   259,
+		  254,   248,   242,   237,   231,   226,   220,   215,   210,   204,   199,   194,
+		  189,   183,   178,   173,   168,   163,   158,   154,   149,   144,   139,   135,
+		  130,   125,   121,   116,   112,   107,   103,    99,    94,    90,    86,    82,
+		   78,    74,    70,    66,    62,    59,    55,    51,    47,    44,    40,    37,
+		   33,    30,    27,    24,    20,    17,    14,    11,     8,     5,     2,    -1,
+		   -3,    -6,    -9,   -11,   -14,   -16,   -19,   -21,   -24,   -26,   -28,   -30,
+		  -32,   -34,   -36,   -38,   -40,   -42,   -44,   -46,   -47,   -49,   -50,   -52,
+		  -53,   -55,   -56,   -58,   -59,   -60,   -61,   -62,   -63,   -64,   -65,   -66,
+		  -67,   -68,   -69,   -69,   -70,   -71,   -71,   -72,   -72,   -73,   -73,   -73,
+		  -74,   -74,   -74,   -74,   -74,   -74,   -74,   -74,   -74,   -74,   -74,   -74,
+		  -74,   -73,   -73,   -73,   -72,   -72,   -71,   -71,   -70,   -70,   -69,   -69,
+		  -68,   -67,   -66,   -66,   -65,   -64,   -63,   -62,   -61,   -60,   -59,   -58,
+		  -57,   -56,   -55,   -54,   -53,   -52,   -50,   -49,   -48,   -47,   -45,   -44,
+		  -43,   -41,   -40,   -39,   -37,   -36,   -34,   -33,   -31,   -30,   -28,   -27,
+		  -25,   -24,   -22,   -21,   -19,   -18,   -16,   -14,   -13,   -11,   -10,    -8,
+		   -6,    -5,    -3,    -2,     0,     2,     3,     5,     6,     8,    10,    11,
+		   13,    14,    16,    18,    19,    21,    22,    24,    25,    27,    28,    30,
+		   31,    33,    34,    36,    37,    39,    40,    41,    43,    44,    45,    47,
+		   48,    49,    50,    52,    53,    54,    55,    56,    57,    58,    59,    60,
+		   61,    62,    63,    64,    65,    66,    66,    67,    68,    69,    69,    70,
+		   70,    71,    71,    72,    72,    73,    73,    73,    74,    74,    74,    74,
+		   74,    74,    74,    74,    74,    74,    74,    74,    74,    73,    73,    73,
+		   72,    72,    71,    71,    70,    69,    69,    68,    67,    66,    65,    64,
+		   63,    62,    61,    60,    59,    58,    56,    55,    53,    52,    50,    49,
+		   47,    46,    44,    42,    40,    38,    36,    34,    32,    30,    28,    26,
+		   24,    21,    19,    16,    14,    11,     9,     6,     3,     1,    -2,    -5,
+		   -8,   -11,   -14,   -17,   -20,   -24,   -27,   -30,   -33,   -37,   -40,   -44,
+		  -47,   -51,   -55,   -59,   -62,   -66,   -70,   -74,   -78,   -82,   -86,   -90,
+		  -94,   -99,  -103,  -107,  -112,  -116,  -121,  -125,  -130,  -135,  -139,  -144,
+		 -149,  -154,  -158,  -163,  -168,  -173,  -178,  -183,  -189,  -194,  -199,  -204,
+		 -210,  -215,  -220,  -226,  -231,  -237,  -242,  -248,  -254,  -259,  -265,  -271,
+		 -276,  -282,  -288,  -294,  -300,  -306,  -312,  -318,  -324,  -330,  -336,  -342,
+		 -348,  -354,  -361,  -367,  -373,  -379,  -386,  -392,  -398,  -405,  -411,  -418,
+		 -424,  -431,  -437,  -444,  -450,  -457,  -463,  -470,  -476,  -483,  -490,  -496,
+		 -503,  -509,  -516,  -523,  -529,  -536,  -543,  -550,  -556,  -563,  -570,  -576,
+		 -583,  -590,  -597,  -603,  -610,  -617,  -624,  -630,  -637,  -644,  -650,  -657,
+		 -664,  -671,  -677,  -684,  -691,  -697,  -704,  -711,  -717,  -724,  -730,  -737,
+		 -744,  -750,  -757,  -763,  -770,  -776,  -783,  -789,  -796,  -802,  -808,  -815,
+		 -821,  -828,  -834,  -840,  -846,  -853,  -859,  -865,  -871,  -877,  -883,  -889,
+		 -895,  -901,  -907,  -913,  -919,  -925,  -931,  -936,  -942,  -948,  -953,  -959,
+		 -964,  -970,  -975,  -981,  -986,  -992,  -997, -1002, -1007, -1013, -1018, -1023,
+		-1028, -1033, -1038, -1043, -1047, -1052, -1057, -1062, -1066, -1071, -1075, -1080,
+		-1084, -1089, -1093, -1097, -1101, -1106, -1110, -1114, -1118, -1122, -1125, -1129,
+		-1133, -1137, -1140, -1144, -1147, -1151, -1154, -1157, -1161, -1164, -1167, -1170,
+		-1173, -1176, -1179, -1182, -1184, -1187, -1190, -1192, -1195, -1197, -1200, -1202,
+		-1204, -1206, -1208, -1210, -1212, -1214, -1216, -1218, -1220, -1221, -1223, -1224,
+		-1226, -1227, -1228, -1230, -1231, -1232, -1233, -1234, -1235, -1236, -1236, -1237,
+		-1238, -1238, -1239, -1239, -1240, -1240, -1240, -1240, -1240, -1240, -1240, -1240,
+		-1240, -1240, -1240, -1239, -1239, -1238, -1238, -1237, -1236, -1236, -1235, -1234,
+		-1233, -1232, -1231, -1230, -1229, -1228, -1226, -1225, -1224, -1222, -1221, -1219,
+		-1217, -1216, -1214, -1212, -1210, -1208, -1206, -1204, -1202, -1200, -1198, -1195,
+		-1193, -1191, -1188, -1186, -1183, -1181, -1178, -1175, -1173, -1170, -1167, -1164,
+		-1161, -1159, -1156, -1152, -1149, -1146, -1143, -1140, -1137, -1133, -1130, -1127,
+		-1123, -1120, -1116, -1113, -1109, -1106, -1102, -1098, -1095, -1091, -1087, -1084,
+		-1080, -1076, -1072, -1068, -1064, -1060, -1056, -1052, -1048, -1044, -1040, -1036,
+		-1032, -1028, -1024, -1020, -1015, -1011, -1007, -1003,  -999,  -994,  -990,  -986,
+		 -981,  -977,  -973,  -969,  -964,  -960,  -956,  -951,  -947,  -942,  -938,  -934,
+		 -929,  -925,  -921,  -916,  -912,  -908,  -903,  -899,  -895,  -890,  -886,  -882,
+		 -877,  -873,  -869,  -864,  -860,  -856,  -852,  -847,  -843,  -839,  -835,  -831,
+		 -827,  -822,  -818,  -814,  -810,  -806,  -802,  -798,  -794,  -790,  -786,  -782,
+		 -778,  -775,  -771,  -767,  -763,  -760,  -756,  -752,  -749,  -745,  -741,  -738,
+		 -734,  -731,  -728,  -724,  -721,  -718,  -714,  -711,  -708,  -705,  -702,  -699,
+		 -696,  -693,  -690,  -687,  -684,  -681,  -679,  -676,  -673,  -671,  -668,  -666,
+		 -663,  -661,  -659,  -656,  -654,  -652,  -650,  -648,  -646,  -644,  -642,  -640,
+		 -638,  -636,  -635,  -633,  -632,  -630,  -629,  -627,  -626,  -625,  -623,  -622,
+		 -621,  -620,  -619,  -618,  -617,  -617,  -616,  -615,  -614,  -614,  -613,  -613,
+		 -613,  -612,  -612,  -612,  -612,  -612,  -612,  -612,  -612,  -612,  -613,  -613,
+		 -613,  -614,  -614,  -615,  -616,  -616,  -617,  -618,  -619,  -620,  -621,  -622,
+		 -623,  -624,  -626,  -627,  -628,  -630,  -631,  -633,  -635,  -636,  -638,  -640,
+		 -642,  -644,  -646,  -648,  -650,  -652,  -655,  -657,  -659,  -662,  -664,  -667,
+		 -670,  -672,  -675,  -678,  -681,  -684,  -687,  -690,  -693,  -696,  -699,  -702,
+		 -706,  -709,  -712,  -716,  -719,  -723,  -726,  -730,  -734,  -738,  -741,  -745,
+		 -749,  -753,  -757,  -761,  -765,  -769,  -773,  -778,  -782,  -786,  -791,  -795,
+		 -799,  -804,  -808,  -813,  -817,  -822,  -826,  -831,  -836,  -841,  -845,  -850,
+		 -855,  -860,  -865,  -869,  -874,  -879,  -884,  -889,  -894,  -899,  -904,  -910,
+		 -915,  -920,  -925,  -930,  -935,  -940,  -946,  -951,  -956,  -961,  -967,  -972,
+		 -977,  -982,  -988,  -993,  -998, -1004, -1009, -1014, -1020, -1025, -1030, -1036,
+		-1041, -1046, -1052, -1057, -1062, -1067, -1073, -1078, -1083, -1089, -1094, -1099,
+		-1104, -1109, -1115, -1120, -1125, -1130, -1135, -1140, -1145, -1150, -1155, -1160,
+		-1165, -1170, -1175, -1180, -1185, -1190, -1195, -1200, -1204, -1209, -1214, -1218,
+		-1223, -1227, -1232, -1236, -1241, -1245, -1250, -1254, -1258, -1262, -1267, -1271,
+		-1275, -1279, -1283, -1287, -1291, -1295, -1298, -1302, -1306, -1309, -1313, -1316,
+		-1320, -1323, -1326, -1330, -1333, -1336, -1339, -1342, -1345, -1348, -1351, -1353,
+		-1356, -1359, -1361, -1364, -1366, -1368, -1371, -1373, -1375, -1377, -1379, -1381,
+		-1382, -1384, -1386, -1387, -1389, -1390, -1391, -1393, -1394, -1395, -1396, -1397,
+		-1398, -1398, -1399, -1399, -1400, -1400, -1400, -1401, -1401, -1401, -1401, -1401,
+		-1400, -1400, -1400, -1399, -1398, -1398, -1397, -1396, -1395, -1394, -1393, -1391,
+		-1390, -1388, -1387, -1385, -1383, -1382, -1380, -1378, -1375, -1373, -1371, -1368,
+		-1366, -1363, -1360, -1358, -1355, -1352, -1348, -1345, -1342, -1338, -1335, -1331,
+		-1327, -1324, -1320, -1316, -1311, -1307, -1303, -1298, -1294, -1289, -1284, -1280,
+		-1275, -1270, -1265, -1259, -1254, -1249, -1243, -1237, -1232, -1226, -1220, -1214,
+		-1208, -1202, -1195, -1189, -1182, -1176, -1169, -1162, -1155, -1148, -1141, -1134,
+		-1127, -1120, -1112, -1105, -1097, -1089, -1082, -1074, -1066, -1058, -1049, -1041,
+		-1033, -1024, -1016, -1007,  -999,  -990,  -981,  -972,  -963,  -954,  -945,  -936,
+		 -926,  -917,  -908,  -898,  -888,  -879,  -869,  -859,  -849,  -839,  -829,  -819,
+		 -809,  -798,  -788,  -778,  -767,  -757,  -746,  -735,  -725,  -714,  -703,  -692,
+		 -681,  -670,  -659,  -648,  -636,  -625,  -614,  -602,  -591,  -579,  -568,  -556,
+		 -545,  -533,  -521,  -509,  -498,  -486,  -474,  -462,  -450,  -438,  -426,  -414,
+		 -402,  -389,  -377,  -365,  -353,  -340,  -328,  -316,  -303,  -291,  -278,  -266,
+		 -253,  -241,  -228,  -216,  -203,  -190,  -178,  -165,  -153,  -140,  -127,  -115,
+		 -102,   -89,   -76,   -64,   -51,   -38,   -25,   -13,     0,
+	},
+	// Electric level 0,1,2,3,4,5,6
+	{
+		    0,    10,    19,    29,    38,    48,    57,    67,    77,    86,    96,   105,
+		  115,   124,   134,   143,   153,   162,   172,   181,   191,   200,   210,   219,
+		  229,   238,   247,   257,   266,   276,   285,   294,   304,   313,   322,   332,
+		  341,   350,   359,   369,   378,   387,   396,   405,   415,   424,   433,   442,
+		  451,   460,   469,   478,   487,   496,   505,   514,   523,   531,   540,   549,
+		  558,   567,   575,   584,   593,   601,   610,   619,   627,   636,   644,   653,
+		  661,   669,   678,   686,   694,   703,   711,   719,   727,   736,   744,   752,
+		  760,   768,   776,   784,   792,   799,   807,   815,   823,   831,   838,   846,
+		  854,   861,   869,   876,   884,   891,   898,   906,   913,   920,   927,   935,
+		  942,   949,   956,   963,   970,   977,   984,   991,   997,  1004,  1011,  1017,
+		 1024,  1031,  1037,  1044,  1050,  1057,  1063,  1069,  1076,  1082,  1088,  1094,
+		 1100,  1106,  1112,  1118,  1124,  1130,  1136,  1141,  1147,  1153,  1158,  1164,
+		 1170,  1175,  1180,  1186,  1191,  1197,  1202,  1207,  1212,  1217,  1222,  1227,
+		 1232,  1237,  1242,  1247,  1252,  1256,  1261,  1266,  1270,  1275,  1279,  1284,
+		 1288,  1292,  1297,  1301,  1305,  1309,  1313,  1317,  1321,  1325,  1329,  1333,
+		 1337,  1340,  1344,  1348,  1351,  1355,  1358,  1362,  1365,  1369,  1372,  1375,
+		 1379,  1382,  1385,  1388,  1391,  1394,  1397,  1400,  1403,  1405,  1408,  1411,
+		 1414,  1416,  1419,  1421,  1424,  1426,  1429,  1431,  1433,  1435,  1438,  1440,
+		 1442,  1444,  1446,  1448,  1450,  1452,  1454,  1456,  1457,  1459,  1461,  1462,
+		 1464,  1466,  1467,  1469,  1470,  1471,  1473,  1474,  1475,  1477,  1478,  1479,
+		 1480,  1481,  1482,  1483,  1484,  1485,  1486,  1487,  1488,  1488,  1489,  1490,
+		 1490,  1491,  1492,  1492,  1493,  1493,  1494,  1494,  1494,  1495,  1495,  1495,
+		 1496,  1496,  1496,  1496,  1496,  1496,  1496,  1496,  1496,  1496,  1496,  1496,
+		 1496,  1496,  1496,  1495,  1495,  1495,  1494,  1494,  1494,  1493,  1493,  1492,
+		 1492,  1491,  1491,  1490,  1490,  1489,  1488,  1488,  1487,  1486,  1486,  1485,
+		 1484,  1483,  1482,  1482,  1481,  1480,  1479,  1478,  1477,  1476,  1475,  1474,
+		 1473,  1472,  1471,  1470,  1469,  1468,  1466,  1465,  1464,  1463,  1462,  1460,
+		 1459,  1458,  1457,  1455,  1454,  1453,  1451,  1450,  1449,  1447,  1446,  1444,
+		 1443,  1441,  1440,  1439,  1437,  1436,  1434,  1433,  1431,  1430,  1428,  1426,
+		 1425,  1423,  1422,  1420,  1419,  1417,  1415,  1414,  1412,  1410,  1409,  1407,
+		 1406,  1404,  1402,  1401,  1399,  1397,  1395,  1394,  1392,  1390,  1389,  1387,
+		 1385,  1384,  1382,  1380,  1378,  1377,  1375,  1373,  1371,  1370,  1368,  1366,
+		 1364,  1363,  1361,  1359,  1357,  1356,  1354,  1352,  1350,  1349,  1347,  1345,
+		 1343,  1342,  1340,  1338,  1336,  1335,  1333,  1331,  1329,  1328,  1326,  1324,
+		 1323,  1321,  1319,  1317,  1316,  1314,  1312,  1310,  1309,  1307,  1305,  1304,
+		 1302,  1300,  1299,  1297,  1295,  1294,  1292,  1290,  1289,  1287,  1285,  1284,
+		 1282,  1280,  1279,  1277,  1276,  1274,  1272,  1271,  1269,  1268,  1266,  1264,
+		 1263,  1261,  1260,  1258,  1257,  1255,  1254,  1252,  1251,  1249,  1247,  1246,
+		 1244,  1243,  1241,  1240,  1239,  1237,  1236,  1234,  1233,  1231,  1230,  1228,
+		 1227,  1226,  1224,  1223,  1221,  1220,  1219,  1217,  1216,  1214,  1213,  1212,
+		 1210,  1209,  1208,  1206,  1205,  1204,  1202,  1201,  1200,  1198,  1197,  1196,
+		 1194,  1193,  1192,  1191,  1189,  1188,  1187,  1186,  1184,  1183,  1182,  1181,
+		 1179,  1178,  1177,  1176,  1175,  1173,  1172,  1171,  1170,  1169,  1167,  1166,
+		 1165,  1164,  1163,  1161,  1160,  1159,  1158,  1157,  1156,  1154,  1153,  1152,
+		 1151,  1150,  1149,  1148,  1146,  1145,  1144,  1143,  1142,  1141,  1140,  1138,
+		 1137,  1136,  1135,  1134,  1133,  1132,  1131,  1129,  1128,  1127,  1126,  1125,
+		 1124,  1123,  1121,  1120,  1119,  1118,  1117,  1116,  1115,  1113,  1112,  1111,
+		 1110,  1109,  1108,  1107,  1105,  1104,  1103,  1102,  1101,  1100,  1098,  1097,
+		 1096,  1095,  1094,  1092,  1091,  1090,  1089,  1088,  1086,  1085,  1084,  1083,
+		 1082,  1080,  1079,  1078,  1077,  1075,  1074,  1073,  1071,  1070,  1069,  1068,
+		 1066,  1065,  1064,  1062,  1061,  1060,  1058,  1057,  1056,  1054,  1053,  1052,
+		 1050,  1049,  1047,  1046,  1045,  1043,  1042,  1040,  1039,  1037,  1036,  1034,
+		 1033,  1031,  1030,  1028,  1027,  1025,  1024,  1022,  1021,  1019,  1018,  1016,
+		 1014,  1013,  1011,  1010,  1008,  1006,  1005,  1003,  1001,  1000,   998,   996,
+		  995,   993,   991,   989,   988,   986,   984,   982,   980,   979,   977,   975,
+		  973,   971,   969,   968,   966,   964,   962,   960,   958,   956,   954,   952,
+		  950,   948,   946,   944,   942,   940,   938,   936,   934,   932,   930,   928,
+		  926,   924,   922,   919,   917,   915,   913,   911,   909,   906,   904,   902,
+		  900,   897,   895,   893,   891,   888,   886,   884,   881,   879,   877,   874,
+		  872,   870,   867,   865,   862,   860,   858,   855,   853,   850,   848,   845,
+		  843,   840,   838,   835,   833,   830,   828,   825,   823,   820,   817,   815,
+		  812,   810,   807,   804,   802,   799,   796,   794,   791,   788,   786,   783,
+		  780,   778,   775,   772,   769,   767,   764,   761,   758,   755,   753,   750,
+		  747,   744,   741,   739,   736,   733,   730,   727,   724,   722,   719,   716,
+		  713,   710,   707,   704,   701,   698,   695,   693,   690,   687,   684,   681,
+		  678,   675,   672,   669,   666,   663,   660,   657,   654,   651,   648,   645,
+		  642,   639,   636,   633,   630,   627,   624,   621,   618,   615,   612,   609,
+		  606,   603,   600,   597,   594,   591,   588,   584,   581,   578,   575,   572,
+		  569,   566,   563,   560,   557,   554,   551,   548,   545,   542,   539,   536,
+		  532,   529,   526,   523,   520,   517,   514,   511,   508,   505,   502,   499,
+		  496,   493,   490,   487,   484,   481,   477,   474,   471,   468,   465,   462,
+		  459,   456,   453,   450,   447,   444,   441,   438,   435,   432,   429,   426,
+		  423,   420,   417,   414,   411,   408,   405,   402,   399,   396,   393,   390,
+		  387,   384,   381,   379,   376,   373,   370,   367,   364,   361,   358,   355,
+		  352,   349,   346,   344,   341,   338,   335,   332,   329,   326,   323,   321,
+		  318,   315,   312,   309,   306,   304,   301,   298,   295,   292,   290,   287,
+		  284,   281,   278,   276,   273,   270,   267,   265,   262,   259,   256,   254,
+		  251,   248,   246,   243,   240,   237,   235,   232,   229,   227,   224,   221,
+		  219,   216,   213,   211,   208,   206,   203,   200,   198,   195,   192,   190,
+		  187,   185,   182,   179,   177,   174,   172,   169,   167,   164,   161,   159,
+		  156,   154,   151,   149,   146,   144,   141,   139,   136,   134,   131,   129,
+		  126,   124,   121,   119,   116,   114,   111,   109,   106,   104,   101,    99,
+		   97,    94,    92,    89,    87,    84,    82,    79,    77,    75,    72,    70,
+		   67,    65,    62,    60,    58,    55,    53,    50,    48,    46,    43,    41,
+		   38,    36,    34,    31,    29,    26,    24,    22,    19,    17,    14,    12,
+		   10,     7,     5,     2,     0,    -2,    -5,    -7,   -10,   -12,   -14,   -17,
+		  -19,   -22,   -24,   -26,   -29,   -31,   -34,   -36,   -38,   -41,   -43,   -46,
+		  -48,   -50,   -53,   -55,   -58,   -60,   -62,   -65,   -67,   -70,   -72,   -75,
+		  -77,   -79,   -82,   -84,   -87,   -89,   -92,   -94,   -97,   -99,  -101,  -104,
+		 -106,  -109,  -111,  -114,  -116,  -119,  -121,  -124,  -126,  -129,  -131,  -134,
+		 -136,  -139,  -141,  -144,  -146,  -149,  -151,  -154,  -156,  -159,  -161,  -164,
+		 -167,  -169,  -172,  -174,  -177,  -179,  -182,  -185,  -187,  -190,  -192,  -195,
+		 -198,  -200,  -203,  -206,  -208,  -211,  -213,  -216,  -219,  -221,  -224,  -227,
+		 -229,  -232,  -235,  -237,  -240,  -243,  -246,  -248,  -251,  -254,  -256,  -259,
+		 -262,  -265,  -267,  -270,  -273,  -276,  -278,  -281,  -284,  -287,  -290,  -292,
+		 -295,  -298,  -301,  -304,  -306,  -309,  -312,  -315,  -318,  -321,  -323,  -326,
+		 -329,  -332,  -335,  -338,  -341,  -344,  -346,  -349,  -352,  -355,  -358,  -361,
+		 -364,  -367,  -370,  -373,  -376,  -379,  -381,  -384,  -387,  -390,  -393,  -396,
+		 -399,  -402,  -405,  -408,  -411,  -414,  -417,  -420,  -423,  -426,  -429,  -432,
+		 -435,  -438,  -441,  -444,  -447,  -450,  -453,  -456,  -459,  -462,  -465,  -468,
+		 -471,  -474,  -477,  -481,  -484,  -487,  -490,  -493,  -496,  -499,  -502,  -505,
+		 -508,  -511,  -514,  -517,  -520,  -523,  -526,  -529,  -532,  -536,  -539,  -542,
+		 -545,  -548,  -551,  -554,  -557,  -560,  -563,  -566,  -569,  -572,  -575,  -578,
+		 -581,  -584,  -588,  -591,  -594,  -597,  -600,  -603,  -606,  -609,  -612,  -615,
+		 -618,  -621,  -624,  -627,  -630,  -633,  -636,  -639,  -642,  -645,  -648,  -651,
+		 -654,  -657,  -660,  -663,  -666,  -669,  -672,  -675,  -678,  -681,  -684,  -687,
+		 -690,  -693,  -695,  -698,  -701,  -704,  -707,  -710,  -713,  -716,  -719,  -722,
+		 -724,  -727,  -730,  -733,  -736,  -739,  -741,  -744,  -747,  -750,  -753,  -755,
+		 -758,  -761,  -764,  -767,  -769,  -772,  -775,  -778,  -780,  -783,  -786,  -788,
+		 -791,  -794,  -796,  -799,  -802,  -804,  -807,  -810,  -812,  -815,  -817,  -820,
+		 -823,  -825,  -828,  -830,  -833,  -835,  -838,  -840,  -843,  -845,  -848,  -850,
+		 -853,  -855,  -858,  -860,  -862,  -865,  -867,  -870,  -872,  -874,  -877,  -879,
+		 -881,  -884,  -886,  -888,  -891,  -893,  -895,  -897,  -900,  -902,  -904,  -906,
+		 -909,  -911,  -913,  -915,  -917,  -919,  -922,  -924,  -926,  -928,  -930,  -932,
+		 -934,  -936,  -938,  -940,  -942,  -944,  -946,  -948,  -950,  -952,  -954,  -956,
+		 -958,  -960,  -962,  -964,  -966,  -968,  -969,  -971,  -973,  -975,  -977,  -979,
+		 -980,  -982,  -984,  -986,  -988,  -989,  -991,  -993,  -995,  -996,  -998, -1000,
+		-1001, -1003, -1005, -1006, -1008, -1010, -1011, -1013, -1014, -1016, -1018, -1019,
+		-1021, -1022, -1024, -1025, -1027, -1028, -1030, -1031, -1033, -1034, -1036, -1037,
+		-1039, -1040, -1042, -1043, -1045, -1046, -1047, -1049, -1050, -1052, -1053, -1054,
+		-1056, -1057, -1058, -1060, -1061, -1062, -1064, -1065, -1066, -1068, -1069, -1070,
+		-1071, -1073, -1074, -1075, -1077, -1078, -1079, -1080, -1082, -1083, -1084, -1085,
+		-1086, -1088, -1089, -1090, -1091, -1092, -1094, -1095, -1096, -1097, -1098, -1100,
+		-1101, -1102, -1103, -1104, -1105, -1107, -1108, -1109, -1110, -1111, -1112, -1113,
+		-1115, -1116, -1117, -1118, -1119, -1120, -1121, -1123, -1124, -1125, -1126, -1127,
+		-1128, -1129, -1131, -1132, -1133, -1134, -1135, -1136, -1137, -1138, -1140, -1141,
+		-1142, -1143, -1144, -1145, -1146, -1148, -1149, -1150, -1151, -1152, -1153, -1154,
+		-1156, -1157, -1158, -1159, -1160, -1161, -1163, -1164, -1165, -1166, -1167, -1169,
+		-1170, -1171, -1172, -1173, -1175, -1176, -1177, -1178, -1179, -1181, -1182, -1183,
+		-1184, -1186, -1187, -1188, -1189, -1191, -1192, -1193, -1194, -1196, -1197, -1198,
+		-1200, -1201, -1202, -1204, -1205, -1206, -1208, -1209, -1210, -1212, -1213, -1214,
+		-1216, -1217, -1219, -1220, -1221, -1223, -1224, -1226, -1227, -1228, -1230, -1231,
+		-1233, -1234, -1236, -1237, -1239, -1240, -1241, -1243, -1244, -1246, -1247, -1249,
+		-1251, -1252, -1254, -1255, -1257, -1258, -1260, -1261, -1263, -1264, -1266, -1268,
+		-1269, -1271, -1272, -1274, -1276, -1277, -1279, -1280, -1282, -1284, -1285, -1287,
+		-1289, -1290, -1292, -1294, -1295, -1297, -1299, -1300, -1302, -1304, -1305, -1307,
+		-1309, -1310, -1312, -1314, -1316, -1317, -1319, -1321, -1323, -1324, -1326, -1328,
+		-1329, -1331, -1333, -1335, -1336, -1338, -1340, -1342, -1343, -1345, -1347, -1349,
+		-1350, -1352, -1354, -1356, -1357, -1359, -1361, -1363, -1364, -1366, -1368, -1370,
+		-1371, -1373, -1375, -1377, -1378, -1380, -1382, -1384, -1385, -1387, -1389, -1390,
+		-1392, -1394, -1395, -1397, -1399, -1401, -1402, -1404, -1406, -1407, -1409, -1410,
+		-1412, -1414, -1415, -1417, -1419, -1420, -1422, -1423, -1425, -1426, -1428, -1430,
+		-1431, -1433, -1434, -1436, -1437, -1439, -1440, -1441, -1443, -1444, -1446, -1447,
+		-1449, -1450, -1451, -1453, -1454, -1455, -1457, -1458, -1459, -1460, -1462, -1463,
+		-1464, -1465, -1466, -1468, -1469, -1470, -1471, -1472, -1473, -1474, -1475, -1476,
+		-1477, -1478, -1479, -1480, -1481, -1482, -1482, -1483, -1484, -1485, -1486, -1486,
+		-1487, -1488, -1488, -1489, -1490, -1490, -1491, -1491, -1492, -1492, -1493, -1493,
+		-1494, -1494, -1494, -1495, -1495, -1495, -1496, -1496, -1496, -1496, -1496, -1496,
+		-1496, -1496, -1496, -1496, -1496, -1496, -1496, -1496, -1496, -1495, -1495, -1495,
+		-1494, -1494, -1494, -1493, -1493, -1492, -1492, -1491, -1490, -1490, -1489, -1488,
+		-1488, -1487, -1486, -1485, -1484, -1483, -1482, -1481, -1480, -1479, -1478, -1477,
+		-1475, -1474, -1473, -1471, -1470, -1469, -1467, -1466, -1464, -1462, -1461, -1459,
+		-1457, -1456, -1454, -1452, -1450, -1448, -1446, -1444, -1442, -1440, -1438, -1435,
+		-1433, -1431, -1429, -1426, -1424, -1421, -1419, -1416, -1414, -1411, -1408, -1405,
+		-1403, -1400, -1397, -1394, -1391, -1388, -1385, -1382, -1379, -1375, -1372, -1369,
+		-1365, -1362, -1358, -1355, -1351, -1348, -1344, -1340, -1337, -1333, -1329, -1325,
+		-1321, -1317, -1313, -1309, -1305, -1301, -1297, -1292, -1288, -1284, -1279, -1275,
+		-1270, -1266, -1261, -1256, -1252, -1247, -1242, -1237, -1232, -1227, -1222, -1217,
+		-1212, -1207, -1202, -1197, -1191, -1186, -1180, -1175, -1170, -1164, -1158, -1153,
+		-1147, -1141, -1136, -1130, -1124, -1118, -1112, -1106, -1100, -1094, -1088, -1082,
+		-1076, -1069, -1063, -1057, -1050, -1044, -1037, -1031, -1024, -1017, -1011, -1004,
+		 -997,  -991,  -984,  -977,  -970,  -963,  -956,  -949,  -942,  -935,  -927,  -920,
+		 -913,  -906,  -898,  -891,  -884,  -876,  -869,  -861,  -854,  -846,  -838,  -831,
+		 -823,  -815,  -807,  -799,  -792,  -784,  -776,  -768,  -760,  -752,  -744,  -736,
+		 -727,  -719,  -711,  -703,  -694,  -686,  -678,  -669,  -661,  -653,  -644,  -636,
+		 -627,  -619,  -610,  -601,  -593,  -584,  -575,  -567,  -558,  -549,  -540,  -531,
+		 -523,  -514,  -505,  -496,  -487,  -478,  -469,  -460,  -451,  -442,  -433,  -424,
+		 -415,  -405,  -396,  -387,  -378,  -369,  -359,  -350,  -341,  -332,  -322,  -313,
+		 -304,  -294,  -285,  -276,  -266,  -257,  -247,  -238,  -229,  -219,  -210,  -200,
+		 -191,  -181,  -172,  -162,  -153,  -143,  -134,  -124,  -115,  -105,   -96,   -86,
+		  -77,   -67,   -57,   -48,   -38,   -29,   -19,   -10,     0,
+	},
+#if MAX_NOTES > 48
+	// Piano level 7
+	{
+		    0,     5,     9,    14,    18,    23,    28,    32,    37,    42,    46,    51,
+		   55,    60,    65,    69,    74,    78,    83,    88,    92,    97,   101,   106,
+		  111,   115,   120,   124,   129,   134,   138,   143,   147,   152,   156,   161,
+		  166,   170,   175,   179,   184,   188,   193,   197,   202,   207,   211,   216,
+		  220,   225,   229,   234,   238,   243,   247,   252,   256,   261,   265,   270,
+		  274,   279,   283,   288,   292,   297,   301,   306,   310,   314,   319,   323,
+		  328,   332,   337,   341,   345,   350,   354,   359,   363,   367,   372,   376,
+		  380,   385,   389,   394,   398,   402,   407,   411,   415,   419,   424,   428,
+		  432,   437,   441,   445,   449,   454,   458,   462,   466,   471,   475,   479,
+		  483,   488,   492,   496,   500,   504,   508,   513,   517,   521,   525,   529,
+		  533,   537,   541,   545,   550,   554,   558,   562,   566,   570,   574,   578,
+		  582,   586,   590,   594,   598,   602,   606,   610,   614,   618,   621,   625,
+		  629,   633,   637,   641,   645,   649,   652,   656,   660,   664,   668,   672,
+		  675,   679,   683,   687,   690,   694,   698,   701,   705,   709,   713,   716,
+		  720,   724,   727,   731,   734,   738,   742,   745,   749,   752,   756,   759,
+		  763,   766,   770,   773,   777,   780,   784,   787,   791,   794,   797,   801,
+		  804,   808,   811,   814,   818,   821,   824,   828,   831,   834,   837,   841,
+		  844,   847,   850,   854,   857,   860,   863,   866,   869,   872,   876,   879,
+		  882,   885,   888,   891,   894,   897,   900,   903,   906,   909,   912,   915,
+		  918,   921,   924,   926,   929,   932,   935,   938,   941,   943,   946,   949,
+		  952,   955,   957,   960,   963,   965,   968,   971,   973,   976,   979,   981,
+		  984,   987,   989,   992,   994,   997,   999,  1002,  1004,  1007,  1009,  1012,
+		 1014,  1016,  1019,  1021,  1024,  1026,  1028,  1031,  1033,  1035,  1038,  1040,
+		 1042,  1044,  1047,  1049,  1051,  1053,  1055,  1058,  1060,  1062,  1064,  1066,
+		 1068,  1070,  1072,  1074,  1076,  1078,  1080,  1082,  1084,  1086,  1088,  1090,
+		 1092,  1094,  1096,  1098,  1099,  1101,  1103,  1105,  1107,  1108,  1110,  1112,
+		 1114,  1115,  1117,  1119,  1120,  1122,  1124,  1125,  1127,  1129,  1130,  1132,
+		 1133,  1135,  1136,  1138,  1139,  1141,  1142,  1144,  1145,  1147,  1148,  1149,
+		 1151,  1152,  1153,  1155,  1156,  1157,  1159,  1160,  1161,  1162,  1164,  1165,
+		 1166,  1167,  1168,  1169,  1171,  1172,  1173,  1174,  1175,  1176,  1177,  1178,
+		 1179,  1180,  1181,  1182,  1183,  1184,  1185,  1186,  1187,  1187,  1188,  1189,
+		 1190,  1191,  1192,  1192,  1193,  1194,  1195,  1195,  1196,  1197,  1198,  1198,
+		 1199,  1199,  1200,  1201,  1201,  1202,  1202,  1203,  1204,  1204,  1205,  1205,
+		 1206,  1206,  1206,  1207,  1207,  1208,  1208,  1209,  1209,  1209,  1210,  1210,
+		 1210,  1211,  1211,  1211,  1211,  1212,  1212,  1212,  1212,  1212,  1213,  1213,
+		 1213,  1213,  1213,  1213,  1213,  1213,  1213,  1213,  1213,  1213,  1213,  1213,
+		 1213,  1213,  1213,  1213,  1213,  1213,  1213,  1213,  1213,  1213,  1212,  1212,
+		 1212,  1212,  1212,  1211,  1211,  1211,  1211,  1210,  1210,  1210,  1209,  1209,
+		 1209,  1208,  1208,  1208,  1207,  1207,  1206,  1206,  1206,  1205,  1205,  1204,
+		 1204,  1203,  1203,  1202,  1202,  1201,  1200,  1200,  1199,  1199,  1198,  1197,
+		 1197,  1196,  1195,  1195,  1194,  1193,  1193,  1192,  1191,  1190,  1190,  1189,
+		 1188,  1187,  1186,  1186,  1185,  1184,  1183,  1182,  1181,  1180,  1179,  1178,
+		 1178,  1177,  1176,  1175,  1174,  1173,  1172,  1171,  1170,  1169,  1168,  1167,
+		 1166,  1164,  1163,  1162,  1161,  1160,  1159,  1158,  1157,  1155,  1154,  1153,
+		 1152,  1151,  1150,  1148,  1147,  1146,  1145,  1143,  1142,  1141,  1139,  1138,
+		 1137,  1136,  1134,  1133,  1131,  1130,  1129,  1127,  1126,  1125,  1123,  1122,
+		 1120,  1119,  1117,  1116,  1115,  1113,  1112,  1110,  1109,  1107,  1106,  1104,
+		 1102,  1101,  1099,  1098,  1096,  1095,  1093,  1091,  1090,  1088,  1087,  1085,
+		 1083,  1082,  1080,  1078,  1077,  1075,  1073,  1072,  1070,  1068,  1066,  1065,
+		 1063,  1061,  1059,  1058,  1056,  1054,  1052,  1051,  1049,  1047,  1045,  1043,
+		 1041,  1040,  1038,  1036,  1034,  1032,  1030,  1028,  1027,  1025,  1023,  1021,
+		 1019,  1017,  1015,  1013,  1011,  1009,  1007,  1005,  1003,  1001,   999,   997,
+		  995,   993,   991,   989,   987,   985,   983,   981,   979,   977,   975,   973,
+		  971,   969,   967,   965,   963,   960,   958,   956,   954,   952,   950,   948,
+		  946,   943,   941,   939,   937,   935,   933,   930,   928,   926,   924,   922,
+		  919,   917,   915,   913,   911,   908,   906,   904,   902,   899,   897,   895,
+		  893,   890,   888,   886,   884,   881,   879,   877,   874,   872,   870,   868,
+		  865,   863,   861,   858,   856,   854,   851,   849,   847,   844,   842,   840,
+		  837,   835,   832,   830,   828,   825,   823,   821,   818,   816,   813,   811,
+		  809,   806,   804,   801,   799,   797,   794,   792,   789,   787,   784,   782,
+		  780,   777,   775,   772,   770,   767,   765,   763,   760,   758,   755,   753,
+		  750,   748,   745,   743,   740,   738,   735,   733,   730,   728,   725,   723,
+		  720,   718,   715,   713,   710,   708,   705,   703,   700,   698,   695,   693,
+		  690,   688,   685,   683,   680,   678,   675,   673,   670,   668,   665,   663,
+		  660,   657,   655,   652,   650,   647,   645,   642,   640,   637,   635,   632,
+		  629,   627,   624,   622,   619,   617,   614,   612,   609,   606,   604,   601,
+		  599,   596,   594,   591,   588,   586,   583,   581,   578,   576,   573,   570,
+		  568,   565,   563,   560,   558,   555,   552,   550,   547,   545,   542,   539,
+		  537,   534,   532,   529,   527,   524,   521,   519,   516,   514,   511,   508,
+		  506,   503,   501,   498,   495,   493,   490,   488,   485,   483,   480,   477,
+		  475,   472,   470,   467,   464,   462,   459,   457,   454,   451,   449,   446,
+		  444,   441,   438,   436,   433,   431,   428,   425,   423,   420,   418,   415,
+		  412,   410,   407,   405,   402,   399,   397,   394,   392,   389,   387,   384,
+		  381,   379,   376,   374,   371,   368,   366,   363,   361,   358,   355,   353,
+		  350,   348,   345,   342,   340,   337,   335,   332,   329,   327,   324,   322,
+		  319,   317,   314,   311,   309,   306,   304,   301,   298,   296,   293,   291,
+		  288,   285,   283,   280,   278,   275,   273,   270,   267,   265,   262,   260,
+		  257,   254,   252,   249,   247,   244,   242,   239,   236,   234,   231,   229,
+		  226,   223,   221,   218,   216,   213,   211,   208,   205,   203,   200,   198,
+		  195,   193,   190,   187,   185,   182,   180,   177,   175,   172,   169,   167,
+		  164,   162,   159,   157,   154,   151,   149,   146,   144,   141,   139,   136,
+		  133,   131,   128,   126,   123,   121,   118,   115,   113,   110,   108,   105,
+		  103,   100,    97,    95,    92,    90,    87,    85,    82,    79,    77,    74,
+		   72,    69,    67,    64,    62,    59,    56,    54,    51,    49,    46,    44,
+		   41,    38,    36,    33,    31,    28,    26,    23,    21,    18,    15,    13,
+		   10,     8,     5,     3,     0,    -3,    -5,    -8,   -10,   -13,   -15,   -18,
+		  -21,   -23,   -26,   -28,   -31,   -33,   -36,   -38,   -41,   -44,   -46,   -49,
+		  -51,   -54,   -56,   -59,   -62,   -64,   -67,   -69,   -72,   -74,   -77,   -79,
+		  -82,   -85,   -87,   -90,   -92,   -95,   -97,  -100,  -103,  -105,  -108,  -110,
+		 -113,  -115,  -118,  -121,  -123,  -126,  -128,  -131,  -133,  -136,  -139,  -141,
+		 -144,  -146,  -149,  -151,  -154,  -157,  -159,  -162,  -164,  -167,  -169,  -172,
+		 -175,  -177,  -180,  -182,  -185,  -187,  -190,  -193,  -195,  -198,  -200,  -203,
+		 -205,  -208,  -211,  -213,  -216,  -218,  -221,  -223,  -226,  -229,  -231,  -234,
+		 -236,  -239,  -242,  -244,  -247,  -249,  -252,  -254,  -257,  -260,  -262,  -265,
+		 -267,  -270,  -273,  -275,  -278,  -280,  -283,  -285,  -288,  -291,  -293,  -296,
+		 -298,  -301,  -304,  -306,  -309,  -311,  -314,  -317,  -319,  -322,  -324,  -327,
+		 -329,  -332,  -335,  -337,  -340,  -342,  -345,  -348,  -350,  -353,  -355,  -358,
+		 -361,  -363,  -366,  -368,  -371,  -374,  -376,  -379,  -381,  -384,  -387,  -389,
+		 -392,  -394,  -397,  -399,  -402,  -405,  -407,  -410,  -412,  -415,  -418,  -420,
+		 -423,  -425,  -428,  -431,  -433,  -436,  -438,  -441,  -444,  -446,  -449,  -451,
+		 -454,  -457,  -459,  -462,  -464,  -467,  -470,  -472,  -475,  -477,  -480,  -483,
+		 -485,  -488,  -490,  -493,  -495,  -498,  -501,  -503,  -506,  -508,  -511,  -514,
+		 -516,  -519,  -521,  -524,  -527,  -529,  -532,  -534,  -537,  -539,  -542,  -545,
+		 -547,  -550,  -552,  -555,  -558,  -560,  -563,  -565,  -568,  -570,  -573,  -576,
+		 -578,  -581,  -583,  -586,  -588,  -591,  -594,  -596,  -599,  -601,  -604,  -606,
+		 -609,  -612,  -614,  -617,  -619,  -622,  -624,  -627,  -629,  -632,  -635,  -637,
+		 -640,  -642,  -645,  -647,  -650,  -652,  -655,  -657,  -660,  -663,  -665,  -668,
+		 -670,  -673,  -675,  -678,  -680,  -683,  -685,  -688,  -690,  -693,  -695,  -698,
+		 -700,  -703,  -705,  -708,  -710,  -713,  -715,  -718,  -720,  -723,  -725,  -728,
+		 -730,  -733,  -735,  -738,  -740,  -743,  -745,  -748,  -750,  -753,  -755,  -758,
+		 -760,  -763,  -765,  -767,  -770,  -772,  -775,  -777,  -780,  -782,  -784,  -787,
+		 -789,  -792,  -794,  -797,  -799,  -801,  -804,  -806,  -809,  -811,  -813,  -816,
+		 -818,  -821,  -823,  -825,  -828,  -830,  -832,  -835,  -837,  -840,  -842,  -844,
+		 -847,  -849,  -851,  -854,  -856,  -858,  -861,  -863,  -865,  -868,  -870,  -872,
+		 -874,  -877,  -879,  -881,  -884,  -886,  -888,  -890,  -893,  -895,  -897,  -899,
+		 -902,  -904,  -906,  -908,  -911,  -913,  -915,  -917,  -919,  -922,  -924,  -926,
+		 -928,  -930,  -933,  -935,  -937,  -939,  -941,  -943,  -946,  -948,  -950,  -952,
+		 -954,  -956,  -958,  -960,  -963,  -965,  -967,  -969,  -971,  -973,  -975,  -977,
+		 -979,  -981,  -983,  -985,  -987,  -989,  -991,  -993,  -995,  -997,  -999, -1001,
+		-1003, -1005, -1007, -1009, -1011, -1013, -1015, -1017, -1019, -1021, -1023, -1025,
+		-1027, -1028, -1030, -1032, -1034, -1036, -1038, -1040, -1041, -1043, -1045, -1047,
+		-1049, -1051, -1052, -1054, -1056, -1058, -1059, -1061, -1063, -1065, -1066, -1068,
+		-1070, -1072, -1073, -1075, -1077, -1078, -1080, -1082, -1083, -1085, -1087, -1088,
+		-1090, -1091, -1093, -1095, -1096, -1098, -1099, -1101, -1102, -1104, -1106, -1107,
+		-1109, -1110, -1112, -1113, -1115, -1116, -1117, -1119, -1120, -1122, -1123, -1125,
+		-1126, -1127, -1129, -1130, -1131, -1133, -1134, -1136, -1137, -1138, -1139, -1141,
+		-1142, -1143, -1145, -1146, -1147, -1148, -1150, -1151, -1152, -1153, -1154, -1155,
+		-1157, -1158, -1159, -1160, -1161, -1162, -1163, -1164, -1166, -1167, -1168, -1169,
+		-1170, -1171, -1172, -1173, -1174, -1175, -1176, -1177, -1178, -1178, -1179, -1180,
+		-1181, -1182, -1183, -1184, -1185, -1186, -1186, -1187, -1188, -1189, -1190, -1190,
+		-1191, -1192, -1193, -1193, -1194, -1195, -1195, -1196, -1197, -1197, -1198, -1199,
+		-1199, -1200, -1200, -1201, -1202, -1202, -1203, -1203, -1204, -1204, -1205, -1205,
+		-1206, -1206, -1206, -1207, -1207, -1208, -1208, -1208, -1209, -1209, -1209, -1210,
+		-1210, -1210, -1211, -1211, -1211, -1211, -1212, -1212, -1212, -1212, -1212, -1213,
+		-1213, -1213, -1213, -1213, -1213, -1213, -1213, -1213, -1213, -1213, -1213, -1213,
+		-1213, -1213, -1213, -1213, -1213, -1213, -1213, -1213, -1213, -1213, -1213, -1212,
+		-1212, -1212, -1212, -1212, -1211, -1211, -1211, -1211, -1210, -1210, -1210, -1209,
+		-1209, -1209, -1208, -1208, -1207, -1207, -1206, -1206, -1206, -1205, -1205, -1204,
+		-1204, -1203, -1202, -1202, -1201, -1201, -1200, -1199, -1199, -1198, -1198, -1197,
+		-1196, -1195, -1195, -1194, -1193, -1192, -1192, -1191, -1190, -1189, -1188, -1187,
+		-1187, -1186, -1185, -1184, -1183, -1182, -1181, -1180, -1179, -1178, -1177, -1176,
+		-1175, -1174, -1173, -1172, -1171, -1169, -1168, -1167, -1166, -1165, -1164, -1162,
+		-1161, -1160, -1159, -1157, -1156, -1155, -1153, -1152, -1151, -1149, -1148, -1147,
+		-1145, -1144, -1142, -1141, -1139, -1138, -1136, -1135, -1133, -1132, -1130, -1129,
+		-1127, -1125, -1124, -1122, -1120, -1119, -1117, -1115, -1114, -1112, -1110, -1108,
+		-1107, -1105, -1103, -1101, -1099, -1098, -1096, -1094, -1092, -1090, -1088, -1086,
+		-1084, -1082, -1080, -1078, -1076, -1074, -1072, -1070, -1068, -1066, -1064, -1062,
+		-1060, -1058, -1055, -1053, -1051, -1049, -1047, -1044, -1042, -1040, -1038, -1035,
+		-1033, -1031, -1028, -1026, -1024, -1021, -1019, -1016, -1014, -1012, -1009, -1007,
+		-1004, -1002,  -999,  -997,  -994,  -992,  -989,  -987,  -984,  -981,  -979,  -976,
+		 -973,  -971,  -968,  -965,  -963,  -960,  -957,  -955,  -952,  -949,  -946,  -943,
+		 -941,  -938,  -935,  -932,  -929,  -926,  -924,  -921,  -918,  -915,  -912,  -909,
+		 -906,  -903,  -900,  -897,  -894,  -891,  -888,  -885,  -882,  -879,  -876,  -872,
+		 -869,  -866,  -863,  -860,  -857,  -854,  -850,  -847,  -844,  -841,  -837,  -834,
+		 -831,  -828,  -824,  -821,  -818,  -814,  -811,  -808,  -804,  -801,  -797,  -794,
+		 -791,  -787,  -784,  -780,  -777,  -773,  -770,  -766,  -763,  -759,  -756,  -752,
+		 -749,  -745,  -742,  -738,  -734,  -731,  -727,  -724,  -720,  -716,  -713,  -709,
+		 -705,  -701,  -698,  -694,  -690,  -687,  -683,  -679,  -675,  -672,  -668,  -664,
+		 -660,  -656,  -652,  -649,  -645,  -641,  -637,  -633,  -629,  -625,  -621,  -618,
+		 -614,  -610,  -606,  -602,  -598,  -594,  -590,  -586,  -582,  -578,  -574,  -570,
+		 -566,  -562,  -558,  -554,  -550,  -545,  -541,  -537,  -533,  -529,  -525,  -521,
+		 -517,  -513,  -508,  -504,  -500,  -496,  -492,  -488,  -483,  -479,  -475,  -471,
+		 -466,  -462,  -458,  -454,  -449,  -445,  -441,  -437,  -432,  -428,  -424,  -419,
+		 -415,  -411,  -407,  -402,  -398,  -394,  -389,  -385,  -380,  -376,  -372,  -367,
+		 -363,  -359,  -354,  -350,  -345,  -341,  -337,  -332,  -328,  -323,  -319,  -314,
+		 -310,  -306,  -301,  -297,  -292,  -288,  -283,  -279,  -274,  -270,  -265,  -261,
+		 -256,  -252,  -247,  -243,  -238,  -234,  -229,  -225,  -220,  -216,  -211,  -207,
+		 -202,  -197,  -193,  -188,  -184,  -179,  -175,  -170,  -166,  -161,  -156,  -152,
+		 -147,  -143,  -138,  -134,  -129,  -124,  -120,  -115,  -111,  -106,  -101,   -97,
+		  -92,   -88,   -83,   -78,   -74,   -69,   -65,   -60,   -55,   -51,   -46,   -42,
+		  -37,   -32,   -28,   -23,   -18,   -14,    -9,    -5,     0,
+	},
+	// Bright level 7
+	{
+		    0,     5,    10,    15,    19,    24,    29,    34,    39,    44,    48,    53,
+		   58,    63,    68,    73,    77,    82,    87,    92,    97,   102,   106,   111,
+		  116,   121,   126,   131,   135,   140,   145,   150,   155,   159,   164,   169,
+		  174,   179,   183,   188,   193,   198,   202,   207,   212,   217,   221,   226,
+		  231,   236,   240,   245,   250,   255,   259,   264,   269,   273,   278,   283,
+		  288,   292,   297,   302,   306,   311,   316,   320,   325,   330,   334,   339,
+		  343,   348,   353,   357,   362,   367,   371,   376,   380,   385,   389,   394,
+		  399,   403,   408,   412,   417,   421,   426,   430,   435,   439,   444,   448,
+		  453,   457,   461,   466,   470,   475,   479,   484,   488,   492,   497,   501,
+		  505,   510,   514,   518,   523,   527,   531,   536,   540,   544,   549,   553,
+		  557,   561,   566,   570,   574,   578,   582,   587,   591,   595,   599,   603,
+		  607,   611,   615,   620,   624,   628,   632,   636,   640,   644,   648,   652,
+		  656,   660,   664,   668,   672,   676,   680,   684,   688,   691,   695,   699,
+		  703,   707,   711,   715,   718,   722,   726,   730,   733,   737,   741,   745,
+		  748,   752,   756,   759,   763,   767,   770,   774,   778,   781,   785,   788,
+		  792,   795,   799,   802,   806,   809,   813,   816,   820,   823,   827,   830,
+		  834,   837,   840,   844,   847,   850,   854,   857,   860,   863,   867,   870,
+		  873,   876,   879,   883,   886,   889,   892,   895,   898,   901,   904,   908,
+		  911,   914,   917,   920,   923,   926,   929,   931,   934,   937,   940,   943,
+		  946,   949,   952,   954,   957,   960,   963,   966,   968,   971,   974,   976,
+		  979,   982,   984,   987,   990,   992,   995,   997,  1000,  1002,  1005,  1007,
+		 1010,  1012,  1015,  1017,  1020,  1022,  1024,  1027,  1029,  1032,  1034,  1036,
+		 1038,  1041,  1043,  1045,  1047,  1050,  1052,  1054,  1056,  1058,  1060,  1063,
+		 1065,  1067,  1069,  1071,  1073,  1075,  1077,  1079,  1081,  1083,  1085,  1087,
+		 1088,  1090,  1092,  1094,  1096,  1098,  1099,  1101,  1103,  1105,  1106,  1108,
+		 1110,  1111,  1113,  1115,  1116,  1118,  1120,  1121,  1123,  1124,  1126,  1127,
+		 1129,  1130,  1132,  1133,  1135,  1136,  1137,  1139,  1140,  1141,  1143,  1144,
+		 1145,  1147,  1148,  1149,  1150,  1152,  1153,  1154,  1155,  1156,  1157,  1158,
+		 1159,  1161,  1162,  1163,  1164,  1165,  1166,  1167,  1168,  1168,  1169,  1170,
+		 1171,  1172,  1173,  1174,  1175,  1175,  1176,  1177,  1178,  1178,  1179,  1180,
+		 1180,  1181,  1182,  1182,  1183,  1184,  1184,  1185,  1185,  1186,  1186,  1187,
+		 1187,  1188,  1188,  1189,  1189,  1190,  1190,  1190,  1191,  1191,  1191,  1192,
+		 1192,  1192,  1193,  1193,  1193,  1193,  1194,  1194,  1194,  1194,  1194,  1194,
+		 1194,  1194,  1195,  1195,  1195,  1195,  1195,  1195,  1195,  1195,  1195,  1195,
+		 1195,  1194,  1194,  1194,  1194,  1194,  1194,  1194,  1193,  1193,  1193,  1193,
+		 1192,  1192,  1192,  1192,  1191,  1191,  1191,  1190,  1190,  1189,  1189,  1189,
+		 1188,  1188,  1187,  1187,  1186,  1186,  1185,  1185,  1184,  1184,  1183,  1183,
+		 1182,  1181,  1181,  1180,  1179,  1179,  1178,  1177,  1177,  1176,  1175,  1174,
+		 1174,  1173,  1172,  1171,  1171,  1170,  1169,  1168,  1167,  1166,  1165,  1164,
+		 1164,  1163,  1162,  1161,  1160,  1159,  1158,  1157,  1156,  1155,  1154,  1153,
+		 1152,  1150,  1149,  1148,  1147,  1146,  1145,  1144,  1143,  1141,  1140,  1139,
+		 1138,  1137,  1135,  1134,  1133,  1132,  1130,  1129,  1128,  1126,  1125,  1124,
+		 1122,  1121,  1120,  1118,  1117,  1115,  1114,  1113,  1111,  1110,  1108,  1107,
+		 1105,  1104,  1102,  1101,  1099,  1098,  1096,  1095,  1093,  1092,  1090,  1089,
+		 1087,  1085,  1084,  1082,  1081,  1079,  1077,  1076,  1074,  1072,  1071,  1069,
+		 1067,  1065,  1064,  1062,  1060,  1058,  1057,  1055,  1053,  1051,  1050,  1048,
+		 1046,  1044,  1042,  1041,  1039,  1037,  1035,  1033,  1031,  1029,  1028,  1026,
+		 1024,  1022,  1020,  1018,  1016,  1014,  1012,  1010,  1008,  1006,  1004,  1002,
+		 1000,   998,   996,   994,   992,   990,   988,   986,   984,   982,   980,   978,
+		  976,   974,   972,   970,   968,   966,   963,   961,   959,   957,   955,   953,
+		  951,   949,   946,   944,   942,   940,   938,   936,   933,   931,   929,   927,
+		  925,   922,   920,   918,   916,   914,   911,   909,   907,   905,   902,   900,
+		  898,   896,   893,   891,   889,   887,   884,   882,   880,   877,   875,   873,
+		  870,   868,   866,   864,   861,   859,   857,   854,   852,   850,   847,   845,
+		  843,   840,   838,   836,   833,   831,   828,   826,   824,   821,   819,   817,
+		  814,   812,   809,   807,   805,   802,   800,   797,   795,   793,   790,   788,
+		  785,   783,   781,   778,   776,   773,   771,   769,   766,   764,   761,   759,
+		  757,   754,   752,   749,   747,   744,   742,   740,   737,   735,   732,   730,
+		  727,   725,   722,   720,   718,   715,   713,   710,   708,   705,   703,   700,
+		  698,   696,   693,   691,   688,   686,   683,   681,   678,   676,   674,   671,
+		  669,   666,   664,   661,   659,   656,   654,   652,   649,   647,   644,   642,
+		  639,   637,   634,   632,   630,   627,   625,   622,   620,   617,   615,   612,
+		  610,   608,   605,   603,   600,   598,   595,   593,   591,   588,   586,   583,
+		  581,   578,   576,   574,   571,   569,   566,   564,   561,   559,   557,   554,
+		  552,   549,   547,   545,   542,   540,   537,   535,   533,   530,   528,   525,
+		  523,   521,   518,   516,   513,   511,   509,   506,   504,   502,   499,   497,
+		  494,   492,   490,   487,   485,   483,   480,   478,   476,   473,   471,   468,
+		  466,   464,   461,   459,   457,   454,   452,   450,   447,   445,   443,   440,
+		  438,   436,   433,   431,   429,   427,   424,   422,   420,   417,   415,   413,
+		  410,   408,   406,   404,   401,   399,   397,   394,   392,   390,   388,   385,
+		  383,   381,   378,   376,   374,   372,   369,   367,   365,   363,   360,   358,
+		  356,   354,   352,   349,   347,   345,   343,   340,   338,   336,   334,   332,
+		  329,   327,   325,   323,   320,   318,   316,   314,   312,   310,   307,   305,
+		  303,   301,   299,   296,   294,   292,   290,   288,   286,   283,   281,   279,
+		  277,   275,   273,   271,   268,   266,   264,   262,   260,   258,   256,   253,
+		  251,   249,   247,   245,   243,   241,   239,   236,   234,   232,   230,   228,
+		  226,   224,   222,   220,   218,   215,   213,   211,   209,   207,   205,   203,
+		  201,   199,   197,   195,   193,   191,   188,   186,   184,   182,   180,   178,
+		  176,   174,   172,   170,   168,   166,   164,   162,   160,   158,   156,   154,
+		  152,   150,   148,   145,   143,   141,   139,   137,   135,   133,   131,   129,
+		  127,   125,   123,   121,   119,   117,   115,   113,   111,   109,   107,   105,
+		  103,   101,    99,    97,    95,    93,    91,    89,    87,    85,    83,    81,
+		   79,    77,    75,    73,    71,    69,    67,    65,    63,    61,    59,    57,
+		   55,    53,    51,    49,    47,    45,    43,    41,    40,    38,    36,    34,
+		   32,    30,    28,    26,    24,    22,    20,    18,    16,    14,    12,    10,
+		    8,     6,     4,     2,     0,    -2,    -4,    -6,    -8,   -10,   -12,   -14,
+		  -16,   -18,   -20,   -22,   -24,   -26,   -28,   -30,   -32,   -34,   -36,   -38,
+		  -40,   -41,   -43,   -45,   -47,   -49,   -51,   -53,   -55,   -57,   -59,   -61,
+		  -63,   -65,   -67,   -69,   -71,   -73,   -75,   -77,   -79,   -81,   -83,   -85,
+		  -87,   -89,   -91,   -93,   -95,   -97,   -99,  -101,  -103,  -105,  -107,  -109,
+		 -111,  -113,  -115,  -117,  -119,  -121,  -123,  -125,  -127,  -129,  -131,  -133,
+		 -135,  -137,  -139,  -141,  -143,  -145,  -148,  -150,  -152,  -154,  -156,  -158,
+		 -160,  -162,  -164,  -166,  -168,  -170,  -172,  -174,  -176,  -178,  -180,  -182,
+		 -184,  -186,  -188,  -191,  -193,  -195,  -197,  -199,  -201,  -203,  -205,  -207,
+		 -209,  -211,  -213,  -215,  -218,  -220,  -222,  -224,  -226,  -228,  -230,  -232,
+		 -234,  -236,  -239,  -241,  -243,  -245,  -247,  -249,  -251,  -253,  -256,  -258,
+		 -260,  -262,  -264,  -266,  -268,  -271,  -273,  -275,  -277,  -279,  -281,  -283,
+		 -286,  -288,  -290,  -292,  -294,  -296,  -299,  -301,  -303,  -305,  -307,  -310,
+		 -312,  -314,  -316,  -318,  -320,  -323,  -325,  -327,  -329,  -332,  -334,  -336,
+		 -338,  -340,  -343,  -345,  -347,  -349,  -352,  -354,  -356,  -358,  -360,  -363,
+		 -365,  -367,  -369,  -372,  -374,  -376,  -378,  -381,  -383,  -385,  -388,  -390,
+		 -392,  -394,  -397,  -399,  -401,  -404,  -406,  -408,  -410,  -413,  -415,  -417,
+		 -420,  -422,  -424,  -427,  -429,  -431,  -433,  -436,  -438,  -440,  -443,  -445,
+		 -447,  -450,  -452,  -454,  -457,  -459,  -461,  -464,  -466,  -468,  -471,  -473,
+		 -476,  -478,  -480,  -483,  -485,  -487,  -490,  -492,  -494,  -497,  -499,  -502,
+		 -504,  -506,  -509,  -511,  -513,  -516,  -518,  -521,  -523,  -525,  -528,  -530,
+		 -533,  -535,  -537,  -540,  -542,  -545,  -547,  -549,  -552,  -554,  -557,  -559,
+		 -561,  -564,  -566,  -569,  -571,  -574,  -576,  -578,  -581,  -583,  -586,  -588,
+		 -591,  -593,  -595,  -598,  -600,  -603,  -605,  -608,  -610,  -612,  -615,  -617,
+		 -620,  -622,  -625,  -627,  -630,  -632,  -634,  -637,  -639,  -642,  -644,  -647,
+		 -649,  -652,  -654,  -656,  -659,  -661,  -664,  -666,  -669,  -671,  -674,  -676,
+		 -678,  -681,  -683,  -686,  -688,  -691,  -693,  -696,  -698,  -700,  -703,  -705,
+		 -708,  -710,  -713,  -715,  -718,  -720,  -722,  -725,  -727,  -730,  -732,  -735,
+		 -737,  -740,  -742,  -744,  -747,  -749,  -752,  -754,  -757,  -759,  -761,  -764,
+		 -766,  -769,  -771,  -773,  -776,  -778,  -781,  -783,  -785,  -788,  -790,  -793,
+		 -795,  -797,  -800,  -802,  -805,  -807,  -809,  -812,  -814,  -817,  -819,  -821,
+		 -824,  -826,  -828,  -831,  -833,  -836,  -838,  -840,  -843,  -845,  -847,  -850,
+		 -852,  -854,  -857,  -859,  -861,  -864,  -866,  -868,  -870,  -873,  -875,  -877,
+		 -880,  -882,  -884,  -887,  -889,  -891,  -893,  -896,  -898,  -900,  -902,  -905,
+		 -907,  -909,  -911,  -914,  -916,  -918,  -920,  -922,  -925,  -927,  -929,  -931,
+		 -933,  -936,  -938,  -940,  -942,  -944,  -946,  -949,  -951,  -953,  -955,  -957,
+		 -959,  -961,  -963,  -966,  -968,  -970,  -972,  -974,  -976,  -978,  -980,  -982,
+		 -984,  -986,  -988,  -990,  -992,  -994,  -996,  -998, -1000, -1002, -1004, -1006,
+		-1008, -1010, -1012, -1014, -1016, -1018, -1020, -1022, -1024, -1026, -1028, -1029,
+		-1031, -1033, -1035, -1037, -1039, -1041, -1042, -1044, -1046, -1048, -1050, -1051,
+		-1053, -1055, -1057, -1058, -1060, -1062, -1064, -1065, -1067, -1069, -1071, -1072,
+		-1074, -1076, -1077, -1079, -1081, -1082, -1084, -1085, -1087, -1089, -1090, -1092,
+		-1093, -1095, -1096, -1098, -1099, -1101, -1102, -1104, -1105, -1107, -1108, -1110,
+		-1111, -1113, -1114, -1115, -1117, -1118, -1120, -1121, -1122, -1124, -1125, -1126,
+		-1128, -1129, -1130, -1132, -1133, -1134, -1135, -1137, -1138, -1139, -1140, -1141,
+		-1143, -1144, -1145, -1146, -1147, -1148, -1149, -1150, -1152, -1153, -1154, -1155,
+		-1156, -1157, -1158, -1159, -1160, -1161, -1162, -1163, -1164, -1164, -1165, -1166,
+		-1167, -1168, -1169, -1170, -1171, -1171, -1172, -1173, -1174, -1174, -1175, -1176,
+		-1177, -1177, -1178, -1179, -1179, -1180, -1181, -1181, -1182, -1183, -1183, -1184,
+		-1184, -1185, -1185, -1186, -1186, -1187, -1187, -1188, -1188, -1189, -1189, -1189,
+		-1190, -1190, -1191, -1191, -1191, -1192, -1192, -1192, -1192, -1193, -1193, -1193,
+		-1193, -1194, -1194, -1194, -1194, -1194, -1194, -1194, -1195, -1195, -1195, -1195,
+		-1195, -1195, -1195, -1195, -1195, -1195, -1195, -1194, -1194, -1194, -1194, -1194,
+		-1194, -1194, -1194, -1193, -1193, -1193, -1193, -1192, -1192, -1192, -1191, -1191,
+		-1191, -1190, -1190, -1190, -1189, -1189, -1188, -1188, -1187, -1187, -1186, -1186,
+		-1185, -1185, -1184, -1184, -1183, -1182, -1182, -1181, -1180, -1180, -1179, -1178,
+		-1178, -1177, -1176, -1175, -1175, -1174, -1173, -1172, -1171, -1170, -1169, -1168,
+		-1168, -1167, -1166, -1165, -1164, -1163, -1162, -1161, -1159, -1158, -1157, -1156,
+		-1155, -1154, -1153, -1152, -1150, -1149, -1148, -1147, -1145, -1144, -1143, -1141,
+		-1140, -1139, -1137, -1136, -1135, -1133, -1132, -1130, -1129, -1127, -1126, -1124,
+		-1123, -1121, -1120, -1118, -1116, -1115, -1113, -1111, -1110, -1108, -1106, -1105,
+		-1103, -1101, -1099, -1098, -1096, -1094, -1092, -1090, -1088, -1087, -1085, -1083,
+		-1081, -1079, -1077, -1075, -1073, -1071, -1069, -1067, -1065, -1063, -1060, -1058,
+		-1056, -1054, -1052, -1050, -1047, -1045, -1043, -1041, -1038, -1036, -1034, -1032,
+		-1029, -1027, -1024, -1022, -1020, -1017, -1015, -1012, -1010, -1007, -1005, -1002,
+		-1000,  -997,  -995,  -992,  -990,  -987,  -984,  -982,  -979,  -976,  -974,  -971,
+		 -968,  -966,  -963,  -960,  -957,  -954,  -952,  -949,  -946,  -943,  -940,  -937,
+		 -934,  -931,  -929,  -926,  -923,  -920,  -917,  -914,  -911,  -908,  -904,  -901,
+		 -898,  -895,  -892,  -889,  -886,  -883,  -879,  -876,  -873,  -870,  -867,  -863,
+		 -860,  -857,  -854,  -850,  -847,  -844,  -840,  -837,  -834,  -830,  -827,  -823,
+		 -820,  -816,  -813,  -809,  -806,  -802,  -799,  -795,  -792,  -788,  -785,  -781,
+		 -778,  -774,  -770,  -767,  -763,  -759,  -756,  -752,  -748,  -745,  -741,  -737,
+		 -733,  -730,  -726,  -722,  -718,  -715,  -711,  -707,  -703,  -699,  -695,  -691,
+		 -688,  -684,  -680,  -676,  -672,  -668,  -664,  -660,  -656,  -652,  -648,  -644,
+		 -640,  -636,  -632,  -628,  -624,  -620,  -615,  -611,  -607,  -603,  -599,  -595,
+		 -591,  -587,  -582,  -578,  -574,  -570,  -566,  -561,  -557,  -553,  -549,  -544,
+		 -540,  -536,  -531,  -527,  -523,  -518,  -514,  -510,  -505,  -501,  -497,  -492,
+		 -488,  -484,  -479,  -475,  -470,  -466,  -461,  -457,  -453,  -448,  -444,  -439,
+		 -435,  -430,  -426,  -421,  -417,  -412,  -408,  -403,  -399,  -394,  -389,  -385,
+		 -380,  -376,  -371,  -367,  -362,  -357,  -353,  -348,  -343,  -339,  -334,  -330,
+		 -325,  -320,  -316,  -311,  -306,  -302,  -297,  -292,  -288,  -283,  -278,  -273,
+		 -269,  -264,  -259,  -255,  -250,  -245,  -240,  -236,  -231,  -226,  -221,  -217,
+		 -212,  -207,  -202,  -198,  -193,  -188,  -183,  -179,  -174,  -169,  -164,  -159,
+		 -155,  -150,  -145,  -140,  -135,  -131,  -126,  -121,  -116,  -111,  -106,  -102,
+		  -97,   -92,   -87,   -82,   -77,   -73,   -68,   -63,   -58,   -53,   -48,   -44,
+		  -39,   -34,   -29,   -24,   -19,   -15,   -10,    -5,     0,
+	},
+	// Electric level 7
+	{
+		    0,     7,    13,    20,    26,    33,    39,    46,    53,    59,    66,    72,
+		   79,    85,    92,    99,   105,   112,   118,   125,   131,   138,   145,   151,
+		  158,   164,   171,   177,   184,   190,   197,   203,   210,   216,   223,   229,
+		  236,   242,   249,   255,   262,   268,   275,   281,   288,   294,   301,   307,
+		  313,   320,   326,   333,   339,   345,   352,   358,   365,   371,   377,   384,
+		  390,   396,   403,   409,   415,   422,   428,   434,   441,   447,   453,   459,
+		  466,   472,   478,   484,   491,   497,   503,   509,   515,   522,   528,   534,
+		  540,   546,   552,   558,   564,   571,   577,   583,   589,   595,   601,   607,
+		  613,   619,   625,   631,   637,   643,   649,   654,   660,   666,   672,   678,
+		  684,   690,   695,   701,   707,   713,   719,   724,   730,   736,   742,   747,
+		  753,   759,   764,   770,   776,   781,   787,   792,   798,   803,   809,   815,
+		  820,   826,   831,   836,   842,   847,   853,   858,   864,   869,   874,   880,
+		  885,   890,   895,   901,   906,   911,   916,   922,   927,   932,   937,   942,
+		  947,   952,   957,   962,   967,   973,   977,   982,   987,   992,   997,  1002,
+		 1007,  1012,  1017,  1022,  1026,  1031,  1036,  1041,  1045,  1050,  1055,  1060,
+		 1064,  1069,  1073,  1078,  1083,  1087,  1092,  1096,  1101,  1105,  1110,  1114,
+		 1118,  1123,  1127,  1131,  1136,  1140,  1144,  1149,  1153,  1157,  1161,  1165,
+		 1170,  1174,  1178,  1182,  1186,  1190,  1194,  1198,  1202,  1206,  1210,  1214,
+		 1218,  1222,  1226,  1229,  1233,  1237,  1241,  1244,  1248,  1252,  1256,  1259,
+		 1263,  1266,  1270,  1274,  1277,  1281,  1284,  1288,  1291,  1294,  1298,  1301,
+		 1304,  1308,  1311,  1314,  1318,  1321,  1324,  1327,  1330,  1334,  1337,  1340,
+		 1343,  1346,  1349,  1352,  1355,  1358,  1361,  1364,  1367,  1369,  1372,  1375,
+		 1378,  1381,  1383,  1386,  1389,  1391,  1394,  1397,  1399,  1402,  1404,  1407,
+		 1409,  1412,  1414,  1417,  1419,  1421,  1424,  1426,  1428,  1431,  1433,  1435,
+		 1437,  1439,  1442,  1444,  1446,  1448,  1450,  1452,  1454,  1456,  1458,  1460,
+		 1462,  1464,  1466,  1467,  1469,  1471,  1473,  1475,  1476,  1478,  1480,  1481,
+		 1483,  1484,  1486,  1488,  1489,  1491,  1492,  1493,  1495,  1496,  1498,  1499,
+		 1500,  1502,  1503,  1504,  1505,  1507,  1508,  1509,  1510,  1511,  1512,  1513,
+		 1514,  1515,  1516,  1517,  1518,  1519,  1520,  1521,  1522,  1523,  1523,  1524,
+		 1525,  1526,  1526,  1527,  1528,  1528,  1529,  1530,  1530,  1531,  1531,  1532,
+		 1532,  1533,  1533,  1533,  1534,  1534,  1534,  1535,  1535,  1535,  1536,  1536,
+		 1536,  1536,  1536,  1536,  1536,  1537,  1537,  1537,  1537,  1537,  1537,  1537,
+		 1536,  1536,  1536,  1536,  1536,  1536,  1536,  1535,  1535,  1535,  1534,  1534,
+		 1534,  1533,  1533,  1533,  1532,  1532,  1531,  1531,  1530,  1530,  1529,  1529,
+		 1528,  1527,  1527,  1526,  1525,  1525,  1524,  1523,  1523,  1522,  1521,  1520,
+		 1519,  1518,  1518,  1517,  1516,  1515,  1514,  1513,  1512,  1511,  1510,  1509,
+		 1508,  1506,  1505,  1504,  1503,  1502,  1501,  1499,  1498,  1497,  1496,  1494,
+		 1493,  1492,  1490,  1489,  1488,  1486,  1485,  1483,  1482,  1480,  1479,  1477,
+		 1476,  1474,  1473,  1471,  1470,  1468,  1466,  1465,  1463,  1461,  1460,  1458,
+		 1456,  1454,  1453,  1451,  1449,  1447,  1445,  1444,  1442,  1440,  1438,  1436,
+		 1434,  1432,  1430,  1428,  1426,  1424,  1422,  1420,  1418,  1416,  1414,  1412,
+		 1410,  1408,  1406,  1403,  1401,  1399,  1397,  1395,  1392,  1390,  1388,  1386,
+		 1383,  1381,  1379,  1376,  1374,  1372,  1369,  1367,  1365,  1362,  1360,  1357,
+		 1355,  1353,  1350,  1348,  1345,  1343,  1340,  1338,  1335,  1333,  1330,  1327,
+		 1325,  1322,  1320,  1317,  1314,  1312,  1309,  1306,  1304,  1301,  1298,  1296,
+		 1293,  1290,  1288,  1285,  1282,  1279,  1276,  1274,  1271,  1268,  1265,  1262,
+		 1260,  1257,  1254,  1251,  1248,  1245,  1243,  1240,  1237,  1234,  1231,  1228,
+		 1225,  1222,  1219,  1216,  1213,  1210,  1207,  1204,  1201,  1198,  1195,  1192,
+		 1189,  1186,  1183,  1180,  1177,  1174,  1171,  1168,  1165,  1162,  1159,  1156,
+		 1152,  1149,  1146,  1143,  1140,  1137,  1134,  1131,  1127,  1124,  1121,  1118,
+		 1115,  1112,  1108,  1105,  1102,  1099,  1096,  1092,  1089,  1086,  1083,  1080,
+		 1076,  1073,  1070,  1067,  1064,  1060,  1057,  1054,  1051,  1047,  1044,  1041,
+		 1038,  1034,  1031,  1028,  1024,  1021,  1018,  1015,  1011,  1008,  1005,  1002,
+		  998,   995,   992,   988,   985,   982,   978,   975,   972,   969,   965,   962,
+		  959,   955,   952,   949,   945,   942,   939,   936,   932,   929,   926,   922,
+		  919,   916,   912,   909,   906,   902,   899,   896,   893,   889,   886,   883,
+		  879,   876,   873,   869,   866,   863,   860,   856,   853,   850,   846,   843,
+		  840,   836,   833,   830,   827,   823,   820,   817,   814,   810,   807,   804,
+		  800,   797,   794,   791,   787,   784,   781,   778,   774,   771,   768,   765,
+		  762,   758,   755,   752,   749,   745,   742,   739,   736,   733,   729,   726,
+		  723,   720,   717,   713,   710,   707,   704,   701,   698,   694,   691,   688,
+		  685,   682,   679,   676,   672,   669,   666,   663,   660,   657,   654,   651,
+		  648,   645,   641,   638,   635,   632,   629,   626,   623,   620,   617,   614,
+		  611,   608,   605,   602,   599,   596,   593,   590,   587,   584,   581,   578,
+		  575,   572,   569,   566,   563,   560,   557,   554,   552,   549,   546,   543,
+		  540,   537,   534,   531,   528,   526,   523,   520,   517,   514,   511,   509,
+		  506,   503,   500,   497,   494,   492,   489,   486,   483,   481,   478,   475,
+		  472,   470,   467,   464,   461,   459,   456,   453,   451,   448,   445,   442,
+		  440,   437,   434,   432,   429,   427,   424,   421,   419,   416,   413,   411,
+		  408,   406,   403,   401,   398,   395,   393,   390,   388,   385,   383,   380,
+		  378,   375,   373,   370,   368,   365,   363,   360,   358,   355,   353,   350,
+		  348,   345,   343,   341,   338,   336,   333,   331,   329,   326,   324,   321,
+		  319,   317,   314,   312,   310,   307,   305,   303,   300,   298,   296,   293,
+		  291,   289,   287,   284,   282,   280,   278,   275,   273,   271,   269,   266,
+		  264,   262,   260,   257,   255,   253,   251,   249,   247,   244,   242,   240,
+		  238,   236,   234,   231,   229,   227,   225,   223,   221,   219,   217,   214,
+		  212,   210,   208,   206,   204,   202,   200,   198,   196,   194,   192,   190,
+		  188,   186,   184,   182,   180,   178,   175,   173,   171,   169,   167,   166,
+		  164,   162,   160,   158,   156,   154,   152,   150,   148,   146,   144,   142,
+		  140,   138,   136,   134,   132,   130,   128,   127,   125,   123,   121,   119,
+		  117,   115,   113,   111,   109,   108,   106,   104,   102,   100,    98,    96,
+		   94,    93,    91,    89,    87,    85,    83,    82,    80,    78,    76,    74,
+		   72,    70,    69,    67,    65,    63,    61,    60,    58,    56,    54,    52,
+		   50,    49,    47,    45,    43,    41,    40,    38,    36,    34,    32,    31,
+		   29,    27,    25,    23,    22,    20,    18,    16,    14,    13,    11,     9,
+		    7,     5,     4,     2,     0,    -2,    -4,    -5,    -7,    -9,   -11,   -13,
+		  -14,   -16,   -18,   -20,   -22,   -23,   -25,   -27,   -29,   -31,   -32,   -34,
+		  -36,   -38,   -40,   -41,   -43,   -45,   -47,   -49,   -50,   -52,   -54,   -56,
+		  -58,   -60,   -61,   -63,   -65,   -67,   -69,   -70,   -72,   -74,   -76,   -78,
+		  -80,   -82,   -83,   -85,   -87,   -89,   -91,   -93,   -94,   -96,   -98,  -100,
+		 -102,  -104,  -106,  -108,  -109,  -111,  -113,  -115,  -117,  -119,  -121,  -123,
+		 -125,  -127,  -128,  -130,  -132,  -134,  -136,  -138,  -140,  -142,  -144,  -146,
+		 -148,  -150,  -152,  -154,  -156,  -158,  -160,  -162,  -164,  -166,  -167,  -169,
+		 -171,  -173,  -175,  -178,  -180,  -182,  -184,  -186,  -188,  -190,  -192,  -194,
+		 -196,  -198,  -200,  -202,  -204,  -206,  -208,  -210,  -212,  -214,  -217,  -219,
+		 -221,  -223,  -225,  -227,  -229,  -231,  -234,  -236,  -238,  -240,  -242,  -244,
+		 -247,  -249,  -251,  -253,  -255,  -257,  -260,  -262,  -264,  -266,  -269,  -271,
+		 -273,  -275,  -278,  -280,  -282,  -284,  -287,  -289,  -291,  -293,  -296,  -298,
+		 -300,  -303,  -305,  -307,  -310,  -312,  -314,  -317,  -319,  -321,  -324,  -326,
+		 -329,  -331,  -333,  -336,  -338,  -341,  -343,  -345,  -348,  -350,  -353,  -355,
+		 -358,  -360,  -363,  -365,  -368,  -370,  -373,  -375,  -378,  -380,  -383,  -385,
+		 -388,  -390,  -393,  -395,  -398,  -401,  -403,  -406,  -408,  -411,  -413,  -416,
+		 -419,  -421,  -424,  -427,  -429,  -432,  -434,  -437,  -440,  -442,  -445,  -448,
+		 -451,  -453,  -456,  -459,  -461,  -464,  -467,  -470,  -472,  -475,  -478,  -481,
+		 -483,  -486,  -489,  -492,  -494,  -497,  -500,  -503,  -506,  -509,  -511,  -514,
+		 -517,  -520,  -523,  -526,  -528,  -531,  -534,  -537,  -540,  -543,  -546,  -549,
+		 -552,  -554,  -557,  -560,  -563,  -566,  -569,  -572,  -575,  -578,  -581,  -584,
+		 -587,  -590,  -593,  -596,  -599,  -602,  -605,  -608,  -611,  -614,  -617,  -620,
+		 -623,  -626,  -629,  -632,  -635,  -638,  -641,  -645,  -648,  -651,  -654,  -657,
+		 -660,  -663,  -666,  -669,  -672,  -676,  -679,  -682,  -685,  -688,  -691,  -694,
+		 -698,  -701,  -704,  -707,  -710,  -713,  -717,  -720,  -723,  -726,  -729,  -733,
+		 -736,  -739,  -742,  -745,  -749,  -752,  -755,  -758,  -762,  -765,  -768,  -771,
+		 -774,  -778,  -781,  -784,  -787,  -791,  -794,  -797,  -800,  -804,  -807,  -810,
+		 -814,  -817,  -820,  -823,  -827,  -830,  -833,  -836,  -840,  -843,  -846,  -850,
+		 -853,  -856,  -860,  -863,  -866,  -869,  -873,  -876,  -879,  -883,  -886,  -889,
+		 -893,  -896,  -899,  -902,  -906,  -909,  -912,  -916,  -919,  -922,  -926,  -929,
+		 -932,  -936,  -939,  -942,  -945,  -949,  -952,  -955,  -959,  -962,  -965,  -969,
+		 -972,  -975,  -978,  -982,  -985,  -988,  -992,  -995,  -998, -1002, -1005, -1008,
+		-1011, -1015, -1018, -1021, -1024, -1028, -1031, -1034, -1038, -1041, -1044, -1047,
+		-1051, -1054, -1057, -1060, -1064, -1067, -1070, -1073, -1076, -1080, -1083, -1086,
+		-1089, -1092, -1096, -1099, -1102, -1105, -1108, -1112, -1115, -1118, -1121, -1124,
+		-1127, -1131, -1134, -1137, -1140, -1143, -1146, -1149, -1152, -1156, -1159, -1162,
+		-1165, -1168, -1171, -1174, -1177, -1180, -1183, -1186, -1189, -1192, -1195, -1198,
+		-1201, -1204, -1207, -1210, -1213, -1216, -1219, -1222, -1225, -1228, -1231, -1234,
+		-1237, -1240, -1243, -1245, -1248, -1251, -1254, -1257, -1260, -1262, -1265, -1268,
+		-1271, -1274, -1276, -1279, -1282, -1285, -1288, -1290, -1293, -1296, -1298, -1301,
+		-1304, -1306, -1309, -1312, -1314, -1317, -1320, -1322, -1325, -1327, -1330, -1333,
+		-1335, -1338, -1340, -1343, -1345, -1348, -1350, -1353, -1355, -1357, -1360, -1362,
+		-1365, -1367, -1369, -1372, -1374, -1376, -1379, -1381, -1383, -1386, -1388, -1390,
+		-1392, -1395, -1397, -1399, -1401, -1403, -1406, -1408, -1410, -1412, -1414, -1416,
+		-1418, -1420, -1422, -1424, -1426, -1428, -1430, -1432, -1434, -1436, -1438, -1440,
+		-1442, -1444, -1445, -1447, -1449, -1451, -1453, -1454, -1456, -1458, -1460, -1461,
+		-1463, -1465, -1466, -1468, -1470, -1471, -1473, -1474, -1476, -1477, -1479, -1480,
+		-1482, -1483, -1485, -1486, -1488, -1489, -1490, -1492, -1493, -1494, -1496, -1497,
+		-1498, -1499, -1501, -1502, -1503, -1504, -1505, -1506, -1508, -1509, -1510, -1511,
+		-1512, -1513, -1514, -1515, -1516, -1517, -1518, -1518, -1519, -1520, -1521, -1522,
+		-1523, -1523, -1524, -1525, -1525, -1526, -1527, -1527, -1528, -1529, -1529, -1530,
+		-1530, -1531, -1531, -1532, -1532, -1533, -1533, -1533, -1534, -1534, -1534, -1535,
+		-1535, -1535, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1537, -1537, -1537,
+		-1537, -1537, -1537, -1537, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1535,
+		-1535, -1535, -1534, -1534, -1534, -1533, -1533, -1533, -1532, -1532, -1531, -1531,
+		-1530, -1530, -1529, -1528, -1528, -1527, -1526, -1526, -1525, -1524, -1523, -1523,
+		-1522, -1521, -1520, -1519, -1518, -1517, -1516, -1515, -1514, -1513, -1512, -1511,
+		-1510, -1509, -1508, -1507, -1505, -1504, -1503, -1502, -1500, -1499, -1498, -1496,
+		-1495, -1493, -1492, -1491, -1489, -1488, -1486, -1484, -1483, -1481, -1480, -1478,
+		-1476, -1475, -1473, -1471, -1469, -1467, -1466, -1464, -1462, -1460, -1458, -1456,
+		-1454, -1452, -1450, -1448, -1446, -1444, -1442, -1439, -1437, -1435, -1433, -1431,
+		-1428, -1426, -1424, -1421, -1419, -1417, -1414, -1412, -1409, -1407, -1404, -1402,
+		-1399, -1397, -1394, -1391, -1389, -1386, -1383, -1381, -1378, -1375, -1372, -1369,
+		-1367, -1364, -1361, -1358, -1355, -1352, -1349, -1346, -1343, -1340, -1337, -1334,
+		-1330, -1327, -1324, -1321, -1318, -1314, -1311, -1308, -1304, -1301, -1298, -1294,
+		-1291, -1288, -1284, -1281, -1277, -1274, -1270, -1266, -1263, -1259, -1256, -1252,
+		-1248, -1244, -1241, -1237, -1233, -1229, -1226, -1222, -1218, -1214, -1210, -1206,
+		-1202, -1198, -1194, -1190, -1186, -1182, -1178, -1174, -1170, -1165, -1161, -1157,
+		-1153, -1149, -1144, -1140, -1136, -1131, -1127, -1123, -1118, -1114, -1110, -1105,
+		-1101, -1096, -1092, -1087, -1083, -1078, -1073, -1069, -1064, -1060, -1055, -1050,
+		-1045, -1041, -1036, -1031, -1026, -1022, -1017, -1012, -1007, -1002,  -997,  -992,
+		 -987,  -982,  -977,  -973,  -967,  -962,  -957,  -952,  -947,  -942,  -937,  -932,
+		 -927,  -922,  -916,  -911,  -906,  -901,  -895,  -890,  -885,  -880,  -874,  -869,
+		 -864,  -858,  -853,  -847,  -842,  -836,  -831,  -826,  -820,  -815,  -809,  -803,
+		 -798,  -792,  -787,  -781,  -776,  -770,  -764,  -759,  -753,  -747,  -742,  -736,
+		 -730,  -724,  -719,  -713,  -707,  -701,  -695,  -690,  -684,  -678,  -672,  -666,
+		 -660,  -654,  -649,  -643,  -637,  -631,  -625,  -619,  -613,  -607,  -601,  -595,
+		 -589,  -583,  -577,  -571,  -564,  -558,  -552,  -546,  -540,  -534,  -528,  -522,
+		 -515,  -509,  -503,  -497,  -491,  -484,  -478,  -472,  -466,  -459,  -453,  -447,
+		 -441,  -434,  -428,  -422,  -415,  -409,  -403,  -396,  -390,  -384,  -377,  -371,
+		 -365,  -358,  -352,  -345,  -339,  -333,  -326,  -320,  -313,  -307,  -301,  -294,
+		 -288,  -281,  -275,  -268,  -262,  -255,  -249,  -242,  -236,  -229,  -223,  -216,
+		 -210,  -203,  -197,  -190,  -184,  -177,  -171,  -164,  -158,  -151,  -145,  -138,
+		 -131,  -125,  -118,  -112,  -105,   -99,   -92,   -85,   -79,   -72,   -66,   -59,
+		  -53,   -46,   -39,   -33,   -26,   -20,   -13,    -7,     0,
+	},
+	// Piano level 8
+	{
+		    0,     4,     7,    11,    14,    18,    22,    25,    29,    32,    36,    39,
+		   43,    47,    50,    54,    57,    61,    65,    68,    72,    75,    79,    82,
+		   86,    90,    93,    97,   100,   104,   108,   111,   115,   118,   122,   125,
+		  129,   132,   136,   140,   143,   147,   150,   154,   157,   161,   165,   168,
+		  172,   175,   179,   182,   186,   189,   193,   196,   200,   204,   207,   211,
+		  214,   218,   221,   225,   228,   232,   235,   239,   242,   246,   249,   253,
+		  256,   260,   263,   267,   270,   274,   277,   281,   284,   288,   291,   295,
+		  298,   302,   305,   309,   312,   315,   319,   322,   326,   329,   333,   336,
+		  340,   343,   346,   350,   353,   357,   360,   364,   367,   370,   374,   377,
+		  381,   384,   387,   391,   394,   397,   401,   404,   408,   411,   414,   418,
+		  421,   424,   428,   431,   434,   438,   441,   444,   448,   451,   454,   458,
+		  461,   464,   467,   471,   474,   477,   481,   484,   487,   490,   494,   497,
+		  500,   503,   507,   510,   513,   516,   519,   523,   526,   529,   532,   536,
+		  539,   542,   545,   548,   551,   555,   558,   561,   564,   567,   570,   573,
+		  577,   580,   583,   586,   589,   592,   595,   598,   601,   604,   607,   611,
+		  614,   617,   620,   623,   626,   629,   632,   635,   638,   641,   644,   647,
+		  650,   653,   656,   659,   662,   665,   668,   671,   674,   676,   679,   682,
+		  685,   688,   691,   694,   697,   700,   703,   705,   708,   711,   714,   717,
+		  720,   722,   725,   728,   731,   734,   736,   739,   742,   745,   748,   750,
+		  753,   756,   759,   761,   764,   767,   769,   772,   775,   778,   780,   783,
+		  786,   788,   791,   793,   796,   799,   801,   804,   807,   809,   812,   814,
+		  817,   819,   822,   825,   827,   830,   832,   835,   837,   840,   842,   845,
+		  847,   850,   852,   855,   857,   859,   862,   864,   867,   869,   872,   874,
+		  876,   879,   881,   883,   886,   888,   890,   893,   895,   897,   900,   902,
+		  904,   906,   909,   911,   913,   915,   918,   920,   922,   924,   927,   929,
+		  931,   933,   935,   937,   940,   942,   944,   946,   948,   950,   952,   954,
+		  956,   958,   960,   962,   965,   967,   969,   971,   973,   975,   977,   979,
+		  980,   982,   984,   986,   988,   990,   992,   994,   996,   998,  1000,  1001,
+		 1003,  1005,  1007,  1009,  1011,  1012,  1014,  1016,  1018,  1020,  1021,  1023,
+		 1025,  1026,  1028,  1030,  1032,  1033,  1035,  1037,  1038,  1040,  1042,  1043,
+		 1045,  1046,  1048,  1050,  1051,  1053,  1054,  1056,  1057,  1059,  1060,  1062,
+		 1063,  1065,  1066,  1068,  1069,  1071,  1072,  1074,  1075,  1077,  1078,  1079,
+		 1081,  1082,  1083,  1085,  1086,  1087,  1089,  1090,  1091,  1093,  1094,  1095,
+		 1096,  1098,  1099,  1100,  1101,  1103,  1104,  1105,  1106,  1107,  1108,  1110,
+		 1111,  1112,  1113,  1114,  1115,  1116,  1117,  1118,  1119,  1120,  1121,  1122,
+		 1123,  1124,  1125,  1126,  1127,  1128,  1129,  1130,  1131,  1132,  1133,  1134,
+		 1135,  1136,  1136,  1137,  1138,  1139,  1140,  1141,  1141,  1142,  1143,  1144,
+		 1144,  1145,  1146,  1147,  1147,  1148,  1149,  1149,  1150,  1151,  1151,  1152,
+		 1152,  1153,  1154,  1154,  1155,  1155,  1156,  1157,  1157,  1158,  1158,  1159,
+		 1159,  1160,  1160,  1160,  1161,  1161,  1162,  1162,  1163,  1163,  1163,  1164,
+		 1164,  1164,  1165,  1165,  1165,  1166,  1166,  1166,  1167,  1167,  1167,  1167,
+		 1168,  1168,  1168,  1168,  1168,  1168,  1169,  1169,  1169,  1169,  1169,  1169,
+		 1169,  1169,  1170,  1170,  1170,  1170,  1170,  1170,  1170,  1170,  1170,  1170,
+		 1170,  1170,  1170,  1169,  1169,  1169,  1169,  1169,  1169,  1169,  1169,  1168,
+		 1168,  1168,  1168,  1168,  1168,  1167,  1167,  1167,  1167,  1166,  1166,  1166,
+		 1165,  1165,  1165,  1164,  1164,  1164,  1163,  1163,  1163,  1162,  1162,  1161,
+		 1161,  1160,  1160,  1160,  1159,  1159,  1158,  1158,  1157,  1157,  1156,  1155,
+		 1155,  1154,  1154,  1153,  1152,  1152,  1151,  1151,  1150,  1149,  1149,  1148,
+		 1147,  1147,  1146,  1145,  1144,  1144,  1143,  1142,  1141,  1141,  1140,  1139,
+		 1138,  1137,  1136,  1136,  1135,  1134,  1133,  1132,  1131,  1130,  1129,  1128,
+		 1127,  1126,  1125,  1124,  1123,  1122,  1121,  1120,  1119,  1118,  1117,  1116,
+		 1115,  1114,  1113,  1112,  1111,  1110,  1108,  1107,  1106,  1105,  1104,  1103,
+		 1101,  1100,  1099,  1098,  1096,  1095,  1094,  1093,  1091,  1090,  1089,  1087,
+		 1086,  1085,  1083,  1082,  1081,  1079,  1078,  1077,  1075,  1074,  1072,  1071,
+		 1069,  1068,  1066,  1065,  1063,  1062,  1060,  1059,  1057,  1056,  1054,  1053,
+		 1051,  1050,  1048,  1046,  1045,  1043,  1042,  1040,  1038,  1037,  1035,  1033,
+		 1032,  1030,  1028,  1026,  1025,  1023,  1021,  1020,  1018,  1016,  1014,  1012,
+		 1011,  1009,  1007,  1005,  1003,  1001,  1000,   998,   996,   994,   992,   990,
+		  988,   986,   984,   982,   980,   979,   977,   975,   973,   971,   969,   967,
+		  965,   962,   960,   958,   956,   954,   952,   950,   948,   946,   944,   942,
+		  940,   937,   935,   933,   931,   929,   927,   924,   922,   920,   918,   915,
+		  913,   911,   909,   906,   904,   902,   900,   897,   895,   893,   890,   888,
+		  886,   883,   881,   879,   876,   874,   872,   869,   867,   864,   862,   859,
+		  857,   855,   852,   850,   847,   845,   842,   840,   837,   835,   832,   830,
+		  827,   825,   822,   819,   817,   814,   812,   809,   807,   804,   801,   799,
+		  796,   793,   791,   788,   786,   783,   780,   778,   775,   772,   769,   767,
+		  764,   761,   759,   756,   753,   750,   748,   745,   742,   739,   736,   734,
+		  731,   728,   725,   722,   720,   717,   714,   711,   708,   705,   703,   700,
+		  697,   694,   691,   688,   685,   682,   679,   676,   674,   671,   668,   665,
+		  662,   659,   656,   653,   650,   647,   644,   641,   638,   635,   632,   629,
+		  626,   623,   620,   617,   614,   611,   607,   604,   601,   598,   595,   592,
+		  589,   586,   583,   580,   577,   573,   570,   567,   564,   561,   558,   555,
+		  551,   548,   545,   542,   539,   536,   532,   529,   526,   523,   519,   516,
+		  513,   510,   507,   503,   500,   497,   494,   490,   487,   484,   481,   477,
+		  474,   471,   467,   464,   461,   458,   454,   451,   448,   444,   441,   438,
+		  434,   431,   428,   424,   421,   418,   414,   411,   408,   404,   401,   397,
+		  394,   391,   387,   384,   381,   377,   374,   370,   367,   364,   360,   357,
+		  353,   350,   346,   343,   340,   336,   333,   329,   326,   322,   319,   315,
+		  312,   309,   305,   302,   298,   295,   291,   288,   284,   281,   277,   274,
+		  270,   267,   263,   260,   256,   253,   249,   246,   242,   239,   235,   232,
+		  228,   225,   221,   218,   214,   211,   207,   204,   200,   196,   193,   189,
+		  186,   182,   179,   175,   172,   168,   165,   161,   157,   154,   150,   147,
+		  143,   140,   136,   132,   129,   125,   122,   118,   115,   111,   108,   104,
+		  100,    97,    93,    90,    86,    82,    79,    75,    72,    68,    65,    61,
+		   57,    54,    50,    47,    43,    39,    36,    32,    29,    25,    22,    18,
+		   14,    11,     7,     4,     0,    -4,    -7,   -11,   -14,   -18,   -22,   -25,
+		  -29,   -32,   -36,   -39,   -43,   -47,   -50,   -54,   -57,   -61,   -65,   -68,
+		  -72,   -75,   -79,   -82,   -86,   -90,   -93,   -97,  -100,  -104,  -108,  -111,
+		 -115,  -118,  -122,  -125,  -129,  -132,  -136,  -140,  -143,  -147,  -150,  -154,
+		 -157,  -161,  -165,  -168,  -172,  -175,  -179,  -182,  -186,  -189,  -193,  -196,
+		 -200,  -204,  -207,  -211,  -214,  -218,  -221,  -225,  -228,  -232,  -235,  -239,
+		 -242,  -246,  -249,  -253,  -256,  -260,  -263,  -267,  -270,  -274,  -277,  -281,
+		 -284,  -288,  -291,  -295,  -298,  -302,  -305,  -309,  -312,  -315,  -319,  -322,
+		 -326,  -329,  -333,  -336,  -340,  -343,  -346,  -350,  -353,  -357,  -360,  -364,
+		 -367,  -370,  -374,  -377,  -381,  -384,  -387,  -391,  -394,  -397,  -401,  -404,
+		 -408,  -411,  -414,  -418,  -421,  -424,  -428,  -431,  -434,  -438,  -441,  -444,
+		 -448,  -451,  -454,  -458,  -461,  -464,  -467,  -471,  -474,  -477,  -481,  -484,
+		 -487,  -490,  -494,  -497,  -500,  -503,  -507,  -510,  -513,  -516,  -519,  -523,
+		 -526,  -529,  -532,  -536,  -539,  -542,  -545,  -548,  -551,  -555,  -558,  -561,
+		 -564,  -567,  -570,  -573,  -577,  -580,  -583,  -586,  -589,  -592,  -595,  -598,
+		 -601,  -604,  -607,  -611,  -614,  -617,  -620,  -623,  -626,  -629,  -632,  -635,
+		 -638,  -641,  -644,  -647,  -650,  -653,  -656,  -659,  -662,  -665,  -668,  -671,
+		 -674,  -676,  -679,  -682,  -685,  -688,  -691,  -694,  -697,  -700,  -703,  -705,
+		 -708,  -711,  -714,  -717,  -720,  -722,  -725,  -728,  -731,  -734,  -736,  -739,
+		 -742,  -745,  -748,  -750,  -753,  -756,  -759,  -761,  -764,  -767,  -769,  -772,
+		 -775,  -778,  -780,  -783,  -786,  -788,  -791,  -793,  -796,  -799,  -801,  -804,
+		 -807,  -809,  -812,  -814,  -817,  -819,  -822,  -825,  -827,  -830,  -832,  -835,
+		 -837,  -840,  -842,  -845,  -847,  -850,  -852,  -855,  -857,  -859,  -862,  -864,
+		 -867,  -869,  -872,  -874,  -876,  -879,  -881,  -883,  -886,  -888,  -890,  -893,
+		 -895,  -897,  -900,  -902,  -904,  -906,  -909,  -911,  -913,  -915,  -918,  -920,
+		 -922,  -924,  -927,  -929,  -931,  -933,  -935,  -937,  -940,  -942,  -944,  -946,
+		 -948,  -950,  -952,  -954,  -956,  -958,  -960,  -962,  -965,  -967,  -969,  -971,
+		 -973,  -975,  -977,  -979,  -980,  -982,  -984,  -986,  -988,  -990,  -992,  -994,
+		 -996,  -998, -1000, -1001, -1003, -1005, -1007, -1009, -1011, -1012, -1014, -1016,
+		-1018, -1020, -1021, -1023, -1025, -1026, -1028, -1030, -1032, -1033, -1035, -1037,
+		-1038, -1040, -1042, -1043, -1045, -1046, -1048, -1050, -1051, -1053, -1054, -1056,
+		-1057, -1059, -1060, -1062, -1063, -1065, -1066, -1068, -1069, -1071, -1072, -1074,
+		-1075, -1077, -1078, -1079, -1081, -1082, -1083, -1085, -1086, -1087, -1089, -1090,
+		-1091, -1093, -1094, -1095, -1096, -1098, -1099, -1100, -1101, -1103, -1104, -1105,
+		-1106, -1107, -1108, -1110, -1111, -1112, -1113, -1114, -1115, -1116, -1117, -1118,
+		-1119, -1120, -1121, -1122, -1123, -1124, -1125, -1126, -1127, -1128, -1129, -1130,
+		-1131, -1132, -1133, -1134, -1135, -1136, -1136, -1137, -1138, -1139, -1140, -1141,
+		-1141, -1142, -1143, -1144, -1144, -1145, -1146, -1147, -1147, -1148, -1149, -1149,
+		-1150, -1151, -1151, -1152, -1152, -1153, -1154, -1154, -1155, -1155, -1156, -1157,
+		-1157, -1158, -1158, -1159, -1159, -1160, -1160, -1160, -1161, -1161, -1162, -1162,
+		-1163, -1163, -1163, -1164, -1164, -1164, -1165, -1165, -1165, -1166, -1166, -1166,
+		-1167, -1167, -1167, -1167, -1168, -1168, -1168, -1168, -1168, -1168, -1169, -1169,
+		-1169, -1169, -1169, -1169, -1169, -1169, -1170, -1170, -1170, -1170, -1170, -1170,
+		-1170, -1170, -1170, -1170, -1170, -1170, -1170, -1169, -1169, -1169, -1169, -1169,
+		-1169, -1169, -1169, -1168, -1168, -1168, -1168, -1168, -1168, -1167, -1167, -1167,
+		-1167, -1166, -1166, -1166, -1165, -1165, -1165, -1164, -1164, -1164, -1163, -1163,
+		-1163, -1162, -1162, -1161, -1161, -1160, -1160, -1160, -1159, -1159, -1158, -1158,
+		-1157, -1157, -1156, -1155, -1155, -1154, -1154, -1153, -1152, -1152, -1151, -1151,
+		-1150, -1149, -1149, -1148, -1147, -1147, -1146, -1145, -1144, -1144, -1143, -1142,
+		-1141, -1141, -1140, -1139, -1138, -1137, -1136, -1136, -1135, -1134, -1133, -1132,
+		-1131, -1130, -1129, -1128, -1127, -1126, -1125, -1124, -1123, -1122, -1121, -1120,
+		-1119, -1118, -1117, -1116, -1115, -1114, -1113, -1112, -1111, -1110, -1108, -1107,
+		-1106, -1105, -1104, -1103, -1101, -1100, -1099, -1098, -1096, -1095, -1094, -1093,
+		-1091, -1090, -1089, -1087, -1086, -1085, -1083, -1082, -1081, -1079, -1078, -1077,
+		-1075, -1074, -1072, -1071, -1069, -1068, -1066, -1065, -1063, -1062, -1060, -1059,
+		-1057, -1056, -1054, -1053, -1051, -1050, -1048, -1046, -1045, -1043, -1042, -1040,
+		-1038, -1037, -1035, -1033, -1032, -1030, -1028, -1026, -1025, -1023, -1021, -1020,
+		-1018, -1016, -1014, -1012, -1011, -1009, -1007, -1005, -1003, -1001, -1000,  -998,
+		 -996,  -994,  -992,  -990,  -988,  -986,  -984,  -982,  -980,  -979,  -977,  -975,
+		 -973,  -971,  -969,  -967,  -965,  -962,  -960,  -958,  -956,  -954,  -952,  -950,
+		 -948,  -946,  -944,  -942,  -940,  -937,  -935,  -933,  -931,  -929,  -927,  -924,
+		 -922,  -920,  -918,  -915,  -913,  -911,  -909,  -906,  -904,  -902,  -900,  -897,
+		 -895,  -893,  -890,  -888,  -886,  -883,  -881,  -879,  -876,  -874,  -872,  -869,
+		 -867,  -864,  -862,  -859,  -857,  -855,  -852,  -850,  -847,  -845,  -842,  -840,
+		 -837,  -835,  -832,  -830,  -827,  -825,  -822,  -819,  -817,  -814,  -812,  -809,
+		 -807,  -804,  -801,  -799,  -796,  -793,  -791,  -788,  -786,  -783,  -780,  -778,
+		 -775,  -772,  -769,  -767,  -764,  -761,  -759,  -756,  -753,  -750,  -748,  -745,
+		 -742,  -739,  -736,  -734,  -731,  -728,  -725,  -722,  -720,  -717,  -714,  -711,
+		 -708,  -705,  -703,  -700,  -697,  -694,  -691,  -688,  -685,  -682,  -679,  -676,
+		 -674,  -671,  -668,  -665,  -662,  -659,  -656,  -653,  -650,  -647,  -644,  -641,
+		 -638,  -635,  -632,  -629,  -626,  -623,  -620,  -617,  -614,  -611,  -607,  -604,
+		 -601,  -598,  -595,  -592,  -589,  -586,  -583,  -580,  -577,  -573,  -570,  -567,
+		 -564,  -561,  -558,  -555,  -551,  -548,  -545,  -542,  -539,  -536,  -532,  -529,
+		 -526,  -523,  -519,  -516,  -513,  -510,  -507,  -503,  -500,  -497,  -494,  -490,
+		 -487,  -484,  -481,  -477,  -474,  -471,  -467,  -464,  -461,  -458,  -454,  -451,
+		 -448,  -444,  -441,  -438,  -434,  -431,  -428,  -424,  -421,  -418,  -414,  -411,
+		 -408,  -404,  -401,  -397,  -394,  -391,  -387,  -384,  -381,  -377,  -374,  -370,
+		 -367,  -364,  -360,  -357,  -353,  -350,  -346,  -343,  -340,  -336,  -333,  -329,
+		 -326,  -322,  -319,  -315,  -312,  -309,  -305,  -302,  -298,  -295,  -291,  -288,
+		 -284,  -281,  -277,  -274,  -270,  -267,  -263,  -260,  -256,  -253,  -249,  -246,
+		 -242,  -239,  -235,  -232,  -228,  -225,  -221,  -218,  -214,  -211,  -207,  -204,
+		 -200,  -196,  -193,  -189,  -186,  -182,  -179,  -175,  -172,  -168,  -165,  -161,
+		 -157,  -154,  -150,  -147,  -143,  -140,  -136,  -132,  -129,  -125,  -122,  -118,
+		 -115,  -111,  -108,  -104,  -100,   -97,   -93,   -90,   -86,   -82,   -79,   -75,
+		  -72,   -68,   -65,   -61,   -57,   -54,   -50,   -47,   -43,   -39,   -36,   -32,
+		  -29,   -25,   -22,   -18,   -14,   -11,    -7,    -4,     0,
+	},
+	// Bright level 8
+	{
+		    0,     3,     7,    10,    14,    17,    20,    24,    27,    31,    34,    37,
+		   41,    44,    48,    51,    55,    58,    61,    65,    68,    72,    75,    78,
+		   82,    85,    89,    92,    95,    99,   102,   106,   109,   112,   116,   119,
+		  122,   126,   129,   133,   136,   139,   143,   146,   150,   153,   156,   160,
+		  163,   166,   170,   173,   177,   180,   183,   187,   190,   193,   197,   200,
+		  203,   207,   210,   213,   217,   220,   223,   227,   230,   233,   237,   240,
+		  243,   247,   250,   253,   257,   260,   263,   267,   270,   273,   277,   280,
+		  283,   287,   290,   293,   296,   300,   303,   306,   309,   313,   316,   319,
+		  323,   326,   329,   332,   336,   339,   342,   345,   349,   352,   355,   358,
+		  361,   365,   368,   371,   374,   378,   381,   384,   387,   390,   394,   397,
+		  400,   403,   406,   409,   413,   416,   419,   422,   425,   428,   432,   435,
+		  438,   441,   444,   447,   450,   453,   457,   460,   463,   466,   469,   472,
+		  475,   478,   481,   484,   487,   490,   494,   497,   500,   503,   506,   509,
+		  512,   515,   518,   521,   524,   527,   530,   533,   536,   539,   542,   545,
+		  548,   551,   554,   557,   560,   562,   565,   568,   571,   574,   577,   580,
+		  583,   586,   589,   592,   595,   597,   600,   603,   606,   609,   612,   615,
+		  617,   620,   623,   626,   629,   631,   634,   637,   640,   643,   645,   648,
+		  651,   654,   656,   659,   662,   665,   667,   670,   673,   676,   678,   681,
+		  684,   686,   689,   692,   694,   697,   700,   702,   705,   708,   710,   713,
+		  715,   718,   721,   723,   726,   728,   731,   734,   736,   739,   741,   744,
+		  746,   749,   751,   754,   756,   759,   761,   764,   766,   769,   771,   774,
+		  776,   778,   781,   783,   786,   788,   791,   793,   795,   798,   800,   802,
+		  805,   807,   809,   812,   814,   816,   819,   821,   823,   826,   828,   830,
+		  832,   835,   837,   839,   841,   844,   846,   848,   850,   852,   855,   857,
+		  859,   861,   863,   865,   868,   870,   872,   874,   876,   878,   880,   882,
+		  884,   886,   888,   891,   893,   895,   897,   899,   901,   903,   905,   907,
+		  909,   910,   912,   914,   916,   918,   920,   922,   924,   926,   928,   930,
+		  931,   933,   935,   937,   939,   941,   942,   944,   946,   948,   950,   951,
+		  953,   955,   957,   958,   960,   962,   963,   965,   967,   969,   970,   972,
+		  974,   975,   977,   978,   980,   982,   983,   985,   986,   988,   989,   991,
+		  993,   994,   996,   997,   999,  1000,  1002,  1003,  1005,  1006,  1007,  1009,
+		 1010,  1012,  1013,  1015,  1016,  1017,  1019,  1020,  1021,  1023,  1024,  1025,
+		 1027,  1028,  1029,  1031,  1032,  1033,  1034,  1036,  1037,  1038,  1039,  1040,
+		 1042,  1043,  1044,  1045,  1046,  1047,  1049,  1050,  1051,  1052,  1053,  1054,
+		 1055,  1056,  1057,  1058,  1059,  1060,  1061,  1062,  1063,  1064,  1065,  1066,
+		 1067,  1068,  1069,  1070,  1071,  1072,  1073,  1074,  1075,  1075,  1076,  1077,
+		 1078,  1079,  1080,  1080,  1081,  1082,  1083,  1083,  1084,  1085,  1086,  1086,
+		 1087,  1088,  1089,  1089,  1090,  1091,  1091,  1092,  1092,  1093,  1094,  1094,
+		 1095,  1095,  1096,  1097,  1097,  1098,  1098,  1099,  1099,  1100,  1100,  1101,
+		 1101,  1102,  1102,  1102,  1103,  1103,  1104,  1104,  1104,  1105,  1105,  1106,
+		 1106,  1106,  1107,  1107,  1107,  1107,  1108,  1108,  1108,  1108,  1109,  1109,
+		 1109,  1109,  1110,  1110,  1110,  1110,  1110,  1110,  1110,  1111,  1111,  1111,
+		 1111,  1111,  1111,  1111,  1111,  1111,  1111,  1111,  1111,  1111,  1111,  1111,
+		 1111,  1111,  1111,  1111,  1111,  1111,  1111,  1111,  1110,  1110,  1110,  1110,
+		 1110,  1110,  1110,  1109,  1109,  1109,  1109,  1108,  1108,  1108,  1108,  1107,
+		 1107,  1107,  1107,  1106,  1106,  1106,  1105,  1105,  1104,  1104,  1104,  1103,
+		 1103,  1102,  1102,  1102,  1101,  1101,  1100,  1100,  1099,  1099,  1098,  1098,
+		 1097,  1097,  1096,  1095,  1095,  1094,  1094,  1093,  1092,  1092,  1091,  1091,
+		 1090,  1089,  1089,  1088,  1087,  1086,  1086,  1085,  1084,  1083,  1083,  1082,
+		 1081,  1080,  1080,  1079,  1078,  1077,  1076,  1075,  1075,  1074,  1073,  1072,
+		 1071,  1070,  1069,  1068,  1067,  1066,  1065,  1064,  1063,  1062,  1061,  1060,
+		 1059,  1058,  1057,  1056,  1055,  1054,  1053,  1052,  1051,  1050,  1049,  1047,
+		 1046,  1045,  1044,  1043,  1042,  1040,  1039,  1038,  1037,  1036,  1034,  1033,
+		 1032,  1031,  1029,  1028,  1027,  1025,  1024,  1023,  1021,  1020,  1019,  1017,
+		 1016,  1015,  1013,  1012,  1010,  1009,  1007,  1006,  1005,  1003,  1002,  1000,
+		  999,   997,   996,   994,   993,   991,   989,   988,   986,   985,   983,   982,
+		  980,   978,   977,   975,   974,   972,   970,   969,   967,   965,   963,   962,
+		  960,   958,   957,   955,   953,   951,   950,   948,   946,   944,   942,   941,
+		  939,   937,   935,   933,   931,   930,   928,   926,   924,   922,   920,   918,
+		  916,   914,   912,   910,   909,   907,   905,   903,   901,   899,   897,   895,
+		  893,   891,   888,   886,   884,   882,   880,   878,   876,   874,   872,   870,
+		  868,   865,   863,   861,   859,   857,   855,   852,   850,   848,   846,   844,
+		  841,   839,   837,   835,   832,   830,   828,   826,   823,   821,   819,   816,
+		  814,   812,   809,   807,   805,   802,   800,   798,   795,   793,   791,   788,
+		  786,   783,   781,   778,   776,   774,   771,   769,   766,   764,   761,   759,
+		  756,   754,   751,   749,   746,   744,   741,   739,   736,   734,   731,   728,
+		  726,   723,   721,   718,   715,   713,   710,   708,   705,   702,   700,   697,
+		  694,   692,   689,   686,   684,   681,   678,   676,   673,   670,   667,   665,
+		  662,   659,   656,   654,   651,   648,   645,   643,   640,   637,   634,   631,
+		  629,   626,   623,   620,   617,   615,   612,   609,   606,   603,   600,   597,
+		  595,   592,   589,   586,   583,   580,   577,   574,   571,   568,   565,   562,
+		  560,   557,   554,   551,   548,   545,   542,   539,   536,   533,   530,   527,
+		  524,   521,   518,   515,   512,   509,   506,   503,   500,   497,   494,   490,
+		  487,   484,   481,   478,   475,   472,   469,   466,   463,   460,   457,   453,
+		  450,   447,   444,   441,   438,   435,   432,   428,   425,   422,   419,   416,
+		  413,   409,   406,   403,   400,   397,   394,   390,   387,   384,   381,   378,
+		  374,   371,   368,   365,   361,   358,   355,   352,   349,   345,   342,   339,
+		  336,   332,   329,   326,   323,   319,   316,   313,   309,   306,   303,   300,
+		  296,   293,   290,   287,   283,   280,   277,   273,   270,   267,   263,   260,
+		  257,   253,   250,   247,   243,   240,   237,   233,   230,   227,   223,   220,
+		  217,   213,   210,   207,   203,   200,   197,   193,   190,   187,   183,   180,
+		  177,   173,   170,   166,   163,   160,   156,   153,   150,   146,   143,   139,
+		  136,   133,   129,   126,   122,   119,   116,   112,   109,   106,   102,    99,
+		   95,    92,    89,    85,    82,    78,    75,    72,    68,    65,    61,    58,
+		   55,    51,    48,    44,    41,    37,    34,    31,    27,    24,    20,    17,
+		   14,    10,     7,     3,     0,    -3,    -7,   -10,   -14,   -17,   -20,   -24,
+		  -27,   -31,   -34,   -37,   -41,   -44,   -48,   -51,   -55,   -58,   -61,   -65,
+		  -68,   -72,   -75,   -78,   -82,   -85,   -89,   -92,   -95,   -99,  -102,  -106,
+		 -109,  -112,  -116,  -119,  -122,  -126,  -129,  -133,  -136,  -139,  -143,  -146,
+		 -150,  -153,  -156,  -160,  -163,  -166,  -170,  -173,  -177,  -180,  -183,  -187,
+		 -190,  -193,  -197,  -200,  -203,  -207,  -210,  -213,  -217,  -220,  -223,  -227,
+		 -230,  -233,  -237,  -240,  -243,  -247,  -250,  -253,  -257,  -260,  -263,  -267,
+		 -270,  -273,  -277,  -280,  -283,  -287,  -290,  -293,  -296,  -300,  -303,  -306,
+		 -309,  -313,  -316,  -319,  -323,  -326,  -329,  -332,  -336,  -339,  -342,  -345,
+		 -349,  -352,  -355,  -358,  -361,  -365,  -368,  -371,  -374,  -378,  -381,  -384,
+		 -387,  -390,  -394,  -397,  -400,  -403,  -406,  -409,  -413,  -416,  -419,  -422,
+		 -425,  -428,  -432,  -435,  -438,  -441,  -444,  -447,  -450,  -453,  -457,  -460,
+		 -463,  -466,  -469,  -472,  -475,  -478,  -481,  -484,  -487,  -490,  -494,  -497,
+		 -500,  -503,  -506,  -509,  -512,  -515,  -518,  -521,  -524,  -527,  -530,  -533,
+		 -536,  -539,  -542,  -545,  -548,  -551,  -554,  -557,  -560,  -562,  -565,  -568,
+		 -571,  -574,  -577,  -580,  -583,  -586,  -589,  -592,  -595,  -597,  -600,  -603,
+		 -606,  -609,  -612,  -615,  -617,  -620,  -623,  -626,  -629,  -631,  -634,  -637,
+		 -640,  -643,  -645,  -648,  -651,  -654,  -656,  -659,  -662,  -665,  -667,  -670,
+		 -673,  -676,  -678,  -681,  -684,  -686,  -689,  -692,  -694,  -697,  -700,  -702,
+		 -705,  -708,  -710,  -713,  -715,  -718,  -721,  -723,  -726,  -728,  -731,  -734,
+		 -736,  -739,  -741,  -744,  -746,  -749,  -751,  -754,  -756,  -759,  -761,  -764,
+		 -766,  -769,  -771,  -774,  -776,  -778,  -781,  -783,  -786,  -788,  -791,  -793,
+		 -795,  -798,  -800,  -802,  -805,  -807,  -809,  -812,  -814,  -816,  -819,  -821,
+		 -823,  -826,  -828,  -830,  -832,  -835,  -837,  -839,  -841,  -844,  -846,  -848,
+		 -850,  -852,  -855,  -857,  -859,  -861,  -863,  -865,  -868,  -870,  -872,  -874,
+		 -876,  -878,  -880,  -882,  -884,  -886,  -888,  -891,  -893,  -895,  -897,  -899,
+		 -901,  -903,  -905,  -907,  -909,  -910,  -912,  -914,  -916,  -918,  -920,  -922,
+		 -924,  -926,  -928,  -930,  -931,  -933,  -935,  -937,  -939,  -941,  -942,  -944,
+		 -946,  -948,  -950,  -951,  -953,  -955,  -957,  -958,  -960,  -962,  -963,  -965,
+		 -967,  -969,  -970,  -972,  -974,  -975,  -977,  -978,  -980,  -982,  -983,  -985,
+		 -986,  -988,  -989,  -991,  -993,  -994,  -996,  -997,  -999, -1000, -1002, -1003,
+		-1005, -1006, -1007, -1009, -1010, -1012, -1013, -1015, -1016, -1017, -1019, -1020,
+		-1021, -1023, -1024, -1025, -1027, -1028, -1029, -1031, -1032, -1033, -1034, -1036,
+		-1037, -1038, -1039, -1040, -1042, -1043, -1044, -1045, -1046, -1047, -1049, -1050,
+		-1051, -1052, -1053, -1054, -1055, -1056, -1057, -1058, -1059, -1060, -1061, -1062,
+		-1063, -1064, -1065, -1066, -1067, -1068, -1069, -1070, -1071, -1072, -1073, -1074,
+		-1075, -1075, -1076, -1077, -1078, -1079, -1080, -1080, -1081, -1082, -1083, -1083,
+		-1084, -1085, -1086, -1086, -1087, -1088, -1089, -1089, -1090, -1091, -1091, -1092,
+		-1092, -1093, -1094, -1094, -1095, -1095, -1096, -1097, -1097, -1098, -1098, -1099,
+		-1099, -1100, -1100, -1101, -1101, -1102, -1102, -1102, -1103, -1103, -1104, -1104,
+		-1104, -1105, -1105, -1106, -1106, -1106, -1107, -1107, -1107, -1107, -1108, -1108,
+		-1108, -1108, -1109, -1109, -1109, -1109, -1110, -1110, -1110, -1110, -1110, -1110,
+		-1110, -1111, -1111, -1111, -1111, -1111, -1111, -1111, -1111, -1111, -1111, -1111,
+		-1111, -1111, -1111, -1111, -1111, -1111, -1111, -1111, -1111, -1111, -1111, -1111,
+		-1110, -1110, -1110, -1110, -1110, -1110, -1110, -1109, -1109, -1109, -1109, -1108,
+		-1108, -1108, -1108, -1107, -1107, -1107, -1107, -1106, -1106, -1106, -1105, -1105,
+		-1104, -1104, -1104, -1103, -1103, -1102, -1102, -1102, -1101, -1101, -1100, -1100,
+		-1099, -1099, -1098, -1098, -1097, -1097, -1096, -1095, -1095, -1094, -1094, -1093,
+		-1092, -1092, -1091, -1091, -1090, -1089, -1089, -1088, -1087, -1086, -1086, -1085,
+		-1084, -1083, -1083, -1082, -1081, -1080, -1080, -1079, -1078, -1077, -1076, -1075,
+		-1075, -1074, -1073, -1072, -1071, -1070, -1069, -1068, -1067, -1066, -1065, -1064,
+		-1063, -1062, -1061, -1060, -1059, -1058, -1057, -1056, -1055, -1054, -1053, -1052,
+		-1051, -1050, -1049, -1047, -1046, -1045, -1044, -1043, -1042, -1040, -1039, -1038,
+		-1037, -1036, -1034, -1033, -1032, -1031, -1029, -1028, -1027, -1025, -1024, -1023,
+		-1021, -1020, -1019, -1017, -1016, -1015, -1013, -1012, -1010, -1009, -1007, -1006,
+		-1005, -1003, -1002, -1000,  -999,  -997,  -996,  -994,  -993,  -991,  -989,  -988,
+		 -986,  -985,  -983,  -982,  -980,  -978,  -977,  -975,  -974,  -972,  -970,  -969,
+		 -967,  -965,  -963,  -962,  -960,  -958,  -957,  -955,  -953,  -951,  -950,  -948,
+		 -946,  -944,  -942,  -941,  -939,  -937,  -935,  -933,  -931,  -930,  -928,  -926,
+		 -924,  -922,  -920,  -918,  -916,  -914,  -912,  -910,  -909,  -907,  -905,  -903,
+		 -901,  -899,  -897,  -895,  -893,  -891,  -888,  -886,  -884,  -882,  -880,  -878,
+		 -876,  -874,  -872,  -870,  -868,  -865,  -863,  -861,  -859,  -857,  -855,  -852,
+		 -850,  -848,  -846,  -844,  -841,  -839,  -837,  -835,  -832,  -830,  -828,  -826,
+		 -823,  -821,  -819,  -816,  -814,  -812,  -809,  -807,  -805,  -802,  -800,  -798,
+		 -795,  -793,  -791,  -788,  -786,  -783,  -781,  -778,  -776,  -774,  -771,  -769,
+		 -766,  -764,  -761,  -759,  -756,  -754,  -751,  -749,  -746,  -744,  -741,  -739,
+		 -736,  -734,  -731,  -728,  -726,  -723,  -721,  -718,  -715,  -713,  -710,  -708,
+		 -705,  -702,  -700,  -697,  -694,  -692,  -689,  -686,  -684,  -681,  -678,  -676,
+		 -673,  -670,  -667,  -665,  -662,  -659,  -656,  -654,  -651,  -648,  -645,  -643,
+		 -640,  -637,  -634,  -631,  -629,  -626,  -623,  -620,  -617,  -615,  -612,  -609,
+		 -606,  -603,  -600,  -597,  -595,  -592,  -589,  -586,  -583,  -580,  -577,  -574,
+		 -571,  -568,  -565,  -562,  -560,  -557,  -554,  -551,  -548,  -545,  -542,  -539,
+		 -536,  -533,  -530,  -527,  -524,  -521,  -518,  -515,  -512,  -509,  -506,  -503,
+		 -500,  -497,  -494,  -490,  -487,  -484,  -481,  -478,  -475,  -472,  -469,  -466,
+		 -463,  -460,  -457,  -453,  -450,  -447,  -444,  -441,  -438,  -435,  -432,  -428,
+		 -425,  -422,  -419,  -416,  -413,  -409,  -406,  -403,  -400,  -397,  -394,  -390,
+		 -387,  -384,  -381,  -378,  -374,  -371,  -368,  -365,  -361,  -358,  -355,  -352,
+		 -349,  -345,  -342,  -339,  -336,  -332,  -329,  -326,  -323,  -319,  -316,  -313,
+		 -309,  -306,  -303,  -300,  -296,  -293,  -290,  -287,  -283,  -280,  -277,  -273,
+		 -270,  -267,  -263,  -260,  -257,  -253,  -250,  -247,  -243,  -240,  -237,  -233,
+		 -230,  -227,  -223,  -220,  -217,  -213,  -210,  -207,  -203,  -200,  -197,  -193,
+		 -190,  -187,  -183,  -180,  -177,  -173,  -170,  -166,  -163,  -160,  -156,  -153,
+		 -150,  -146,  -143,  -139,  -136,  -133,  -129,  -126,  -122,  -119,  -116,  -112,
+		 -109,  -106,  -102,   -99,   -95,   -92,   -89,   -85,   -82,   -78,   -75,   -72,
+		  -68,   -65,   -61,   -58,   -55,   -51,   -48,   -44,   -41,   -37,   -34,   -31,
+		  -27,   -24,   -20,   -17,   -14,   -10,    -7,    -3,     0,
+	},
+	// Electric level 8
+	{
+		    0,     4,     8,    13,    17,    21,    25,    29,    33,    38,    42,    46,
+		   50,    54,    59,    63,    67,    71,    75,    80,    84,    88,    92,    96,
+		  100,   105,   109,   113,   117,   121,   125,   130,   134,   138,   142,   146,
+		  150,   155,   159,   163,   167,   171,   175,   180,   184,   188,   192,   196,
+		  200,   204,   209,   213,   217,   221,   225,   229,   233,   237,   242,   246,
+		  250,   254,   258,   262,   266,   270,   274,   279,   283,   287,   291,   295,
+		  299,   303,   307,   311,   315,   319,   323,   328,   332,   336,   340,   344,
+		  348,   352,   356,   360,   364,   368,   372,   376,   380,   384,   388,   392,
+		  396,   400,   404,   408,   412,   416,   420,   424,   428,   432,   436,   440,
+		  444,   448,   452,   456,   460,   464,   468,   472,   475,   479,   483,   487,
+		  491,   495,   499,   503,   507,   511,   514,   518,   522,   526,   530,   534,
+		  538,   542,   545,   549,   553,   557,   561,   564,   568,   572,   576,   580,
+		  583,   587,   591,   595,   599,   602,   606,   610,   614,   617,   621,   625,
+		  628,   632,   636,   640,   643,   647,   651,   654,   658,   662,   665,   669,
+		  673,   676,   680,   684,   687,   691,   694,   698,   702,   705,   709,   712,
+		  716,   719,   723,   727,   730,   734,   737,   741,   744,   748,   751,   755,
+		  758,   762,   765,   769,   772,   775,   779,   782,   786,   789,   793,   796,
+		  799,   803,   806,   810,   813,   816,   820,   823,   826,   830,   833,   836,
+		  840,   843,   846,   849,   853,   856,   859,   862,   866,   869,   872,   875,
+		  879,   882,   885,   888,   891,   895,   898,   901,   904,   907,   910,   913,
+		  916,   920,   923,   926,   929,   932,   935,   938,   941,   944,   947,   950,
+		  953,   956,   959,   962,   965,   968,   971,   974,   977,   980,   983,   985,
+		  988,   991,   994,   997,  1000,  1003,  1006,  1008,  1011,  1014,  1017,  1020,
+		 1022,  1025,  1028,  1031,  1033,  1036,  1039,  1041,  1044,  1047,  1050,  1052,
+		 1055,  1058,  1060,  1063,  1065,  1068,  1071,  1073,  1076,  1078,  1081,  1084,
+		 1086,  1089,  1091,  1094,  1096,  1099,  1101,  1104,  1106,  1108,  1111,  1113,
+		 1116,  1118,  1121,  1123,  1125,  1128,  1130,  1132,  1135,  1137,  1139,  1142,
+		 1144,  1146,  1148,  1151,  1153,  1155,  1157,  1160,  1162,  1164,  1166,  1168,
+		 1171,  1173,  1175,  1177,  1179,  1181,  1183,  1185,  1187,  1189,  1191,  1194,
+		 1196,  1198,  1200,  1202,  1204,  1205,  1207,  1209,  1211,  1213,  1215,  1217,
+		 1219,  1221,  1223,  1225,  1226,  1228,  1230,  1232,  1234,  1235,  1237,  1239,
+		 1241,  1242,  1244,  1246,  1248,  1249,  1251,  1253,  1254,  1256,  1258,  1259,
+		 1261,  1262,  1264,  1266,  1267,  1269,  1270,  1272,  1273,  1275,  1276,  1278,
+		 1279,  1281,  1282,  1283,  1285,  1286,  1288,  1289,  1290,  1292,  1293,  1294,
+		 1296,  1297,  1298,  1300,  1301,  1302,  1303,  1305,  1306,  1307,  1308,  1309,
+		 1311,  1312,  1313,  1314,  1315,  1316,  1317,  1319,  1320,  1321,  1322,  1323,
+		 1324,  1325,  1326,  1327,  1328,  1329,  1330,  1331,  1332,  1332,  1333,  1334,
+		 1335,  1336,  1337,  1338,  1338,  1339,  1340,  1341,  1342,  1342,  1343,  1344,
+		 1345,  1345,  1346,  1347,  1347,  1348,  1349,  1349,  1350,  1351,  1351,  1352,
+		 1352,  1353,  1353,  1354,  1354,  1355,  1355,  1356,  1356,  1357,  1357,  1358,
+		 1358,  1358,  1359,  1359,  1360,  1360,  1360,  1361,  1361,  1361,  1362,  1362,
+		 1362,  1362,  1363,  1363,  1363,  1363,  1363,  1364,  1364,  1364,  1364,  1364,
+		 1364,  1364,  1364,  1365,  1365,  1365,  1365,  1365,  1365,  1365,  1365,  1365,
+		 1365,  1365,  1364,  1364,  1364,  1364,  1364,  1364,  1364,  1364,  1363,  1363,
+		 1363,  1363,  1363,  1362,  1362,  1362,  1362,  1361,  1361,  1361,  1360,  1360,
+		 1360,  1359,  1359,  1358,  1358,  1358,  1357,  1357,  1356,  1356,  1355,  1355,
+		 1354,  1354,  1353,  1353,  1352,  1352,  1351,  1351,  1350,  1349,  1349,  1348,
+		 1347,  1347,  1346,  1345,  1345,  1344,  1343,  1342,  1342,  1341,  1340,  1339,
+		 1338,  1338,  1337,  1336,  1335,  1334,  1333,  1332,  1332,  1331,  1330,  1329,
+		 1328,  1327,  1326,  1325,  1324,  1323,  1322,  1321,  1320,  1319,  1317,  1316,
+		 1315,  1314,  1313,  1312,  1311,  1309,  1308,  1307,  1306,  1305,  1303,  1302,
+		 1301,  1300,  1298,  1297,  1296,  1294,  1293,  1292,  1290,  1289,  1288,  1286,
+		 1285,  1283,  1282,  1281,  1279,  1278,  1276,  1275,  1273,  1272,  1270,  1269,
+		 1267,  1266,  1264,  1262,  1261,  1259,  1258,  1256,  1254,  1253,  1251,  1249,
+		 1248,  1246,  1244,  1242,  1241,  1239,  1237,  1235,  1234,  1232,  1230,  1228,
+		 1226,  1225,  1223,  1221,  1219,  1217,  1215,  1213,  1211,  1209,  1207,  1205,
+		 1204,  1202,  1200,  1198,  1196,  1194,  1191,  1189,  1187,  1185,  1183,  1181,
+		 1179,  1177,  1175,  1173,  1171,  1168,  1166,  1164,  1162,  1160,  1157,  1155,
+		 1153,  1151,  1148,  1146,  1144,  1142,  1139,  1137,  1135,  1132,  1130,  1128,
+		 1125,  1123,  1121,  1118,  1116,  1113,  1111,  1108,  1106,  1104,  1101,  1099,
+		 1096,  1094,  1091,  1089,  1086,  1084,  1081,  1078,  1076,  1073,  1071,  1068,
+		 1065,  1063,  1060,  1058,  1055,  1052,  1050,  1047,  1044,  1041,  1039,  1036,
+		 1033,  1031,  1028,  1025,  1022,  1020,  1017,  1014,  1011,  1008,  1006,  1003,
+		 1000,   997,   994,   991,   988,   985,   983,   980,   977,   974,   971,   968,
+		  965,   962,   959,   956,   953,   950,   947,   944,   941,   938,   935,   932,
+		  929,   926,   923,   920,   916,   913,   910,   907,   904,   901,   898,   895,
+		  891,   888,   885,   882,   879,   875,   872,   869,   866,   862,   859,   856,
+		  853,   849,   846,   843,   840,   836,   833,   830,   826,   823,   820,   816,
+		  813,   810,   806,   803,   799,   796,   793,   789,   786,   782,   779,   775,
+		  772,   769,   765,   762,   758,   755,   751,   748,   744,   741,   737,   734,
+		  730,   727,   723,   719,   716,   712,   709,   705,   702,   698,   694,   691,
+		  687,   684,   680,   676,   673,   669,   665,   662,   658,   654,   651,   647,
+		  643,   640,   636,   632,   628,   625,   621,   617,   614,   610,   606,   602,
+		  599,   595,   591,   587,   583,   580,   576,   572,   568,   564,   561,   557,
+		  553,   549,   545,   542,   538,   534,   530,   526,   522,   518,   514,   511,
+		  507,   503,   499,   495,   491,   487,   483,   479,   475,   472,   468,   464,
+		  460,   456,   452,   448,   444,   440,   436,   432,   428,   424,   420,   416,
+		  412,   408,   404,   400,   396,   392,   388,   384,   380,   376,   372,   368,
+		  364,   360,   356,   352,   348,   344,   340,   336,   332,   328,   323,   319,
+		  315,   311,   307,   303,   299,   295,   291,   287,   283,   279,   274,   270,
+		  266,   262,   258,   254,   250,   246,   242,   237,   233,   229,   225,   221,
+		  217,   213,   209,   204,   200,   196,   192,   188,   184,   180,   175,   171,
+		  167,   163,   159,   155,   150,   146,   142,   138,   134,   130,   125,   121,
+		  117,   113,   109,   105,   100,    96,    92,    88,    84,    80,    75,    71,
+		   67,    63,    59,    54,    50,    46,    42,    38,    33,    29,    25,    21,
+		   17,    13,     8,     4,     0,    -4,    -8,   -13,   -17,   -21,   -25,   -29,
+		  -33,   -38,   -42,   -46,   -50,   -54,   -59,   -63,   -67,   -71,   -75,   -80,
+		  -84,   -88,   -92,   -96,  -100,  -105,  -109,  -113,  -117,  -121,  -125,  -130,
+		 -134,  -138,  -142,  -146,  -150,  -155,  -159,  -163,  -167,  -171,  -175,  -180,
+		 -184,  -188,  -192,  -196,  -200,  -204,  -209,  -213,  -217,  -221,  -225,  -229,
+		 -233,  -237,  -242,  -246,  -250,  -254,  -258,  -262,  -266,  -270,  -274,  -279,
+		 -283,  -287,  -291,  -295,  -299,  -303,  -307,  -311,  -315,  -319,  -323,  -328,
+		 -332,  -336,  -340,  -344,  -348,  -352,  -356,  -360,  -364,  -368,  -372,  -376,
+		 -380,  -384,  -388,  -392,  -396,  -400,  -404,  -408,  -412,  -416,  -420,  -424,
+		 -428,  -432,  -436,  -440,  -444,  -448,  -452,  -456,  -460,  -464,  -468,  -472,
+		 -475,  -479,  -483,  -487,  -491,  -495,  -499,  -503,  -507,  -511,  -514,  -518,
+		 -522,  -526,  -530,  -534,  -538,  -542,  -545,  -549,  -553,  -557,  -561,  -564,
+		 -568,  -572,  -576,  -580,  -583,  -587,  -591,  -595,  -599,  -602,  -606,  -610,
+		 -614,  -617,  -621,  -625,  -628,  -632,  -636,  -640,  -643,  -647,  -651,  -654,
+		 -658,  -662,  -665,  -669,  -673,  -676,  -680,  -684,  -687,  -691,  -694,  -698,
+		 -702,  -705,  -709,  -712,  -716,  -719,  -723,  -727,  -730,  -734,  -737,  -741,
+		 -744,  -748,  -751,  -755,  -758,  -762,  -765,  -769,  -772,  -775,  -779,  -782,
+		 -786,  -789,  -793,  -796,  -799,  -803,  -806,  -810,  -813,  -816,  -820,  -823,
+		 -826,  -830,  -833,  -836,  -840,  -843,  -846,  -849,  -853,  -856,  -859,  -862,
+		 -866,  -869,  -872,  -875,  -879,  -882,  -885,  -888,  -891,  -895,  -898,  -901,
+		 -904,  -907,  -910,  -913,  -916,  -920,  -923,  -926,  -929,  -932,  -935,  -938,
+		 -941,  -944,  -947,  -950,  -953,  -956,  -959,  -962,  -965,  -968,  -971,  -974,
+		 -977,  -980,  -983,  -985,  -988,  -991,  -994,  -997, -1000, -1003, -1006, -1008,
+		-1011, -1014, -1017, -1020, -1022, -1025, -1028, -1031, -1033, -1036, -1039, -1041,
+		-1044, -1047, -1050, -1052, -1055, -1058, -1060, -1063, -1065, -1068, -1071, -1073,
+		-1076, -1078, -1081, -1084, -1086, -1089, -1091, -1094, -1096, -1099, -1101, -1104,
+		-1106, -1108, -1111, -1113, -1116, -1118, -1121, -1123, -1125, -1128, -1130, -1132,
+		-1135, -1137, -1139, -1142, -1144, -1146, -1148, -1151, -1153, -1155, -1157, -1160,
+		-1162, -1164, -1166, -1168, -1171, -1173, -1175, -1177, -1179, -1181, -1183, -1185,
+		-1187, -1189, -1191, -1194, -1196, -1198, -1200, -1202, -1204, -1205, -1207, -1209,
+		-1211, -1213, -1215, -1217, -1219, -1221, -1223, -1225, -1226, -1228, -1230, -1232,
+		-1234, -1235, -1237, -1239, -1241, -1242, -1244, -1246, -1248, -1249, -1251, -1253,
+		-1254, -1256, -1258, -1259, -1261, -1262, -1264, -1266, -1267, -1269, -1270, -1272,
+		-1273, -1275, -1276, -1278, -1279, -1281, -1282, -1283, -1285, -1286, -1288, -1289,
+		-1290, -1292, -1293, -1294, -1296, -1297, -1298, -1300, -1301, -1302, -1303, -1305,
+		-1306, -1307, -1308, -1309, -1311, -1312, -1313, -1314, -1315, -1316, -1317, -1319,
+		-1320, -1321, -1322, -1323, -1324, -1325, -1326, -1327, -1328, -1329, -1330, -1331,
+		-1332, -1332, -1333, -1334, -1335, -1336, -1337, -1338, -1338, -1339, -1340, -1341,
+		-1342, -1342, -1343, -1344, -1345, -1345, -1346, -1347, -1347, -1348, -1349, -1349,
+		-1350, -1351, -1351, -1352, -1352, -1353, -1353, -1354, -1354, -1355, -1355, -1356,
+		-1356, -1357, -1357, -1358, -1358, -1358, -1359, -1359, -1360, -1360, -1360, -1361,
+		-1361, -1361, -1362, -1362, -1362, -1362, -1363, -1363, -1363, -1363, -1363, -1364,
+		-1364, -1364, -1364, -1364, -1364, -1364, -1364, -1365, -1365, -1365, -1365, -1365,
+		-1365, -1365, -1365, -1365, -1365, -1365, -1364, -1364, -1364, -1364, -1364, -1364,
+		-1364, -1364, -1363, -1363, -1363, -1363, -1363, -1362, -1362, -1362, -1362, -1361,
+		-1361, -1361, -1360, -1360, -1360, -1359, -1359, -1358, -1358, -1358, -1357, -1357,
+		-1356, -1356, -1355, -1355, -1354, -1354, -1353, -1353, -1352, -1352, -1351, -1351,
+		-1350, -1349, -1349, -1348, -1347, -1347, -1346, -1345, -1345, -1344, -1343, -1342,
+		-1342, -1341, -1340, -1339, -1338, -1338, -1337, -1336, -1335, -1334, -1333, -1332,
+		-1332, -1331, -1330, -1329, -1328, -1327, -1326, -1325, -1324, -1323, -1322, -1321,
+		-1320, -1319, -1317, -1316, -1315, -1314, -1313, -1312, -1311, -1309, -1308, -1307,
+		-1306, -1305, -1303, -1302, -1301, -1300, -1298, -1297, -1296, -1294, -1293, -1292,
+		-1290, -1289, -1288, -1286, -1285, -1283, -1282, -1281, -1279, -1278, -1276, -1275,
+		-1273, -1272, -1270, -1269, -1267, -1266, -1264, -1262, -1261, -1259, -1258, -1256,
+		-1254, -1253, -1251, -1249, -1248, -1246, -1244, -1242, -1241, -1239, -1237, -1235,
+		-1234, -1232, -1230, -1228, -1226, -1225, -1223, -1221, -1219, -1217, -1215, -1213,
+		-1211, -1209, -1207, -1205, -1204, -1202, -1200, -1198, -1196, -1194, -1191, -1189,
+		-1187, -1185, -1183, -1181, -1179, -1177, -1175, -1173, -1171, -1168, -1166, -1164,
+		-1162, -1160, -1157, -1155, -1153, -1151, -1148, -1146, -1144, -1142, -1139, -1137,
+		-1135, -1132, -1130, -1128, -1125, -1123, -1121, -1118, -1116, -1113, -1111, -1108,
+		-1106, -1104, -1101, -1099, -1096, -1094, -1091, -1089, -1086, -1084, -1081, -1078,
+		-1076, -1073, -1071, -1068, -1065, -1063, -1060, -1058, -1055, -1052, -1050, -1047,
+		-1044, -1041, -1039, -1036, -1033, -1031, -1028, -1025, -1022, -1020, -1017, -1014,
+		-1011, -1008, -1006, -1003, -1000,  -997,  -994,  -991,  -988,  -985,  -983,  -980,
+		 -977,  -974,  -971,  -968,  -965,  -962,  -959,  -956,  -953,  -950,  -947,  -944,
+		 -941,  -938,  -935,  -932,  -929,  -926,  -923,  -920,  -916,  -913,  -910,  -907,
+		 -904,  -901,  -898,  -895,  -891,  -888,  -885,  -882,  -879,  -875,  -872,  -869,
+		 -866,  -862,  -859,  -856,  -853,  -849,  -846,  -843,  -840,  -836,  -833,  -830,
+		 -826,  -823,  -820,  -816,  -813,  -810,  -806,  -803,  -799,  -796,  -793,  -789,
+		 -786,  -782,  -779,  -775,  -772,  -769,  -765,  -762,  -758,  -755,  -751,  -748,
+		 -744,  -741,  -737,  -734,  -730,  -727,  -723,  -719,  -716,  -712,  -709,  -705,
+		 -702,  -698,  -694,  -691,  -687,  -684,  -680,  -676,  -673,  -669,  -665,  -662,
+		 -658,  -654,  -651,  -647,  -643,  -640,  -636,  -632,  -628,  -625,  -621,  -617,
+		 -614,  -610,  -606,  -602,  -599,  -595,  -591,  -587,  -583,  -580,  -576,  -572,
+		 -568,  -564,  -561,  -557,  -553,  -549,  -545,  -542,  -538,  -534,  -530,  -526,
+		 -522,  -518,  -514,  -511,  -507,  -503,  -499,  -495,  -491,  -487,  -483,  -479,
+		 -475,  -472,  -468,  -464,  -460,  -456,  -452,  -448,  -444,  -440,  -436,  -432,
+		 -428,  -424,  -420,  -416,  -412,  -408,  -404,  -400,  -396,  -392,  -388,  -384,
+		 -380,  -376,  -372,  -368,  -364,  -360,  -356,  -352,  -348,  -344,  -340,  -336,
+		 -332,  -328,  -323,  -319,  -315,  -311,  -307,  -303,  -299,  -295,  -291,  -287,
+		 -283,  -279,  -274,  -270,  -266,  -262,  -258,  -254,  -250,  -246,  -242,  -237,
+		 -233,  -229,  -225,  -221,  -217,  -213,  -209,  -204,  -200,  -196,  -192,  -188,
+		 -184,  -180,  -175,  -171,  -167,  -163,  -159,  -155,  -150,  -146,  -142,  -138,
+		 -134,  -130,  -125,  -121,  -117,  -113,  -109,  -105,  -100,   -96,   -92,   -88,
+		  -84,   -80,   -75,   -71,   -67,   -63,   -59,   -54,   -50,   -46,   -42,   -38,
+		  -33,   -29,   -25,   -21,   -17,   -13,    -8,    -4,     0,
+	},
+#endif
+};
+
+FASTDATA const int16_t *const wavetables[NUM_MODES][MIPMAP_LEVELS] = {
+#if MAX_NOTES <= 48
+	{wavetable_data[0], wavetable_data[0], wavetable_data[0], wavetable_data[0], wavetable_data[0]}, // Piano
+	{wavetable_data[1], wavetable_data[1], wavetable_data[1], wavetable_data[1], wavetable_data[1]}, // Alt Sax
+	{wavetable_data[2], wavetable_data[2], wavetable_data[2], wavetable_data[2], wavetable_data[2]}, // Bright
+	{wavetable_data[3], wavetable_data[3], wavetable_data[3], wavetable_data[3], wavetable_data[3]}, // Electric
+#elif MAX_NOTES <= 96
+	{wavetable_data[0], wavetable_data[0], wavetable_data[0], wavetable_data[0], wavetable_data[0], wavetable_data[0], wavetable_data[0], wavetable_data[4], wavetable_data[7]}, // Piano
+	{wavetable_data[1], wavetable_data[1], wavetable_data[1], wavetable_data[1], wavetable_data[1], wavetable_data[1], wavetable_data[1], wavetable_data[1], wavetable_data[1]}, // Alt Sax
+	{wavetable_data[2], wavetable_data[2], wavetable_data[2], wavetable_data[2], wavetable_data[2], wavetable_data[2], wavetable_data[2], wavetable_data[5], wavetable_data[8]}, // Bright
+	{wavetable_data[3], wavetable_data[3], wavetable_data[3], wavetable_data[3], wavetable_data[3], wavetable_data[3], wavetable_data[3], wavetable_data[6], wavetable_data[9]}, // Electric
+#endif
+};
+#else
+#error "No wavetables for AUDIO_WAVETABLE_BITS, add it to Tools/gen_tables.py"
+#endif
+
+FASTDATA const int16_t soft_clip[SOFT_CLIP_SIZE] = {
+	   0,    1,    2,    3,    4,    5,    6,    7,    8,    9,   10,   11,   12,   13,   14,   15,
+	  16,   17,   18,   19,   20,   21,   22,   23,   24,   25,   26,   27,   28,   29,   30,   31,
+	  32,   33,   34,   35,   36,   37,   38,   39,   40,   41,   42,   43,   44,   45,   46,   47,
+	  48,   49,   50,   51,   52,   53,   54,   55,   56,   57,   58,   59,   60,   61,   62,   63,
+	  64,   65,   66,   67,   68,   69,   70,   71,   72,   73,   74,   75,   76,   77,   78,   79,
+	  80,   81,   82,   83,   84,   85,   86,   87,   88,   89,   90,   91,   92,   93,   94,   95,
+	  96,   97,   98,   99,  100,  101,  102,  103,  104,  105,  106,  107,  108,  109,  110,  111,
+	 112,  113,  114,  115,  116,  117,  118,  119,  120,  121,  122,  123,  124,  125,  126,  127,
+	 128,  129,  130,  131,  132,  133,  134,  135,  136,  137,  138,  139,  140,  141,  142,  143,
+	 144,  145,  146,  147,  148,  149,  150,  151,  152,  153,  154,  155,  156,  157,  158,  159,
+	 160,  161,  162,  163,  164,  165,  166,  167,  168,  169,  170,  171,  172,  173,  174,  175,
+	 176,  177,  178,  179,  180,  181,  182,  183,  184,  185,  186,  187,  188,  189,  190,  191,
+	 192,  193,  194,  195,  196,  197,  198,  199,  200,  201,  202,  203,  204,  205,  206,  207,
+	 208,  209,  210,  211,  212,  213,  214,  215,  216,  217,  218,  219,  220,  221,  222,  223,
+	 224,  225,  226,  227,  228,  229,  230,  231,  232,  233,  234,  235,  236,  237,  238,  239,
+	 240,  241,  242,  243,  244,  245,  246,  247,  248,  249,  250,  251,  252,  253,  254,  255,
+	 256,  257,  258,  259,  260,  261,  262,  263,  264,  265,  266,  267,  268,  269,  270,  271,
+	 272,  273,  274,  275,  276,  277,  278,  279,  280,  281,  282,  283,  284,  285,  286,  287,
+	 288,  289,  290,  291,  292,  293,  294,  295,  296,  297,  298,  299,  300,  301,  302,  303,
+	 304,  305,  306,  307,  308,  309,  310,  311,  312,  313,  314,  315,  316,  317,  318,  319,
+	 320,  321,  322,  323,  324,  325,  326,  327,  328,  329,  330,  331,  332,  333,  334,  335,
+	 336,  337,  338,  339,  340,  341,  342,  343,  344,  345,  346,  347,  348,  349,  350,  351,
+	 352,  353,  354,  355,  356,  357,  358,  359,  360,  361,  362,  363,  364,  365,  366,  367,
+	 368,  369,  370,  371,  372,  373,  374,  375,  376,  377,  378,  379,  380,  381,  382,  383,
+	 384,  385,  386,  387,  388,  389,  390,  391,  392,  393,  394,  395,  396,  397,  398,  399,
+	 400,  401,  402,  403,  404,  405,  406,  407,  408,  409,  410,  411,  412,  413,  414,  415,
+	 416,  417,  418,  419,  420,  421,  422,  423,  424,  425,  426,  427,  428,  429,  430,  431,
+	 432,  433,  434,  435,  436,  437,  438,  439,  440,  441,  442,  443,  444,  445,  446,  447,
+	 448,  449,  450,  451,  452,  453,  454,  455,  456,  457,  458,  459,  460,  461,  462,  463,
+	 464,  465,  466,  467,  468,  469,  470,  471,  472,  473,  474,  475,  476,  477,  478,  479,
+	 480,  481,  482,  483,  484,  485,  486,  487,  488,  489,  490,  491,  492,  493,  494,  495,
+	 496,  497,  498,  499,  500,  501,  502,  503,  504,  505,  506,  507,  508,  509,  510,  511,
+	 512,  513,  514,  515,  516,  517,  518,  519,  520,  521,  522,  523,  524,  525,  526,  527,
+	 528,  529,  530,  531,  532,  533,  534,  535,  536,  537,  538,  539,  540,  541,  542,  543,
+	 544,  545,  546,  547,  548,  549,  550,  551,  552,  553,  554,  555,  556,  557,  558,  559,
+	 560,  561,  562,  563,  564,  565,  566,  567,  568,  569,  570,  571,  572,  573,  574,  575,
+	 576,  577,  578,  579,  580,  581,  582,  583,  584,  585,  586,  587,  588,  589,  590,  591,
+	 592,  593,  594,  595,  596,  597,  598,  599,  600,  601,  602,  603,  604,  605,  606,  607,
+	 608,  609,  610,  611,  612,  613,  614,  615,  616,  617,  618,  619,  620,  621,  622,  623,
+	 624,  625,  626,  627,  628,  629,  630,  631,  632,  633,  634,  635,  636,  637,  638,  639,
+	 640,  641,  642,  643,  644,  645,  646,  647,  648,  649,  650,  651,  652,  653,  654,  655,
+	 656,  657,  658,  659,  660,  661,  662,  663,  664,  665,  666,  667,  668,  669,  670,  671,
+	 672,  673,  674,  675,  676,  677,  678,  679,  680,  681,  682,  683,  684,  685,  686,  687,
+	 688,  689,  690,  691,  692,  693,  694,  695,  696,  697,  698,  699,  700,  701,  702,  703,
+	 704,  705,  706,  707,  708,  709,  710,  711,  712,  713,  714,  715,  716,  717,  718,  719,
+	 720,  721,  722,  723,  724,  725,  726,  727,  728,  729,  730,  731,  732,  733,  734,  735,
+	 736,  737,  738,  739,  740,  741,  742,  743,  744,  745,  746,  747,  748,  749,  750,  751,
+	 752,  753,  754,  755,  756,  757,  758,  759,  760,  761,  762,  763,  764,  765,  766,  767,
+	 768,  769,  770,  771,  772,  773,  774,  775,  776,  777,  778,  779,  780,  781,  782,  783,
+	 784,  785,  786,  787,  788,  789,  790,  791,  792,  793,  794,  795,  796,  797,  798,  799,
+	 800,  801,  802,  803,  804,  805,  806,  807,  808,  809,  810,  811,  812,  813,  814,  815,
+	 816,  817,  818,  819,  820,  821,  822,  823,  824,  825,  826,  827,  828,  829,  830,  831,
+	 832,  833,  834,  835,  836,  837,  838,  839,  840,  841,  842,  843,  844,  845,  846,  847,
+	 848,  849,  850,  851,  852,  853,  854,  855,  856,  857,  858,  859,  860,  861,  862,  863,
+	 864,  865,  866,  867,  868,  869,  870,  871,  872,  873,  874,  875,  876,  877,  878,  879,
+	 880,  881,  882,  883,  884,  885,  886,  887,  888,  889,  890,  891,  892,  893,  894,  895,
+	 896,  897,  898,  899,  900,  901,  902,  903,  904,  905,  906,  907,  908,  909,  910,  911,
+	 912,  913,  914,  915,  916,  917,  918,  919,  920,  921,  922,  923,  924,  925,  926,  927,
+	 928,  929,  930,  931,  932,  933,  934,  935,  936,  937,  938,  939,  940,  941,  942,  943,
+	 944,  945,  946,  947,  948,  949,  950,  951,  952,  953,  954,  955,  956,  957,  958,  959,
+	 960,  961,  962,  963,  964,  965,  966,  967,  968,  969,  970,  971,  972,  973,  974,  975,
+	 976,  977,  978,  979,  980,  981,  982,  983,  984,  985,  986,  987,  988,  989,  990,  991,
+	 992,  993,  994,  995,  996,  997,  998,  999, 1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007,
+	1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023,
+	1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039,
+	1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055,
+	1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071,
+	1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087,
+	1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103,
+	1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119,
+	1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 1135,
+	1136, 1137, 1138, 1139, 1139, 1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150,
+	1151, 1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166,
+	1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182,
+	1183, 1184, 1185, 1186, 1187, 1188, 1189, 1190, 1190, 1191, 1192, 1193, 1194, 1195, 1196, 1197,
+	1198, 1199, 1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213,
+	1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221, 1221, 1222, 1223, 1224, 1225, 1226, 1227, 1228,
+	1229, 1230, 1231, 1232, 1233, 1234, 1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244,
+	1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257, 1258, 1259,
+	1260, 1261, 1262, 1263, 1263, 1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274,
+	1275, 1276, 1277, 1278, 1279, 1279, 1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289,
+	1290, 1291, 1292, 1293, 1293, 1294, 1295, 1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304,
+	1305, 1306, 1306, 1307, 1308, 1309, 1310, 1311, 1312, 1313, 1314, 1315, 1316, 1317, 1317, 1318,
+	1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327, 1328, 1328, 1329, 1330, 1331, 1332, 1333,
+	1334, 1335, 1336, 1337, 1338, 1338, 1339, 1340, 1341, 1342, 1343, 1344, 1345, 1346, 1347, 1347,
+	1348, 1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1356, 1357, 1358, 1359, 1360, 1361, 1362,
+	1363, 1364, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1372, 1373, 1374, 1375, 1376,
+	1377, 1378, 1379, 1380, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1387, 1388, 1389, 1390,
+	1391, 1392, 1393, 1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1400, 1401, 1402, 1403, 1404,
+	1405, 1406, 1406, 1407, 1408, 1409, 1410, 1411, 1412, 1412, 1413, 1414, 1415, 1416, 1417, 1418,
+	1418, 1419, 1420, 1421, 1422, 1423, 1424, 1424, 1425, 1426, 1427, 1428, 1429, 1429, 1430, 1431,
+	1432, 1433, 1434, 1434, 1435, 1436, 1437, 1438, 1439, 1440, 1440, 1441, 1442, 1443, 1444, 1445,
+	1445, 1446, 1447, 1448, 1449, 1449, 1450, 1451, 1452, 1453, 1454, 1454, 1455, 1456, 1457, 1458,
+	1459, 1459, 1460, 1461, 1462, 1463, 1463, 1464, 1465, 1466, 1467, 1468, 1468, 1469, 1470, 1471,
+	1472, 1472, 1473, 1474, 1475, 1476, 1476, 1477, 1478, 1479, 1480, 1480, 1481, 1482, 1483, 1484,
+	1484, 1485, 1486, 1487, 1488, 1488, 1489, 1490, 1491, 1492, 1492, 1493, 1494, 1495, 1495, 1496,
+	1497, 1498, 1499, 1499, 1500, 1501, 1502, 1503, 1503, 1504, 1505, 1506, 1506, 1507, 1508, 1509,
+	1510, 1510, 1511, 1512, 1513, 1513, 1514, 1515, 1516, 1516, 1517, 1518, 1519, 1520, 1520, 1521,
+	1522, 1523, 1523, 1524, 1525, 1526, 1526, 1527, 1528, 1529, 1529, 1530, 1531, 1532, 1532, 1533,
+	1534, 1535, 1535, 1536, 1537, 1538, 1538, 1539, 1540, 1541, 1541, 1542, 1543, 1544, 1544, 1545,
+	1546, 1547, 1547, 1548, 1549, 1550, 1550, 1551, 1552, 1553, 1553, 1554, 1555, 1555, 1556, 1557,
+	1558, 1558, 1559, 1560, 1561, 1561, 1562, 1563, 1563, 1564, 1565, 1566, 1566, 1567, 1568, 1568,
+	1569, 1570, 1571, 1571, 1572, 1573, 1573, 1574, 1575, 1576, 1576, 1577, 1578, 1578, 1579, 1580,
+	1581, 1581, 1582, 1583, 1583, 1584, 1585, 1585, 1586, 1587, 1588, 1588, 1589, 1590, 1590, 1591,
+	1592, 1592, 1593, 1594, 1594, 1595, 1596, 1597, 1597, 1598, 1599, 1599, 1600, 1601, 1601, 1602,
+	1603, 1603, 1604, 1605, 1605, 1606, 1607, 1607, 1608, 1609, 1609, 1610, 1611, 1611, 1612, 1613,
+	1613, 1614, 1615, 1615, 1616, 1617, 1617, 1618, 1619, 1619, 1620, 1621, 1621, 1622, 1623, 1623,
+	1624, 1625, 1625, 1626, 1627, 1627, 1628, 1629, 1629, 1630, 1631, 1631, 1632, 1632, 1633, 1634,
+	1634, 1635, 1636, 1636, 1637, 1638, 1638, 1639, 1640, 1640, 1641, 1641, 1642, 1643, 1643, 1644,
+	1645, 1645, 1646, 1647, 1647, 1648, 1648, 1649, 1650, 1650, 1651, 1652, 1652, 1653, 1653, 1654,
+	1655, 1655, 1656, 1657, 1657, 1658, 1658, 1659, 1660, 1660, 1661, 1661, 1662, 1663, 1663, 1664,
+	1664, 1665, 1666, 1666, 1667, 1667, 1668, 1669, 1669, 1670, 1671, 1671, 1672, 1672, 1673, 1674,
+	1674, 1675, 1675, 1676, 1676, 1677, 1678, 1678, 1679, 1679, 1680, 1681, 1681, 1682, 1682, 1683,
+	1684, 1684, 1685, 1685, 1686, 1686, 1687, 1688, 1688, 1689, 1689, 1690, 1690, 1691, 1692, 1692,
+	1693, 1693, 1694, 1695, 1695, 1696, 1696, 1697, 1697, 1698, 1698, 1699, 1700, 1700, 1701, 1701,
+	1702, 1702, 1703, 1704, 1704, 1705, 1705, 1706, 1706, 1707, 1707, 1708, 1709, 1709, 1710, 1710,
+	1711, 1711, 1712, 1712, 1713, 1713, 1714, 1715, 1715, 1716, 1716, 1717, 1717, 1718, 1718, 1719,
+	1719, 1720, 1721, 1721, 1722, 1722, 1723, 1723, 1724, 1724, 1725, 1725, 1726, 1726, 1727, 1727,
+	1728, 1728, 1729, 1730, 1730, 1731, 1731, 1732, 1732, 1733, 1733, 1734, 1734, 1735, 1735, 1736,
+	1736, 1737, 1737, 1738, 1738, 1739, 1739, 1740, 1740, 1741, 1741, 1742, 1742, 1743, 1743, 1744,
+	1744, 1745, 1745, 1746, 1746, 1747, 1747, 1748, 1748, 1749, 1749, 1750, 1750, 1751, 1751, 1752,
+	1752, 1753, 1753, 1754, 1754, 1755, 1755, 1756, 1756, 1757, 1757, 1758, 1758, 1759, 1759, 1760,
+	1760, 1761, 1761, 1762, 1762, 1763, 1763, 1764, 1764, 1765, 1765, 1765, 1766, 1766, 1767, 1767,
+	1768, 1768, 1769, 1769, 1770, 1770, 1771, 1771, 1772, 1772, 1772, 1773, 1773, 1774, 1774, 1775,
+	1775, 1776, 1776, 1777, 1777, 1778, 1778, 1778, 1779, 1779, 1780, 1780, 1781, 1781, 1782, 1782,
+	1783, 1783, 1783, 1784, 1784, 1785, 1785, 1786, 1786, 1787, 1787, 1787, 1788, 1788, 1789, 1789,
+	1790, 1790, 1791, 1791, 1791, 1792, 1792, 1793, 1793, 1794, 1794, 1794, 1795, 1795, 1796, 1796,
+	1797, 1797, 1797, 1798, 1798, 1799, 1799, 1800, 1800, 1800, 1801, 1801, 1802, 1802, 1803, 1803,
+	1803, 1804, 1804, 1805, 1805, 1806, 1806, 1806, 1807, 1807, 1808, 1808, 1808, 1809, 1809, 1810,
+	1810, 1810, 1811, 1811, 1812, 1812, 1812, 1813, 1813, 1814, 1814, 1815, 1815, 1815, 1816, 1816,
+	1817, 1817, 1817, 1818, 1818, 1819, 1819, 1819, 1820, 1820, 1820, 1821, 1821, 1822, 1822, 1822,
+	1823, 1823, 1824, 1824, 1824, 1825, 1825, 1826, 1826, 1826, 1827, 1827, 1827, 1828, 1828, 1829,
+	1829, 1829, 1830, 1830, 1831, 1831, 1831, 1832, 1832, 1832, 1833, 1833, 1834, 1834, 1834, 1835,
+	1835, 1835, 1836, 1836, 1836, 1837, 1837, 1838, 1838, 1838, 1839, 1839, 1839, 1840, 1840, 1841,
+	1841, 1841, 1842, 1842, 1842, 1843, 1843, 1843, 1844, 1844, 1844, 1845, 1845, 1846, 1846, 1846,
+	1847, 1847, 1847, 1848, 1848, 1848, 1849, 1849, 1849, 1850, 1850, 1850, 1851, 1851, 1851, 1852,
+	1852, 1853, 1853, 1853, 1854, 1854, 1854, 1855, 1855, 1855, 1856, 1856, 1856, 1857, 1857, 1857,
+	1858, 1858, 1858, 1859, 1859, 1859, 1860, 1860, 1860, 1861, 1861, 1861, 1862, 1862, 1862, 1863,
+	1863, 1863, 1864, 1864, 1864, 1865, 1865, 1865, 1866, 1866, 1866, 1867, 1867, 1867, 1867, 1868,
+	1868, 1868, 1869, 1869, 1869, 1870, 1870, 1870, 1871, 1871, 1871, 1872, 1872, 1872, 1873, 1873,
+	1873, 1873, 1874, 1874, 1874, 1875, 1875, 1875, 1876, 1876, 1876, 1877, 1877, 1877, 1877, 1878,
+	1878, 1878, 1879, 1879, 1879, 1880, 1880, 1880, 1880, 1881, 1881, 1881, 1882, 1882, 1882, 1883,
+	1883, 1883, 1883, 1884, 1884, 1884, 1885, 1885, 1885, 1885, 1886, 1886, 1886, 1887, 1887, 1887,
+	1887, 1888, 1888, 1888, 1889, 1889, 1889, 1889, 1890, 1890, 1890, 1891, 1891, 1891, 1891, 1892,
+	1892, 1892, 1893, 1893, 1893, 1893, 1894, 1894, 1894, 1895, 1895, 1895, 1895, 1896, 1896, 1896,
+	1896, 1897, 1897, 1897, 1898, 1898, 1898, 1898, 1899, 1899, 1899, 1899, 1900, 1900, 1900, 1900,
+	1901, 1901, 1901, 1902, 1902, 1902, 1902, 1903, 1903, 1903, 1903, 1904, 1904, 1904, 1904, 1905,
+	1905, 1905, 1905, 1906, 1906, 1906, 1906, 1907, 1907, 1907, 1908, 1908, 1908, 1908, 1909, 1909,
+	1909, 1909, 1910, 1910, 1910, 1910, 1911, 1911, 1911, 1911, 1912, 1912, 1912, 1912, 1913, 1913,
+	1913, 1913, 1913, 1914, 1914, 1914, 1914, 1915, 1915, 1915, 1915, 1916, 1916, 1916, 1916, 1917,
+	1917, 1917, 1917, 1918, 1918, 1918, 1918, 1919, 1919, 1919, 1919, 1919, 1920, 1920, 1920, 1920,
+	1921, 1921, 1921, 1921, 1922, 1922, 1922, 1922, 1922, 1923, 1923, 1923, 1923, 1924, 1924, 1924,
+	1924, 1924, 1925, 1925, 1925, 1925, 1926, 1926, 1926, 1926, 1927, 1927, 1927, 1927, 1927, 1928,
+	1928, 1928, 1928, 1928, 1929, 1929, 1929, 1929, 1930, 1930, 1930, 1930, 1930, 1931, 1931, 1931,
+	1931, 1932, 1932, 1932, 1932, 1932, 1933, 1933, 1933, 1933, 1933, 1934, 1934, 1934, 1934, 1934,
+	1935, 1935, 1935, 1935, 1935, 1936, 1936, 1936, 1936, 1937, 1937, 1937, 1937, 1937, 1938, 1938,
+	1938, 1938, 1938, 1939, 1939, 1939, 1939, 1939, 1940, 1940, 1940, 1940, 1940, 1941, 1941, 1941,
+	1941, 1941, 1942, 1942, 1942, 1942, 1942, 1942, 1943, 1943, 1943, 1943, 1943, 1944, 1944, 1944,
+	1944, 1944, 1945, 1945, 1945, 1945, 1945, 1946, 1946, 1946, 1946, 1946, 1946, 1947, 1947, 1947,
+	1947, 1947, 1948, 1948, 1948, 1948, 1948, 1949, 1949, 1949, 1949, 1949, 1949, 1950, 1950, 1950,
+	1950, 1950, 1951, 1951, 1951, 1951, 1951, 1951, 1952, 1952, 1952, 1952, 1952, 1952, 1953, 1953,
+	1953, 1953, 1953, 1954, 1954, 1954, 1954, 1954, 1954, 1955, 1955, 1955, 1955, 1955, 1955, 1956,
+	1956, 1956, 1956, 1956, 1956, 1957, 1957, 1957, 1957, 1957, 1957, 1958, 1958, 1958, 1958, 1958,
+	1958, 1959, 1959, 1959, 1959, 1959, 1959, 1960, 1960, 1960, 1960, 1960, 1960, 1961, 1961, 1961,
+	1961, 1961, 1961, 1962, 1962, 1962, 1962, 1962, 1962, 1962, 1963, 1963, 1963, 1963, 1963, 1963,
+	1964, 1964, 1964, 1964, 1964, 1964, 1965, 1965, 1965, 1965, 1965, 1965, 1965, 1966, 1966, 1966,
+	1966, 1966, 1966, 1967, 1967, 1967, 1967, 1967, 1967, 1967, 1968, 1968, 1968, 1968, 1968, 1968,
+	1968, 1969, 1969, 1969, 1969, 1969, 1969, 1969, 1970, 1970, 1970, 1970, 1970, 1970, 1970, 1971,
+	1971, 1971, 1971, 1971, 1971, 1971, 1972, 1972, 1972, 1972, 1972, 1972, 1972, 1973, 1973, 1973,
+	1973, 1973, 1973, 1973, 1974, 1974, 1974, 1974, 1974, 1974, 1974, 1975, 1975, 1975, 1975, 1975,
+	1975, 1975, 1976, 1976, 1976, 1976, 1976, 1976, 1976, 1976, 1977, 1977, 1977, 1977, 1977, 1977,
+	1977, 1978, 1978, 1978, 1978, 1978, 1978, 1978, 1978, 1979, 1979, 1979, 1979, 1979, 1979, 1979,
+	1979, 1980, 1980, 1980, 1980, 1980, 1980, 1980, 1980, 1981, 1981, 1981, 1981, 1981, 1981, 1981,
+	1981, 1982, 1982, 1982, 1982, 1982, 1982, 1982, 1982, 1983, 1983, 1983, 1983, 1983, 1983, 1983,
+	1983, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1985, 1985, 1985, 1985, 1985, 1985,
+	1985, 1985, 1986, 1986, 1986, 1986, 1986, 1986, 1986, 1986, 1986, 1987, 1987, 1987, 1987, 1987,
+	1987, 1987, 1987, 1987, 1988, 1988, 1988, 1988, 1988, 1988, 1988, 1988, 1989, 1989, 1989, 1989,
+	1989, 1989, 1989, 1989, 1989, 1989, 1990, 1990, 1990, 1990, 1990, 1990, 1990, 1990, 1990, 1991,
+	1991, 1991, 1991, 1991, 1991, 1991, 1991, 1991, 1992, 1992, 1992, 1992, 1992, 1992, 1992, 1992,
+	1992, 1992, 1993, 1993, 1993, 1993, 1993, 1993, 1993, 1993, 1993, 1994, 1994, 1994, 1994, 1994,
+	1994, 1994, 1994, 1994, 1994, 1995, 1995, 1995, 1995, 1995, 1995, 1995, 1995, 1995, 1995, 1995,
+	1996, 1996, 1996, 1996, 1996, 1996, 1996, 1996, 1996, 1996, 1997, 1997, 1997, 1997, 1997, 1997,
+	1997, 1997, 1997, 1997, 1998, 1998, 1998, 1998, 1998, 1998, 1998, 1998, 1998, 1998, 1998, 1999,
+	1999, 1999, 1999, 1999, 1999, 1999, 1999, 1999, 1999, 1999, 2000, 2000, 2000, 2000, 2000, 2000,
+	2000, 2000, 2000, 2000, 2000, 2001, 2001, 2001, 2001, 2001, 2001, 2001, 2001, 2001, 2001, 2001,
+	2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2003, 2003, 2003, 2003,
+	2003, 2003, 2003, 2003, 2003, 2003, 2003, 2003, 2004, 2004, 2004, 2004, 2004, 2004, 2004, 2004,
+	2004, 2004, 2004, 2004, 2005, 2005, 2005, 2005, 2005, 2005, 2005, 2005, 2005, 2005, 2005, 2005,
+	2005, 2006, 2006, 2006, 2006, 2006, 2006, 2006, 2006, 2006, 2006, 2006, 2006, 2007, 2007, 2007,
+	2007, 2007, 2007, 2007, 2007, 2007, 2007, 2007, 2007, 2007, 2008, 2008, 2008, 2008, 2008, 2008,
+	2008, 2008, 2008, 2008, 2008, 2008, 2008, 2008, 2009, 2009, 2009, 2009, 2009, 2009, 2009, 2009,
+	2009, 2009, 2009, 2009, 2009, 2010, 2010, 2010, 2010, 2010, 2010, 2010, 2010, 2010, 2010, 2010,
+	2010, 2010, 2010, 2010, 2011, 2011, 2011, 2011, 2011, 2011, 2011, 2011, 2011, 2011, 2011, 2011,
+	2011, 2011, 2012, 2012, 2012, 2012, 2012, 2012, 2012, 2012, 2012, 2012, 2012, 2012, 2012, 2012,
+	2012, 2013, 2013, 2013, 2013, 2013, 2013, 2013, 2013, 2013, 2013, 2013, 2013, 2013, 2013, 2013,
+	2014, 2014, 2014, 2014, 2014, 2014, 2014, 2014, 2014, 2014, 2014, 2014, 2014, 2014, 2014, 2014,
+	2015, 2015, 2015, 2015, 2015, 2015, 2015, 2015, 2015, 2015, 2015, 2015, 2015, 2015, 2015, 2015,
+	2016, 2016, 2016, 2016, 2016, 2016, 2016, 2016, 2016, 2016, 2016, 2016, 2016, 2016, 2016, 2016,
+	2016, 2017, 2017, 2017, 2017, 2017, 2017, 2017, 2017, 2017, 2017, 2017, 2017, 2017, 2017, 2017,
+	2017, 2017, 2018, 2018, 2018, 2018, 2018, 2018, 2018, 2018, 2018, 2018, 2018, 2018, 2018, 2018,
+	2018, 2018, 2018, 2018, 2019, 2019, 2019, 2019, 2019, 2019, 2019, 2019, 2019, 2019, 2019, 2019,
+	2019, 2019, 2019, 2019, 2019, 2019, 2019, 2020, 2020, 2020, 2020, 2020, 2020, 2020, 2020, 2020,
+	2020, 2020, 2020, 2020, 2020, 2020, 2020, 2020, 2020, 2020, 2021, 2021, 2021, 2021, 2021, 2021,
+	2021, 2021, 2021, 2021, 2021, 2021, 2021, 2021, 2021, 2021, 2021, 2021, 2021, 2021, 2022, 2022,
+	2022, 2022, 2022, 2022, 2022, 2022, 2022, 2022, 2022, 2022, 2022, 2022, 2022, 2022, 2022, 2022,
+	2022, 2022, 2022, 2023, 2023, 2023, 2023, 2023, 2023, 2023, 2023, 2023, 2023, 2023, 2023, 2023,
+	2023, 2023, 2023, 2023, 2023, 2023, 2023, 2023, 2024, 2024, 2024, 2024, 2024, 2024, 2024, 2024,
+	2024, 2024, 2024, 2024, 2024, 2024, 2024, 2024, 2024, 2024, 2024, 2024, 2024, 2024, 2024, 2025,
+	2025, 2025, 2025, 2025, 2025, 2025, 2025, 2025, 2025, 2025, 2025, 2025, 2025, 2025, 2025, 2025,
+	2025, 2025, 2025, 2025, 2025, 2025, 2026, 2026, 2026, 2026, 2026, 2026, 2026, 2026, 2026, 2026,
+	2026, 2026, 2026, 2026, 2026, 2026, 2026, 2026, 2026, 2026, 2026, 2026, 2026, 2026, 2026, 2027,
+	2027, 2027, 2027, 2027, 2027, 2027, 2027, 2027, 2027, 2027, 2027, 2027, 2027, 2027, 2027, 2027,
+	2027, 2027, 2027, 2027, 2027, 2027, 2027, 2027, 2027, 2028, 2028, 2028, 2028, 2028, 2028, 2028,
+	2028, 2028, 2028, 2028, 2028, 2028, 2028, 2028, 2028, 2028, 2028, 2028, 2028, 2028, 2028, 2028,
+	2028, 2028, 2028, 2028, 2029, 2029, 2029, 2029, 2029, 2029, 2029, 2029, 2029, 2029, 2029, 2029,
+	2029, 2029, 2029, 2029, 2029, 2029, 2029, 2029, 2029, 2029, 2029, 2029, 2029, 2029, 2029, 2029,
+	2029, 2030, 2030, 2030, 2030, 2030, 2030, 2030, 2030, 2030, 2030, 2030, 2030, 2030, 2030, 2030,
+	2030, 2030, 2030, 2030, 2030, 2030, 2030, 2030, 2030, 2030, 2030, 2030, 2030, 2030, 2030, 2031,
+	2031, 2031, 2031, 2031, 2031, 2031, 2031, 2031, 2031, 2031, 2031, 2031, 2031, 2031, 2031, 2031,
+	2031, 2031, 2031, 2031, 2031, 2031, 2031, 2031, 2031, 2031, 2031, 2031, 2031, 2031, 2031, 2032,
+	2032, 2032, 2032, 2032, 2032, 2032, 2032, 2032, 2032, 2032, 2032, 2032, 2032, 2032, 2032, 2032,
+	2032, 2032, 2032, 2032, 2032, 2032, 2032, 2032, 2032, 2032, 2032, 2032, 2032, 2032, 2032, 2032,
+	2032, 2032, 2033, 2033, 2033, 2033, 2033, 2033, 2033, 2033, 2033, 2033, 2033, 2033, 2033, 2033,
+	2033, 2033, 2033, 2033, 2033, 2033, 2033, 2033, 2033, 2033, 2033, 2033, 2033, 2033, 2033, 2033,
+	2033, 2033, 2033, 2033, 2033, 2033, 2034, 2034, 2034, 2034, 2034, 2034, 2034, 2034, 2034, 2034,
+	2034, 2034, 2034, 2034, 2034, 2034, 2034, 2034, 2034, 2034, 2034, 2034, 2034, 2034, 2034, 2034,
+	2034, 2034, 2034, 2034, 2034, 2034, 2034, 2034, 2034, 2034, 2034, 2034, 2034, 2034, 2035, 2035,
+	2035, 2035, 2035, 2035, 2035, 2035, 2035, 2035, 2035, 2035, 2035, 2035, 2035, 2035, 2035, 2035,
+	2035, 2035, 2035, 2035, 2035, 2035, 2035, 2035, 2035, 2035, 2035, 2035, 2035, 2035, 2035, 2035,
+	2035, 2035, 2035, 2035, 2035, 2035, 2035, 2035, 2035, 2036, 2036, 2036, 2036, 2036, 2036, 2036,
+	2036, 2036, 2036, 2036, 2036, 2036, 2036, 2036, 2036, 2036, 2036, 2036, 2036, 2036, 2036, 2036,
+	2036, 2036, 2036, 2036, 2036, 2036, 2036, 2036, 2036, 2036, 2036, 2036, 2036, 2036, 2036, 2036,
+	2036, 2036, 2036, 2036, 2036, 2036, 2036, 2036, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
+	2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
+	2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037,
+	2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2038, 2038, 2038, 2038, 2038,
+	2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038,
+	2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038,
+	2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038, 2038,
+	2038, 2038, 2038, 2038, 2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039,
+	2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039,
+	2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039,
+	2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039, 2039,
+	2039, 2039, 2039, 2039, 2039, 2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040,
+	2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040,
+	2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040,
+	2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040,
+	2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040, 2040, 2041, 2041,
+	2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041,
+	2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041,
+	2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041,
+	2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041,
+	2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041, 2041,
+	2041, 2041, 2041, 2041, 2042, 2042, 2042, 2042, 2042, 2042, 2042, 2042, 2042, 2042, 2042, 2042,
+	2042, 2042, 2042, 2042, 2042, 2042, 2042, 2042, 2042, 2042, 2042, 2042, 2042, 2042, 2042, 2042,
+	2042, 2042, 2042, 2042, 2042, 2042, 2042, 2042, 2042, 2042, 2042, 2042, 2042, 2042, 2042, 2042,
+};
+
+#if AUDIO_SAMPLE_RATE == 32000
+// TIM4 actually runs at 32000.000 Hz
+const uint32_t note_phase_inc[NOTE_TABLE_SIZE] = {
+	0x0085f5ae, 0x008dece3, 0x00965d5a, 0x009f4e49, 0x00a8c754, 0x00b2d091,
+	0x00bd7296, 0x00c8b676, 0x00d4a5d2, 0x00e14add, 0x00eeb063, 0x00fce1d8,
+	0x010beb5b, 0x011bd9c6, 0x012cbab4, 0x013e9c92, 0x01518ea7, 0x0165a123,
+	0x017ae52b, 0x01916cec, 0x01a94ba4, 0x01c295b9, 0x01dd60c6, 0x01f9c3b0,
+	0x0217d6b6, 0x0237b38c, 0x02597569, 0x027d3925, 0x02a31d4f, 0x02cb4246,
+	0x02f5ca57, 0x0322d9d8, 0x03529748, 0x03852b73, 0x03bac18d, 0x03f38760,
+	0x042fad6d, 0x046f6717, 0x04b2ead1, 0x04fa724a, 0x05463a9d, 0x0596848c,
+	0x05eb94ad, 0x0645b3af, 0x06a52e91, 0x070a56e5, 0x0775831a, 0x07e70ec0,
+	0x085f5ad9, 0x08dece2e, 0x0965d5a2, 0x09f4e493, 0x0a8c753b, 0x0b2d0918,
+	0x0bd7295b, 0x0c8b675e, 0x0d4a5d21, 0x0e14adca, 0x0eeb0634, 0x0fce1d80,
+	0x10beb5b3, 0x11bd9c5d, 0x12cbab45, 0x13e9c927, 0x1518ea76, 0x165a122f,
+	0x17ae52b5, 0x1916cebd, 0x1a94ba43, 0x1c295b95, 0x1dd60c68, 0x1f9c3aff,
+	0x217d6b66, 0x237b38b9, 0x25975689, 0x27d3924d, 0x2a31d4ec, 0x2cb4245e,
+	0x2f5ca56b, 0x322d9d7a, 0x35297486, 0x3852b72a, 0x3bac18d0, 0x3f3875fe,
+	0x42fad6cb, 0x46f67172, 0x4b2ead13, 0x4fa7249b, 0x5463a9d8, 0x596848bc,
+	0x5eb94ad6, 0x645b3af4, 0x6a52e90b, 0x70a56e54, 0x775831a0, 0x7e70ebfd,
+};
+
+FASTDATA const envelope_t mode_envelopes[NUM_MODES] = {
+	{  64, 0.999867030f, 0.00f, 0.992217938f}, // Piano
+	{ 800, 0.999921878f, 0.70f, 0.999479302f}, // Alt Sax
+	{  64, 0.999895839f, 0.25f, 0.996101369f}, // Bright
+	{  32, 0.999947918f, 0.00f, 0.997918835f}, // Electric
+};
+#elif AUDIO_SAMPLE_RATE == 44100
+// TIM4 actually runs at 44085.231 Hz
+const uint32_t note_phase_inc[NOTE_TABLE_SIZE] = {
+	0x00613ca3, 0x006704d5, 0x006d250b, 0x0073a281, 0x007a82c2, 0x0081cbaf,
+	0x00898382, 0x0091b0d1, 0x009a5a99, 0x00a38843, 0x00ad41a3, 0x00b78f0b,
+	0x00c27947, 0x00ce09aa, 0x00da4a15, 0x00e74501, 0x00f50584, 0x0103975f,
+	0x01130703, 0x012361a1, 0x0134b533, 0x01471085, 0x015a8347, 0x016f1e16,
+	0x0184f28d, 0x019c1353, 0x01b4942a, 0x01ce8a02, 0x01ea0b09, 0x02072ebd,
+	0x02260e06, 0x0246c343, 0x02696a66, 0x028e210a, 0x02b5068e, 0x02de3c2c,
+	0x0309e51a, 0x033826a6, 0x03692854, 0x039d1404, 0x03d41611, 0x040e5d7b,
+	0x044c1c0c, 0x048d8686, 0x04d2d4cc, 0x051c4214, 0x056a0d1b, 0x05bc7858,
+	0x0613ca34, 0x06704d4c, 0x06d250a9, 0x073a2808, 0x07a82c22, 0x081cbaf6,
+	0x08983818, 0x091b0d0c, 0x09a5a997, 0x0a388428, 0x0ad41a36, 0x0b78f0af,
+	0x0c279469, 0x0ce09a98, 0x0da4a152, 0x0e745010, 0x0f505844, 0x103975ec,
+	0x11307031, 0x12361a18, 0x134b532e, 0x14710850, 0x15a8346c, 0x16f1e15e,
+	0x184f28d2, 0x19c13530, 0x1b4942a3, 0x1ce8a020, 0x1ea0b089, 0x2072ebd7,
+	0x2260e062, 0x246c342f, 0x2696a65d, 0x28e210a0, 0x2b5068d8, 0x2de3c2bd,
+	0x309e51a3, 0x33826a60, 0x36928546, 0x39d14041, 0x3d416111, 0x40e5d7ae,
+	0x44c1c0c4, 0x48d8685e, 0x4d2d4cba, 0x51c42140, 0x56a0d1b1, 0x5bc7857a,
+};
+
+FASTDATA const envelope_t mode_envelopes[NUM_MODES] = {
+	{  88, 0.999903480f, 0.00f, 0.994345215f}, // Piano
+	{1102, 0.999943293f, 0.70f, 0.999622016f}, // Alt Sax
+	{  88, 0.999924392f, 0.25f, 0.997168599f}, // Bright
+	{  44, 0.999962195f, 0.00f, 0.998488921f}, // Electric
+};
+#elif AUDIO_SAMPLE_RATE == 48000
+// TIM4 actually runs at 48000.000 Hz
+const uint32_t note_phase_inc[NOTE_TABLE_SIZE] = {
+	0x00594e74, 0x005e9ded, 0x00643e3c, 0x006a3431, 0x007084e2, 0x007735b6,
+	0x007e4c64, 0x0085cef9, 0x008dc3e1, 0x009631e8, 0x009f2042, 0x00a89690,
+	0x00b29ce7, 0x00bd3bd9, 0x00c87c78, 0x00d46862, 0x00e109c5, 0x00ee6b6d,
+	0x00fc98c8, 0x010b9df3, 0x011b87c3, 0x012c63d1, 0x013e4084, 0x01512d20,
+	0x016539cf, 0x017a77b2, 0x0190f8f0, 0x01a8d0c3, 0x01c2138a, 0x01dcd6d9,
+	0x01f9318f, 0x02173be5, 0x02370f86, 0x0258c7a2, 0x027c8109, 0x02a25a40,
+	0x02ca739e, 0x02f4ef65, 0x0321f1e1, 0x0351a186, 0x03842714, 0x03b9adb3,
+	0x03f2631e, 0x042e77ca, 0x046e1f0b, 0x04b18f43, 0x04f90211, 0x0544b480,
+	0x0594e73c, 0x05e9deca, 0x0643e3c2, 0x06a3430d, 0x07084e27, 0x07735b65,
+	0x07e4c63c, 0x085cef94, 0x08dc3e16, 0x09631e87, 0x09f20423, 0x0a896900,
+	0x0b29ce77, 0x0bd3bd93, 0x0c87c783, 0x0d46861a, 0x0e109c4f, 0x0ee6b6ca,
+	0x0fc98c79, 0x10b9df29, 0x11b87c2d, 0x12c63d0e, 0x13e40845, 0x1512d1ff,
+	0x16539cee, 0x17a77b26, 0x190f8f06, 0x1a8d0c34, 0x1c21389d, 0x1dcd6d94,
+	0x1f9318f2, 0x2173be51, 0x2370f859, 0x258c7a1c, 0x27c8108b, 0x2a25a3ff,
+	0x2ca739dd, 0x2f4ef64c, 0x321f1e0d, 0x351a1867, 0x3842713a, 0x3b9adb28,
+	0x3f2631e4, 0x42e77ca2, 0x46e1f0b2, 0x4b18f438, 0x4f902115, 0x544b47fe,
+};
+
+FASTDATA const envelope_t mode_envelopes[NUM_MODES] = {
+	{  96, 0.999911351f, 0.00f, 0.994805207f}, // Piano
+	{1200, 0.999947918f, 0.70f, 0.999652838f}, // Alt Sax
+	{  96, 0.999930558f, 0.25f, 0.997399221f}, // Bright
+	{  48, 0.999965278f, 0.00f, 0.998612075f}, // Electric
+};
+#else
+#error "No phase increments for AUDIO_SAMPLE_RATE, add it to Tools/gen_tables.py"
+#endif
@@ -2,6 +2,7 @@
 #include "stm32l4xx_hal.h"
 #include "font7x5.h"
 #include "display.h"
+#include "profile.h"
 
 #define DMA_THRESHOLD 4
 #define DMA_BUF_SIZE 256
@@ -265,11 +266,13 @@ inline void disp_set_pixel(uint16_t x, uint16_t y, uint16_t color)
 
 void disp_fill_rect(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color)
 {
+	uint32_t prof_start = profile_begin();
 
 	orient_rect(&x, &y, &width, &height);
 
 	// Check input
 	if (x >= HX8357_WIDTH || y >= HX8357_HEIGHT) {
+		profile_end(PROF_DISP_FILL_RECT, prof_start);
 		return;
 	}
 	width = (width > HX8357_WIDTH - x) ? HX8357_WIDTH - x : width;
@@ -301,6 +304,7 @@ void disp_fill_rect(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uin
 		total_bytes -= write_count;
 	}
 	HAL_GPIO_WritePin(GPIOC, GPIO_PIN_6, 1);
+	profile_end(PROF_DISP_FILL_RECT, prof_start);
 }
 
 void disp_draw_line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t size, uint16_t color)
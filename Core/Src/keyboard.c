@@ -0,0 +1,110 @@
+#include "stm32l4xx_hal.h"
+#include "keyboard.h"
+#include "keyq.h"
+
+#define CHIP_MASK ((1 << KEYS_PER_CHIP) - 1)
+#define LEFT_HAND_KEYS 24 // keys below this take l_pressure
+
+extern uint16_t l_pressure, r_pressure;
+
+// Bits KEYS_PER_CHIP * chip up are each chip's state as of its last
+// queued events. A chip's bits can run over into the next word. Only
+// keyboard_update writes it.
+static volatile uint64_t held[KEYBOARD_WORDS];
+
+void keyboard_update(uint8_t chip, uint16_t status, const uint8_t *velocity)
+{
+	if (chip >= MPR121_NUM_CHIPS) {
+		return;
+	}
+	int base = chip * KEYS_PER_CHIP;
+	int word = base / 64;
+	int shift = base % 64;
+	uint64_t lo = held[word];
+	uint64_t hi = (shift + KEYS_PER_CHIP > 64) ? held[word + 1] : 0;
+	uint32_t prev = (uint32_t) (lo >> shift);
+	if (shift + KEYS_PER_CHIP > 64) {
+		prev |= (uint32_t) (hi << (64 - shift));
+	}
+	uint32_t changes = (status ^ prev) & CHIP_MASK;
+
+	key_event_t ev;
+	ev.time = HAL_GetTick();
+	while (changes) {
+		int key = __builtin_ctz(changes);
+		changes &= changes - 1;
+
+		ev.note = base + key;
+		ev.on = (status >> key) & 1;
+		ev.pressure = (ev.note < LEFT_HAND_KEYS) ? l_pressure : r_pressure;
+		ev.velocity = (ev.on && velocity) ? velocity[key] : 0;
+		if (keyq_push(&ev) == 0) {
+			if (shift + key < 64) {
+				lo ^= (uint64_t) 1 << (shift + key);
+			} else {
+				hi ^= (uint64_t) 1 << (shift + key - 64);
+			}
+		}
+	}
+	held[word] = lo;
+	if (shift + KEYS_PER_CHIP > 64) {
+		held[word + 1] = hi;
+	}
+}
+
+void keyboard_held(uint64_t *map)
+{
+	// Each word is two loads on this core, keep keyboard_update from
+	// landing in between
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	for (int i = 0; i < KEYBOARD_WORDS; i++) {
+		map[i] = held[i];
+	}
+	__set_PRIMASK(primask);
+}
+
+int keyboard_count()
+{
+	uint64_t map[KEYBOARD_WORDS];
+	keyboard_held(map);
+	int count = 0;
+	for (int i = 0; i < KEYBOARD_WORDS; i++) {
+		count += __builtin_popcountll(map[i]);
+	}
+	return count;
+}
+
+int keyboard_lowest()
+{
+	uint64_t map[KEYBOARD_WORDS];
+	keyboard_held(map);
+	for (int i = 0; i < KEYBOARD_WORDS; i++) {
+		if (map[i]) {
+			return i * 64 + __builtin_ctzll(map[i]);
+		}
+	}
+	return -1;
+}
+
+int keyboard_highest()
+{
+	uint64_t map[KEYBOARD_WORDS];
+	keyboard_held(map);
+	for (int i = KEYBOARD_WORDS - 1; i >= 0; i--) {
+		if (map[i]) {
+			return i * 64 + 63 - __builtin_clzll(map[i]);
+		}
+	}
+	return -1;
+}
+
+int keyboard_is_held(uint8_t note)
+{
+	if (note >= KEYBOARD_KEYS) {
+		return 0;
+	}
+	uint64_t map[KEYBOARD_WORDS];
+	keyboard_held(map);
+	return (map[note / 64] >> (note % 64)) & 1;
+}
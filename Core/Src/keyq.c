@@ -0,0 +1,52 @@
+#include "stm32l4xx_hal.h"
+#include "keyq.h"
+
+static key_event_t events[KEYQ_SIZE];
+
+// Free-running counts, the slot is the count mod KEYQ_SIZE. head is only
+// written by the producer and tail only by the consumer.
+static volatile uint32_t head;
+static volatile uint32_t tail;
+static volatile uint32_t dropped;
+
+int keyq_push(const key_event_t *ev)
+{
+	uint32_t h = head;
+	if (h - tail >= KEYQ_SIZE) {
+		dropped++;
+		return -1;
+	}
+	events[h & (KEYQ_SIZE - 1)] = *ev;
+	// The event has to be in place before the consumer can see it
+	__DMB();
+	head = h + 1;
+	return 0;
+}
+
+int keyq_pop(key_event_t *evs, int max)
+{
+	uint32_t t = tail;
+	uint32_t n = head - t;
+	if (n > (uint32_t) max) {
+		n = max;
+	}
+	// Read the events only after head says they are there
+	__DMB();
+	for (uint32_t i = 0; i < n; i++) {
+		evs[i] = events[(t + i) & (KEYQ_SIZE - 1)];
+	}
+	// and finish with the slots before handing them back
+	__DMB();
+	tail = t + n;
+	return n;
+}
+
+int keyq_pending()
+{
+	return head != tail;
+}
+
+uint32_t keyq_dropped()
+{
+	return dropped;
+}
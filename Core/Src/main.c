@@ -23,7 +23,11 @@
 /* USER CODE BEGIN Includes */
 #include "audio.h"
 #include "mpr121.h"
+#include "keyboard.h"
+#include "keyq.h"
+#include "settings.h"
 #include "display.h"
+#include "profile.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -40,6 +44,14 @@
 #define SOFT_RST 0x80
 #define TOUCH_STATUS 0x00
 
+#define KEY_BATCH 8 // key events taken off the queue per pass of the loop
+#define MODE_SAVE_MS 3000 // a new mode is saved once it has stayed this long
+#define CALIB_SAVE_MS 10000 // after startup, for the baselines to settle
+
+#if KEYBOARD_KEYS > MAX_NOTES
+#error "more keys than notes, build with a larger MAX_NOTES"
+#endif
+
 /* USER CODE END PD */
 
 /* Private macro -------------------------------------------------------------*/
@@ -49,20 +61,22 @@
 
 /* Private variables ---------------------------------------------------------*/
 DAC_HandleTypeDef hdac1;
+DMA_HandleTypeDef hdma_dac1_ch1;
 
 I2C_HandleTypeDef hi2c1;
+I2C_HandleTypeDef hi2c2;
+DMA_HandleTypeDef hdma_i2c1_rx;
+DMA_HandleTypeDef hdma_i2c2_rx;
 
 SPI_HandleTypeDef hspi1;
 DMA_HandleTypeDef hdma_spi1_tx;
 
 TIM_HandleTypeDef htim4;
+TIM_HandleTypeDef htim7;
 
 UART_HandleTypeDef huart3;
 
 /* USER CODE BEGIN PV */
-volatile uint8_t touch_status; // has an unserviced touch been detected
-volatile uint16_t intr_addr;
-volatile uint8_t  octave_no; // which octave was the key pressed in -> 0 to 4
 volatile uint8_t sustain; // sustain button pressed
 volatile uint8_t mode; // has a request to change mode been sent
 volatile uint8_t chmod; // set to 1 whenever blue button pressed
@@ -71,6 +85,10 @@ volatile int best_index;
 volatile int pressure_wait;
 uint16_t l_pressure = 0, r_pressure = 0;
 
+static uint8_t saved_mode; // mode as of the last settings_set
+static uint32_t mode_tick; // when mode last changed
+static uint8_t calib_saved; // chips whose calibration was saved this run
+
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
@@ -82,12 +100,66 @@ static void MX_DAC1_Init(void);
 static void MX_TIM4_Init(void);
 static void MX_SPI1_Init(void);
 static void MX_USART3_UART_Init(void);
+static void MX_TIM7_Init(void);
+static void MX_I2C2_Init(void);
 /* USER CODE BEGIN PFP */
-
+static void load_settings(void);
+static void save_settings(void);
 /* USER CODE END PFP */
 
 /* Private user code ---------------------------------------------------------*/
 /* USER CODE BEGIN 0 */
+/*
+ * Restores the last mode and each chip's calibration from flash, so the
+ * controllers start from their saved baselines instead of relearning
+ * them. Before the touch controllers and audio start.
+ */
+static void load_settings(void)
+{
+	settings_init();
+	if (settings_get(SETTING_MODE, (void *) &mode, sizeof(mode)) || mode >= NUM_MODES) {
+		mode = 0;
+	}
+	saved_mode = mode;
+	for (int chip = 0; chip < MPR121_NUM_CHIPS; chip++) {
+		mpr121_calib_t calib;
+		if (settings_get(SETTING_CALIB + chip, &calib, sizeof(calib)) == 0) {
+			mpr121_set_calib(chip, &calib);
+		}
+	}
+}
+
+/*
+ * Saves the mode once it has settled, and each running chip's calibration
+ * once a run, with no keys down. Rarely writes, and never the same value.
+ */
+static void save_settings(void)
+{
+	uint32_t now = HAL_GetTick();
+	if (mode != saved_mode) {
+		if (!mode_tick) {
+			mode_tick = now;
+		} else if (now - mode_tick >= MODE_SAVE_MS) {
+			saved_mode = mode;
+			mode_tick = 0;
+			settings_set(SETTING_MODE, &saved_mode, sizeof(saved_mode));
+		}
+	} else {
+		mode_tick = 0;
+	}
+
+	uint8_t unsaved = mpr121_ready() & ~calib_saved;
+	if (unsaved && now >= CALIB_SAVE_MS && !keyboard_count()) {
+		int chip = __builtin_ctz(unsaved);
+		mpr121_calib_t calib;
+		if (mpr121_get_calib(chip, &calib)) {
+			// Lands in a later pass
+			mpr121_read_calib_nb(chip);
+		} else if (settings_set(SETTING_CALIB + chip, &calib, sizeof(calib)) == 0) {
+			calib_saved |= 1 << chip;
+		}
+	}
+}
 /* USER CODE END 0 */
 
 /**
@@ -123,47 +195,48 @@ int main(void)
   MX_TIM4_Init();
   MX_SPI1_Init();
   MX_USART3_UART_Init();
+  MX_TIM7_Init();
+  MX_I2C2_Init();
   /* USER CODE BEGIN 2 */
-//
-//  for (uint8_t addr = 0x5A; addr <= 0x5D; addr++) {
-//  	  if (mpr121_init(addr) != 0) {
-//  		  // TBD: ERROR
-//  	  }
-//  }
+  load_settings();
 
-  // resetting touch status
-  touch_status = 0;
+  // Touch controllers come up in the background while the rest starts
+  mpr121_init_start();
+#if MPR121_SCAN
+  mpr121_scan_start();
+#endif
 
-  // Initialize DAC
-  HAL_DAC_SetValue(&hdac1, DAC_CHANNEL_1, DAC_ALIGN_12B_R, 0);
-  HAL_DAC_Start(&hdac1, DAC_CHANNEL_1);
-
-  // Initialize audio stuff
+  // Initialize audio stuff, DAC is fed by DMA from here on
 
+  profile_init();
   disp_init();
   init_audio_ctx();
-  init_timer();
+  audio_start();
   pressure_read_start();
   /* USER CODE END 2 */
 
   /* Infinite loop */
   /* USER CODE BEGIN WHILE */
   uint8_t change_butt;
-  uint16_t touch_value;
-  uint16_t prev_touch_value;
+  key_event_t events[KEY_BATCH];
   sustain = 0;
-  mode = 0;
   tutorial_mode = 0;
 
-  HAL_Delay(2000);
+  uint32_t splash_start = HAL_GetTick();
+  while (HAL_GetTick() - splash_start < 2000) {
+	  mpr121_init_poll();
+  }
   disp_fill_rect(0, 0, DISP_WIDTH, DISP_HEIGHT, BLACK);
   print_mode();
   disp_print("Press any key to start", 40, CORR_Y, 3, 0x0f6f, 0x0000);
-  while(!touch_status){ /// stay here until a key is pressed
+  while(!keyq_pending()){ /// stay here until a key is pressed
+	  mpr121_init_poll();
 	  change_butt = HAL_GPIO_ReadPin(GPIOC, GPIO_PIN_13);
 	  if (change_butt) {
 		  mode = (mode + 1) % NUM_MODES;
-		  init_audio_ctx();
+		  audio_set_mode(mode);
+		  // A mode change restarts the tutorial song, as a full audio reset did
+		  tut_restart();
 		  print_mode();
 	  }
   }
@@ -172,43 +245,37 @@ int main(void)
 
   while (1)
   {
-	  if (touch_status) { // touch status set to 1 by ISR
-		  touch_status = 0;
-		  touch_value = mpr121_read_touch_status(0x5A + octave_no);
-		  uint16_t changes = touch_value ^ prev_touch_value;
-
-		  if (octave_no == 4) {
-		  }
-		  uint8_t octave_A = (octave_no * 12); // A note idx for octave
-		  for (int i = 0; i < 12; i++) {
-			  int mask = (1 << i);
-			  if (mask & changes) {
-				  if (mask & touch_value) { // if note i in octave was pressed
-
-					  float pressure = 0;
-					  if(octave_A + i < 24 && l_pressure >= 0.1) {
-						  pressure = l_pressure;
-					  }
-					  else if (octave_A + i >= 24 && r_pressure >= 0.1) {
-						  pressure = r_pressure;
-					  }
-					  else{
-						  pressure = 0.7;
-					  }
-					  add_note(octave_A + i,pressure);
-				  } else {
-					  // Remove finger
-					  set_damp_factor(octave_A + i, 1);
-				  }
+	  // hung buses and dropped controllers
+	  mpr121_poll();
+	  save_settings();
+
+	  // key events queued by the touch read completion
+	  int num_events = keyq_pop(events, KEY_BATCH);
+	  for (int i = 0; i < num_events; i++) {
+		  if (events[i].on) {
+			  float pressure = 0;
+			  if (events[i].velocity) {
+				  pressure = events[i].velocity / 255.0f;
 			  }
+			  else if (events[i].pressure >= 0.1) {
+				  pressure = events[i].pressure;
+			  }
+			  else{
+				  pressure = 0.7;
+			  }
+			  add_note(events[i].note, pressure);
+		  } else {
+			  // Remove finger
+			  set_damp_factor(events[i].note, 1);
 		  }
-		  prev_touch_value = touch_value;
 	  }
 	  sustain = !HAL_GPIO_ReadPin(GPIOG, GPIO_PIN_0);
 	  change_butt = HAL_GPIO_ReadPin(GPIOC, GPIO_PIN_13);
 	  if (change_butt) {
 		  mode = (mode + 1) % NUM_MODES;
-		  init_audio_ctx();
+		  audio_set_mode(mode);
+		  // A mode change restarts the tutorial song, as a full audio reset did
+		  tut_restart();
 		  print_mode();
 	  }
 
@@ -304,7 +371,7 @@ static void MX_DAC1_Init(void)
   /** DAC channel OUT1 config
   */
   sConfig.DAC_SampleAndHold = DAC_SAMPLEANDHOLD_DISABLE;
-  sConfig.DAC_Trigger = DAC_TRIGGER_NONE;
+  sConfig.DAC_Trigger = DAC_TRIGGER_T4_TRGO;
   sConfig.DAC_HighFrequency = DAC_HIGH_FREQUENCY_INTERFACE_MODE_ABOVE_80MHZ;
   sConfig.DAC_OutputBuffer = DAC_OUTPUTBUFFER_ENABLE;
   sConfig.DAC_ConnectOnChipPeripheral = DAC_CHIPCONNECT_DISABLE;
@@ -367,6 +434,54 @@ static void MX_I2C1_Init(void)
 
 }
 
+/**
+  * @brief I2C2 Initialization Function
+  * @param None
+  * @retval None
+  */
+static void MX_I2C2_Init(void)
+{
+
+  /* USER CODE BEGIN I2C2_Init 0 */
+
+  /* USER CODE END I2C2_Init 0 */
+
+  /* USER CODE BEGIN I2C2_Init 1 */
+
+  /* USER CODE END I2C2_Init 1 */
+  hi2c2.Instance = I2C2;
+  hi2c2.Init.Timing = 0x307075B1;
+  hi2c2.Init.OwnAddress1 = 0;
+  hi2c2.Init.AddressingMode = I2C_ADDRESSINGMODE_7BIT;
+  hi2c2.Init.DualAddressMode = I2C_DUALADDRESS_DISABLE;
+  hi2c2.Init.OwnAddress2 = 0;
+  hi2c2.Init.OwnAddress2Masks = I2C_OA2_NOMASK;
+  hi2c2.Init.GeneralCallMode = I2C_GENERALCALL_DISABLE;
+  hi2c2.Init.NoStretchMode = I2C_NOSTRETCH_DISABLE;
+  if (HAL_I2C_Init(&hi2c2) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  /** Configure Analogue filter
+  */
+  if (HAL_I2CEx_ConfigAnalogFilter(&hi2c2, I2C_ANALOGFILTER_ENABLE) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  /** Configure Digital filter
+  */
+  if (HAL_I2CEx_ConfigDigitalFilter(&hi2c2, 0) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  /* USER CODE BEGIN I2C2_Init 2 */
+
+  /* USER CODE END I2C2_Init 2 */
+
+}
+
 /**
   * @brief SPI1 Initialization Function
   * @param None
@@ -440,7 +555,7 @@ static void MX_TIM4_Init(void)
   {
     Error_Handler();
   }
-  sMasterConfig.MasterOutputTrigger = TIM_TRGO_RESET;
+  sMasterConfig.MasterOutputTrigger = TIM_TRGO_UPDATE;
   sMasterConfig.MasterSlaveMode = TIM_MASTERSLAVEMODE_DISABLE;
   if (HAL_TIMEx_MasterConfigSynchronization(&htim4, &sMasterConfig) != HAL_OK)
   {
@@ -452,6 +567,44 @@ static void MX_TIM4_Init(void)
 
 }
 
+/**
+  * @brief TIM7 Initialization Function
+  * @param None
+  * @retval None
+  */
+static void MX_TIM7_Init(void)
+{
+
+  /* USER CODE BEGIN TIM7_Init 0 */
+
+  /* USER CODE END TIM7_Init 0 */
+
+  TIM_MasterConfigTypeDef sMasterConfig = {0};
+
+  /* USER CODE BEGIN TIM7_Init 1 */
+
+  /* USER CODE END TIM7_Init 1 */
+  htim7.Instance = TIM7;
+  htim7.Init.Prescaler = 119;
+  htim7.Init.CounterMode = TIM_COUNTERMODE_UP;
+  htim7.Init.Period = 999;
+  htim7.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+  if (HAL_TIM_Base_Init(&htim7) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  sMasterConfig.MasterOutputTrigger = TIM_TRGO_RESET;
+  sMasterConfig.MasterSlaveMode = TIM_MASTERSLAVEMODE_DISABLE;
+  if (HAL_TIMEx_MasterConfigSynchronization(&htim7, &sMasterConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  /* USER CODE BEGIN TIM7_Init 2 */
+
+  /* USER CODE END TIM7_Init 2 */
+
+}
+
 /**
   * @brief USART3 Initialization Function
   * @param None
@@ -514,6 +667,15 @@ static void MX_DMA_Init(void)
   /* DMA1_Channel1_IRQn interrupt configuration */
   HAL_NVIC_SetPriority(DMA1_Channel1_IRQn, 0, 0);
   HAL_NVIC_EnableIRQ(DMA1_Channel1_IRQn);
+  /* DMA1_Channel2_IRQn interrupt configuration */
+  HAL_NVIC_SetPriority(DMA1_Channel2_IRQn, 0, 0);
+  HAL_NVIC_EnableIRQ(DMA1_Channel2_IRQn);
+  /* DMA1_Channel3_IRQn interrupt configuration */
+  HAL_NVIC_SetPriority(DMA1_Channel3_IRQn, 1, 0);
+  HAL_NVIC_EnableIRQ(DMA1_Channel3_IRQn);
+  /* DMA1_Channel4_IRQn interrupt configuration */
+  HAL_NVIC_SetPriority(DMA1_Channel4_IRQn, 1, 0);
+  HAL_NVIC_EnableIRQ(DMA1_Channel4_IRQn);
 
 }
 
@@ -559,8 +721,8 @@ static void MX_GPIO_Init(void)
   GPIO_InitStruct.Pull = GPIO_NOPULL;
   HAL_GPIO_Init(GPIOC, &GPIO_InitStruct);
 
-  /*Configure GPIO pins : PF0 PF1 PF2 */
-  GPIO_InitStruct.Pin = GPIO_PIN_0|GPIO_PIN_1|GPIO_PIN_2;
+  /*Configure GPIO pin : PF2 */
+  GPIO_InitStruct.Pin = GPIO_PIN_2;
   GPIO_InitStruct.Mode = GPIO_MODE_AF_OD;
   GPIO_InitStruct.Pull = GPIO_NOPULL;
   GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
@@ -0,0 +1,139 @@
+#include <stdint.h>
+#include "fastmem.h"
+#include "mix.h"
+
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP
+#include "stm32l4xx.h" // CMSIS SIMD intrinsics
+#define MIX_USE_DSP 1
+#else
+#define MIX_USE_DSP 0
+#endif
+
+RAMFUNC static void mix_one_voice(int32_t *acc, int len, const int16_t *table, int shift,
+		uint32_t *phase, uint32_t phase_inc, int32_t gain, int32_t gain_step)
+{
+	uint32_t p = *phase;
+	for (int k = 0; k < len; k++) {
+		p += phase_inc;
+		acc[k] += table[p >> shift] * (gain >> MIX_RAMP_BITS);
+		gain += gain_step;
+	}
+	*phase = p;
+}
+
+RAMFUNC void mix_voices_ref(int32_t *acc, int len, const int16_t *const *table, int shift, uint32_t *phase,
+		const uint32_t *phase_inc, const int32_t *gain, const int32_t *gain_step, int num_voices)
+{
+	for (int v = 0; v < num_voices; v++) {
+		mix_one_voice(acc, len, table[v], shift, &phase[v], phase_inc[v], gain[v], gain_step[v]);
+	}
+}
+
+RAMFUNC void mix_voices(int32_t *acc, int len, const int16_t *const *table, int shift, uint32_t *phase,
+		const uint32_t *phase_inc, const int32_t *gain, const int32_t *gain_step, int num_voices)
+{
+#if MIX_USE_DSP
+	int v;
+
+	// Pairs of voices: both samples and both gains packed into one word
+	// each, so a single SMLAD does two multiply-accumulates. PKHTB takes
+	// the Q14 halves of the two ramping gains in one instruction.
+	for (v = 0; v + 1 < num_voices; v += 2) {
+		const int16_t *ta = table[v];
+		const int16_t *tb = table[v + 1];
+		uint32_t pa = phase[v];
+		uint32_t pb = phase[v + 1];
+		uint32_t inc_a = phase_inc[v];
+		uint32_t inc_b = phase_inc[v + 1];
+		int32_t ga = gain[v];
+		int32_t gb = gain[v + 1];
+		int32_t step_a = gain_step[v];
+		int32_t step_b = gain_step[v + 1];
+
+		for (int k = 0; k < len; k++) {
+			pa += inc_a;
+			pb += inc_b;
+			uint32_t samples = __PKHBT(ta[pa >> shift], tb[pb >> shift], 16);
+			uint32_t gains = __PKHTB(gb, ga, MIX_RAMP_BITS);
+			acc[k] = __SMLAD(samples, gains, acc[k]);
+			ga += step_a;
+			gb += step_b;
+		}
+		phase[v] = pa;
+		phase[v + 1] = pb;
+	}
+	if (v < num_voices) {
+		mix_one_voice(acc, len, table[v], shift, &phase[v], phase_inc[v], gain[v], gain_step[v]);
+	}
+#else
+	mix_voices_ref(acc, len, table, shift, phase, phase_inc, gain, gain_step, num_voices);
+#endif
+}
+
+static inline int32_t lerp_sample(const int16_t *table, uint32_t p, int shift)
+{
+	uint32_t i = p >> shift;
+	int32_t frac = (p >> (shift - MIX_FRAC_BITS)) & ((1 << MIX_FRAC_BITS) - 1);
+	int32_t a = table[i];
+
+	return a + (((table[i + 1] - a) * frac) >> MIX_FRAC_BITS);
+}
+
+RAMFUNC static void mix_one_voice_lerp(int32_t *acc, int len, const int16_t *table, int shift,
+		uint32_t *phase, uint32_t phase_inc, int32_t gain, int32_t gain_step)
+{
+	uint32_t p = *phase;
+	for (int k = 0; k < len; k++) {
+		p += phase_inc;
+		acc[k] += lerp_sample(table, p, shift) * (gain >> MIX_RAMP_BITS);
+		gain += gain_step;
+	}
+	*phase = p;
+}
+
+RAMFUNC void mix_voices_lerp_ref(int32_t *acc, int len, const int16_t *const *table, int shift, uint32_t *phase,
+		const uint32_t *phase_inc, const int32_t *gain, const int32_t *gain_step, int num_voices)
+{
+	for (int v = 0; v < num_voices; v++) {
+		mix_one_voice_lerp(acc, len, table[v], shift, &phase[v], phase_inc[v], gain[v], gain_step[v]);
+	}
+}
+
+RAMFUNC void mix_voices_lerp(int32_t *acc, int len, const int16_t *const *table, int shift, uint32_t *phase,
+		const uint32_t *phase_inc, const int32_t *gain, const int32_t *gain_step, int num_voices)
+{
+#if MIX_USE_DSP
+	int v;
+
+	// Same pairing as mix_voices, each sample interpolated before packing
+	for (v = 0; v + 1 < num_voices; v += 2) {
+		const int16_t *ta = table[v];
+		const int16_t *tb = table[v + 1];
+		uint32_t pa = phase[v];
+		uint32_t pb = phase[v + 1];
+		uint32_t inc_a = phase_inc[v];
+		uint32_t inc_b = phase_inc[v + 1];
+		int32_t ga = gain[v];
+		int32_t gb = gain[v + 1];
+		int32_t step_a = gain_step[v];
+		int32_t step_b = gain_step[v + 1];
+
+		for (int k = 0; k < len; k++) {
+			pa += inc_a;
+			pb += inc_b;
+			uint32_t samples = __PKHBT(lerp_sample(ta, pa, shift), lerp_sample(tb, pb, shift), 16);
+			uint32_t gains = __PKHTB(gb, ga, MIX_RAMP_BITS);
+			acc[k] = __SMLAD(samples, gains, acc[k]);
+			ga += step_a;
+			gb += step_b;
+		}
+		phase[v] = pa;
+		phase[v + 1] = pb;
+	}
+	if (v < num_voices) {
+		mix_one_voice_lerp(acc, len, table[v], shift, &phase[v], phase_inc[v], gain[v], gain_step[v]);
+	}
+#else
+	mix_voices_lerp_ref(acc, len, table, shift, phase, phase_inc, gain, gain_step, num_voices);
+#endif
+}
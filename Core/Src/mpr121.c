@@ -1,50 +1,158 @@
+#include <string.h>
 #include "stm32l4xx_hal.h"
 #include "mpr121.h"
+#include "keyboard.h"
+#include "profile.h"
 
 #define ECR 0x5E
 #define SOFT_RST 0x80
 #define TOUCH_STATUS 0x00
+#define FILTERED_DATA 0x04 // 10 bits, low byte first, for each electrode in turn
+#define BASELINE 0x1E // top 8 of 10 bits for each electrode in turn
+#define THRESHOLDS 0x41 // touch and release for each electrode in turn
+#define CONFIG2 0x5D
+#define CONFIG2_DEFAULT 0x24
 #define RST_VAL 0x63
+#define RESET_DELAY_MS 1
 #define ECR_ALL_ENABLE 0b10001100
-#define NUM_ELECS 12
+#define ECR_RESTORE_ENABLE 0b00001100 // tracking starts from the baseline registers
+#define NUM_ELECS MPR121_NUM_ELECS
 #define TOUCH_THRESHOLD 0x30
 #define RELEASE_THRESHOLD 0x08
+// Filtered data through the last baseline in one read, electrode 12's
+// filtered pair in the middle comes along
+#define ELEC_DATA_SIZE (BASELINE + NUM_ELECS - FILTERED_DATA)
+#define VELOCITY_MIN 32 // a press that only just crossed its touch threshold
+#define VELOCITY_SPAN 0x60 // delta past the touch threshold for full velocity
+#define I2C_TIMEOUT_MS 10 // the longest transfer takes a few ms
+#define STRIKE_LIMIT 3 // failed transfers in a row before a chip is dropped
+#define REINIT_MS 1000 // between tries at bringing dropped chips back
 
 extern I2C_HandleTypeDef hi2c1;
-extern uint8_t touch_status;
-extern uint16_t intr_addr;
-extern uint8_t  octave_no;
+extern I2C_HandleTypeDef hi2c2;
+extern TIM_HandleTypeDef htim7;
 
-int mpr121_init(uint8_t addr)
+// Background init of every chip. Stop and reset all of them, wait out one
+// reset delay for the lot, then verify, set thresholds, restore baselines
+// if there are any and run each.
+typedef enum {
+	INIT_STOP,
+	INIT_RESET,
+	INIT_WAIT,
+	INIT_VERIFY,
+	INIT_THRESHOLDS,
+	INIT_BASELINES,
+	INIT_RUN,
+	INIT_DONE
+} init_step_t;
+
+// Interrupt-driven transfers. Each bus has one on it at a time, chips
+// whose interrupt fires meanwhile wait in pending.
+enum {
+	NB_TOUCH, // touch status read for chip
+	NB_VELOCITY, // electrode data read for chip after it saw a press
+	NB_CALIB, // baseline read for chip, asked for by mpr121_read_calib_nb
+	NB_INIT // step of the background init
+};
+
+typedef struct bus_s {
+	I2C_HandleTypeDef *hi2c;
+	GPIO_TypeDef *port; // SCL and SDA, for clocking the bus free
+	uint16_t scl;
+	uint16_t sda;
+	uint8_t first_chip;
+	uint8_t num_chips;
+	uint8_t buf[ELEC_DATA_SIZE];
+	volatile uint8_t busy;
+	volatile uint8_t hung; // busy until mpr121_poll recovers the bus
+	volatile uint8_t op;
+	volatile uint8_t chip; // chip on the bus while busy
+	volatile uint32_t start_tick; // of the transfer on the bus
+	uint16_t status; // touch status waiting on the NB_VELOCITY read
+	volatile uint8_t pending; // bit n for chip n
+
+	volatile uint8_t init_step; // init_step_t
+	volatile uint8_t init_chip;
+	uint8_t init_buf[2 * NUM_ELECS];
+} bus_t;
+
+// The last bus gets whatever chips are left over
+#define BUS_CHIPS(b) ((MPR121_NUM_CHIPS - (b) * MPR121_CHIPS_PER_BUS < MPR121_CHIPS_PER_BUS) ? \
+		(MPR121_NUM_CHIPS - (b) * MPR121_CHIPS_PER_BUS) : MPR121_CHIPS_PER_BUS)
+
+static bus_t buses[MPR121_NUM_BUSES] = {
+	{ .hi2c = &hi2c1, .port = GPIOB, .scl = GPIO_PIN_8, .sda = GPIO_PIN_9,
+	  .first_chip = 0, .num_chips = BUS_CHIPS(0), .init_step = INIT_DONE },
+#if MPR121_NUM_BUSES > 1
+	{ .hi2c = &hi2c2, .port = GPIOF, .scl = GPIO_PIN_1, .sda = GPIO_PIN_0,
+	  .first_chip = MPR121_CHIPS_PER_BUS, .num_chips = BUS_CHIPS(1), .init_step = INIT_DONE },
+#endif
+};
+
+static volatile uint16_t nb_status[MPR121_NUM_CHIPS];
+static volatile uint8_t nb_read; // chips nb_status holds a read for
+
+// What each chip is set up with, defaults unless calib_given
+static mpr121_calib_t calib[MPR121_NUM_CHIPS];
+static uint8_t calib_given;
+static volatile uint8_t calib_pending; // chips waiting on an NB_CALIB read
+static volatile uint8_t calib_fresh; // chips whose calib has the baselines read back
+
+static volatile uint32_t chip_errors[MPR121_NUM_CHIPS];
+static uint8_t chip_strikes[MPR121_NUM_CHIPS]; // failures since the last success
+
+// Chips the init passes over: failed this time round, or already running
+// when only the dropped ones are being brought back
+static volatile uint8_t init_skip;
+static volatile uint8_t init_ready;
+static uint32_t reset_tick;
+static uint32_t reinit_tick;
+
+static bus_t *bus_of_chip(uint8_t chip)
+{
+	return &buses[chip / MPR121_CHIPS_PER_BUS];
+}
+
+static uint8_t bus_mask(const bus_t *bus)
+{
+	return ((1 << bus->num_chips) - 1) << bus->first_chip;
+}
+
+static uint16_t chip_addr(uint8_t chip)
+{
+	return (MPR121_BASE_ADDR + chip % MPR121_CHIPS_PER_BUS) << 1;
+}
+
+int mpr121_init(uint8_t chip)
 {
 	uint8_t data;
 
 	// resetting ECR
 	data = 0;
-	if (mpr121_write(addr, ECR, &data, 1) != 0) {
+	if (mpr121_write(chip, ECR, &data, 1) != 0) {
 		return -1;
 	}
 
 	// soft resetting
 	data = RST_VAL;
-	if (mpr121_write(addr, SOFT_RST, &data, 1)) {
+	if (mpr121_write(chip, SOFT_RST, &data, 1)) {
 		return -1;
 	}
-	HAL_Delay(1);
+	HAL_Delay(RESET_DELAY_MS);
 
 	// checking whether reset actually worked by reading config reg 2's default value
-	if (mpr121_read(addr, 0x5d, &data, 1) || data != 0x24) {
+	if (mpr121_read(chip, CONFIG2, &data, 1) || data != CONFIG2_DEFAULT) {
 		return -1;
 	}
 
 	// set default touch and release thresholds
-	if (mpr121_set_thresholds(addr, TOUCH_THRESHOLD, RELEASE_THRESHOLD)) {
+	if (mpr121_set_thresholds(chip, TOUCH_THRESHOLD, RELEASE_THRESHOLD)) {
 		return -1;
 	}
 
 	// Enabling all electrodes with baseline tracking upon initialisation
 	data = ECR_ALL_ENABLE;
-	if (mpr121_write(addr, ECR, &data, 1)) {
+	if (mpr121_write(chip, ECR, &data, 1)) {
 		return -1;
 	}
 
@@ -52,38 +160,137 @@ int mpr121_init(uint8_t addr)
 	return 0;
 }
 
-int mpr121_set_thresholds(uint8_t addr, uint8_t touch, uint8_t release)
+static void fill_thresholds(uint8_t *buf, uint8_t touch, uint8_t release)
 {
-	uint8_t thresholds[] = {touch, release};
 	for (int i = 0; i < 2*NUM_ELECS; i += 2) {
+		buf[i] = touch;
+		buf[i + 1] = release;
+	}
+}
+
+int mpr121_set_thresholds(uint8_t chip, uint8_t touch, uint8_t release)
+{
+	// The register address auto-increments, all 24 go in one write
+	uint8_t thresholds[2 * NUM_ELECS];
+	fill_thresholds(thresholds, touch, release);
+	if (mpr121_write(chip, THRESHOLDS, thresholds, sizeof(thresholds))) {
+		return -1;
+	}
+	// Kept for the next init, e.g. after the chip drops out
+	memcpy(calib[chip].thresholds, thresholds, sizeof(thresholds));
+	calib_given |= 1 << chip;
+	return 0;
+}
 
-		// touch
-		if (mpr121_write(addr, 0x41 + i, thresholds, 1)) {
+void mpr121_set_calib(uint8_t chip, const mpr121_calib_t *c)
+{
+	if (chip >= MPR121_NUM_CHIPS) {
+		return;
+	}
+	calib[chip] = *c;
+	calib_given |= 1 << chip;
+	calib_fresh &= ~(1 << chip);
+}
+
+int mpr121_get_calib(uint8_t chip, mpr121_calib_t *c)
+{
+	if (chip >= MPR121_NUM_CHIPS) {
+		return -1;
+	}
+	int ret = -1;
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	if (calib_fresh & (1 << chip)) {
+		*c = calib[chip];
+		ret = 0;
+	}
+	__set_PRIMASK(primask);
+	return ret;
+}
+
+/*
+ * Waits for the lines to go idle before a blocking transfer, out of the
+ * same I2C_TIMEOUT_MS: left to HAL, that wait alone takes up to
+ * I2C_TIMEOUT_BUSY (25 ms). Sets *timeout to what is left of it.
+ * Returns 0 if the transfer can go ahead and -1 if not.
+ */
+static int blocking_wait(uint8_t chip, uint32_t *timeout)
+{
+	I2C_HandleTypeDef *hi2c = bus_of_chip(chip)->hi2c;
+	if (hi2c->State != HAL_I2C_STATE_READY) {
+		// A transfer already on the bus is no fault of the chip's
+		return -1;
+	}
+	uint32_t start = HAL_GetTick();
+	uint32_t elapsed = 0;
+	while (__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_BUSY)) {
+		elapsed = HAL_GetTick() - start;
+		if (elapsed >= I2C_TIMEOUT_MS) {
+			chip_errors[chip]++;
 			return -1;
 		}
-		if (mpr121_write(addr, 0x42 + i, thresholds+1, 1)) {
-			return -1;
+	}
+	*timeout = I2C_TIMEOUT_MS - elapsed;
+	return 0;
+}
+
+int mpr121_read(uint8_t chip, uint8_t reg_addr, uint8_t *data, int size)
+{
+	uint32_t timeout;
+	if (blocking_wait(chip, &timeout)) {
+		return -1;
+	}
+	HAL_StatusTypeDef ret = HAL_I2C_Mem_Read(bus_of_chip(chip)->hi2c, chip_addr(chip) | 1, reg_addr, I2C_MEMADD_SIZE_8BIT, data, size, timeout);
+	if (ret != HAL_OK) {
+		// A transfer already on the bus is no fault of the chip's
+		if (ret != HAL_BUSY) {
+			chip_errors[chip]++;
 		}
+		return -1;
+	}
+	return 0;
+}
 
+int mpr121_read_nb(uint8_t chip, uint8_t reg_addr, uint8_t *data, int size)
+{
+	bus_t *bus = bus_of_chip(chip);
+	if (HAL_I2C_Mem_Read_DMA(bus->hi2c, chip_addr(chip) | 1, reg_addr, I2C_MEMADD_SIZE_8BIT, data, size) != HAL_OK) {
+		return -1;
 	}
+	bus->start_tick = HAL_GetTick();
 	return 0;
 }
 
-int mpr121_read(uint8_t addr, uint8_t reg_addr, uint8_t *data, int size)
+int mpr121_write(uint8_t chip, uint8_t reg_addr, uint8_t *data, int size)
 {
-	return HAL_I2C_Mem_Read(&hi2c1, (addr << 1) | 1, reg_addr, I2C_MEMADD_SIZE_8BIT, data, size, HAL_MAX_DELAY);
+	uint32_t timeout;
+	if (blocking_wait(chip, &timeout)) {
+		return -1;
+	}
+	HAL_StatusTypeDef ret = HAL_I2C_Mem_Write(bus_of_chip(chip)->hi2c, chip_addr(chip), reg_addr, I2C_MEMADD_SIZE_8BIT, data, size, timeout);
+	if (ret != HAL_OK) {
+		if (ret != HAL_BUSY) {
+			chip_errors[chip]++;
+		}
+		return -1;
+	}
+	return 0;
 }
 
-int mpr121_write(uint8_t addr, uint8_t reg_addr, uint8_t *data, int size)
+int mpr121_write_nb(uint8_t chip, uint8_t reg_addr, uint8_t *data, int size)
 {
-	I2C_HandleTypeDef *sdf = &hi2c1;
-	return HAL_I2C_Mem_Write(&hi2c1, (addr << 1), reg_addr, I2C_MEMADD_SIZE_8BIT, data, size, HAL_MAX_DELAY);
+	bus_t *bus = bus_of_chip(chip);
+	if (HAL_I2C_Mem_Write_IT(bus->hi2c, chip_addr(chip), reg_addr, I2C_MEMADD_SIZE_8BIT, data, size) != HAL_OK) {
+		return -1;
+	}
+	bus->start_tick = HAL_GetTick();
+	return 0;
 }
 
-uint16_t mpr121_read_touch_status(uint8_t addr)
+uint16_t mpr121_read_touch_status(uint8_t chip)
 {
 	uint8_t status[2] = {0};
-	if (mpr121_read(addr, TOUCH_STATUS, status, 2)) {
+	if (mpr121_read(chip, TOUCH_STATUS, status, 2)) {
 		return ~0;
 
 	}
@@ -93,19 +300,548 @@ uint16_t mpr121_read_touch_status(uint8_t addr)
 	return ret;
 }
 
-void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
+/*
+ * Starts the bus's next waiting touch status read if it is free, or
+ * failing that its next baseline read. Called with the I2C, timer and
+ * EXTI interrupts unable to preempt it.
+ */
+static void nb_start_next(bus_t *bus)
 {
-	uint8_t status[2] = {0};
-	octave_no = (GPIO_Pin == 0x400 ) ? 0 :
-				(GPIO_Pin == 0x1000) ? 1 :
-				(GPIO_Pin == 0x4000) ? 2 :
-				(GPIO_Pin == 0x8000) ? 3 : 4; //error
+	if (bus->busy) {
+		return;
+	}
+	if (!bus->pending) {
+		uint8_t calib_wait = calib_pending & init_ready & bus_mask(bus);
+		if (!calib_wait) {
+			return;
+		}
+		// Taken off calib_pending once it lands
+		bus->chip = __builtin_ctz(calib_wait);
+		bus->op = NB_CALIB;
+		bus->busy = 1;
+		if (mpr121_read_nb(bus->chip, BASELINE, bus->buf, NUM_ELECS)) {
+			bus->busy = 0;
+		}
+		return;
+	}
+	uint8_t chip = __builtin_ctz(bus->pending);
+	bus->chip = chip;
+	bus->op = NB_TOUCH;
+	bus->busy = 1;
+	if (mpr121_read_nb(chip, TOUCH_STATUS, bus->buf, 2)) {
+		// A blocking transfer has the bus, leave the chip pending for
+		// the next interrupt or mpr121_poll
+		bus->busy = 0;
+		return;
+	}
+	bus->pending &= ~(1 << chip);
+}
+
+uint16_t mpr121_read_touch_status_nb(uint8_t chip)
+{
+	if (chip >= MPR121_NUM_CHIPS) {
+		return ~0;
+	}
+	bus_t *bus = bus_of_chip(chip);
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	bus->pending |= 1 << chip;
+	nb_start_next(bus);
+	__set_PRIMASK(primask);
+	return mpr121_touch_status(chip);
+}
 
-	mpr121_read(0x5A + octave_no, TOUCH_STATUS, status, 2);
-	touch_status = 1;
-	intr_addr = GPIO_Pin;
+void mpr121_read_calib_nb(uint8_t chip)
+{
+	if (chip >= MPR121_NUM_CHIPS) {
+		return;
+	}
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	calib_pending |= 1 << chip;
+	calib_fresh &= ~(1 << chip);
+	nb_start_next(bus_of_chip(chip));
+	__set_PRIMASK(primask);
+}
 
+uint16_t mpr121_touch_status(uint8_t chip)
+{
+	if (chip >= MPR121_NUM_CHIPS || !(nb_read & (1 << chip))) {
+		return ~0;
+	}
+	return nb_status[chip];
+}
+
+/*
+ * Moves the bus on to its first chip at or after chip that has not
+ * failed, starting it at step. Past its last chip the phase is over.
+ */
+static void init_next_chip(bus_t *bus, uint8_t chip, init_step_t step)
+{
+	uint8_t end = bus->first_chip + bus->num_chips;
+	while (chip < end && (init_skip & (1 << chip))) {
+		chip++;
+	}
+	if (chip < end) {
+		bus->init_chip = chip;
+		bus->init_step = step;
+	} else {
+		bus->init_chip = bus->first_chip;
+		bus->init_step = (step < INIT_WAIT) ? INIT_WAIT : INIT_DONE;
+	}
 }
 
+/*
+ * Records how the bus's init step went and picks the next one.
+ */
+static void init_step_done(bus_t *bus, int ok)
+{
+	uint8_t chip = bus->init_chip;
+	if (!ok) {
+		init_skip |= 1 << chip;
+		init_next_chip(bus, chip + 1, (bus->init_step < INIT_WAIT) ? INIT_STOP : INIT_VERIFY);
+		return;
+	}
+	switch (bus->init_step) {
+	case INIT_RESET:
+		reset_tick = HAL_GetTick();
+		init_next_chip(bus, chip + 1, INIT_STOP);
+		break;
+	case INIT_RUN:
+		init_ready |= 1 << chip;
+		// Its interrupt line may have gone low while it was down, one
+		// read brings it and the keyboard up to date
+		bus->pending |= 1 << chip;
+		init_next_chip(bus, chip + 1, INIT_VERIFY);
+		break;
+	case INIT_THRESHOLDS:
+		bus->init_step = calib[chip].has_baselines ? INIT_BASELINES : INIT_RUN;
+		break;
+	default:
+		bus->init_step++;
+		break;
+	}
+}
 
+/*
+ * Starts the bus's next init step if it is free. Called with the I2C and
+ * EXTI interrupts unable to preempt it.
+ */
+static void init_advance(bus_t *bus)
+{
+	if (bus->busy || bus->init_step == INIT_DONE) {
+		return;
+	}
+	if (bus->init_step == INIT_WAIT) {
+		// Every bus has to be done resetting, reset_tick is the last
+		// reset on either. The tick can roll over just after it, wait
+		// one more.
+		for (int b = 0; b < MPR121_NUM_BUSES; b++) {
+			if (buses[b].init_step < INIT_WAIT) {
+				return;
+			}
+		}
+		if (HAL_GetTick() - reset_tick <= RESET_DELAY_MS) {
+			return;
+		}
+		init_next_chip(bus, bus->first_chip, INIT_VERIFY);
+		if (bus->init_step == INIT_DONE) {
+			return;
+		}
+	}
 
+	uint8_t chip = bus->init_chip;
+	uint8_t *buf = bus->init_buf;
+	int err;
+	bus->op = NB_INIT;
+	bus->busy = 1;
+	switch (bus->init_step) {
+	case INIT_STOP:
+		buf[0] = 0;
+		err = mpr121_write_nb(chip, ECR, buf, 1);
+		break;
+	case INIT_RESET:
+		buf[0] = RST_VAL;
+		err = mpr121_write_nb(chip, SOFT_RST, buf, 1);
+		break;
+	case INIT_VERIFY:
+		err = mpr121_read_nb(chip, CONFIG2, buf, 1);
+		break;
+	case INIT_THRESHOLDS:
+		memcpy(buf, calib[chip].thresholds, sizeof(calib[chip].thresholds));
+		err = mpr121_write_nb(chip, THRESHOLDS, buf, sizeof(calib[chip].thresholds));
+		break;
+	case INIT_BASELINES:
+		// Only taken in stop mode, which the chip is in until INIT_RUN
+		memcpy(buf, calib[chip].baselines, NUM_ELECS);
+		err = mpr121_write_nb(chip, BASELINE, buf, NUM_ELECS);
+		break;
+	default:
+		buf[0] = calib[chip].has_baselines ? ECR_RESTORE_ENABLE : ECR_ALL_ENABLE;
+		err = mpr121_write_nb(chip, ECR, buf, 1);
+		break;
+	}
+	if (err) {
+		// A blocking transfer has the bus, mpr121_init_poll tries again
+		bus->busy = 0;
+	}
+}
+
+/*
+ * The bus is free again, hand it to whoever is waiting.
+ */
+static void nb_bus_free(bus_t *bus)
+{
+	bus->busy = 0;
+	nb_start_next(bus);
+	init_advance(bus);
+}
+
+static bus_t *bus_of_handle(I2C_HandleTypeDef *hi2c)
+{
+	for (int b = 0; b < MPR121_NUM_BUSES; b++) {
+		if (buses[b].hi2c == hi2c) {
+			return &buses[b];
+		}
+	}
+	return 0;
+}
+
+void mpr121_init_start()
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	init_skip = 0;
+	init_ready = 0;
+	for (int chip = 0; chip < MPR121_NUM_CHIPS; chip++) {
+		if (!(calib_given & (1 << chip))) {
+			fill_thresholds(calib[chip].thresholds, TOUCH_THRESHOLD, RELEASE_THRESHOLD);
+			calib[chip].has_baselines = 0;
+		}
+	}
+	for (int b = 0; b < MPR121_NUM_BUSES; b++) {
+		init_next_chip(&buses[b], buses[b].first_chip, INIT_STOP);
+	}
+	for (int b = 0; b < MPR121_NUM_BUSES; b++) {
+		init_advance(&buses[b]);
+	}
+	__set_PRIMASK(primask);
+}
+
+int mpr121_init_poll()
+{
+	mpr121_poll();
+	int done = 1;
+	for (int b = 0; b < MPR121_NUM_BUSES; b++) {
+		done &= buses[b].init_step == INIT_DONE;
+	}
+	return done;
+}
+
+uint8_t mpr121_ready()
+{
+	return init_ready;
+}
+
+/*
+ * Strike velocity, 1 to 255, for each electrode pressed in status from a
+ * read at FILTERED_DATA. The chip flags a touch once the drop from
+ * baseline passes the touch threshold, and this read lands a fixed bus time
+ * after the status read that saw it. How far past the threshold the drop
+ * has got by then is how fast the finger came down.
+ */
+static void estimate_velocity(uint8_t chip, const uint8_t *data, uint16_t status, uint8_t *velocity)
+{
+	for (int i = 0; i < NUM_ELECS; i++) {
+		velocity[i] = 0;
+		if (!(status & (1 << i))) {
+			continue;
+		}
+		int filtered = data[2*i] | ((data[2*i + 1] & 0x03) << 8);
+		int baseline = data[BASELINE - FILTERED_DATA + i] << 2;
+		int excess = baseline - filtered - calib[chip].thresholds[2*i];
+		if (excess < 0) {
+			excess = 0;
+		} else if (excess > VELOCITY_SPAN) {
+			excess = VELOCITY_SPAN;
+		}
+		velocity[i] = VELOCITY_MIN + excess * (255 - VELOCITY_MIN) / VELOCITY_SPAN;
+	}
+}
+
+void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+	bus_t *bus = bus_of_handle(hi2c);
+	if (!bus || !bus->busy || bus->op != NB_INIT) {
+		return;
+	}
+	chip_strikes[bus->init_chip] = 0;
+	init_step_done(bus, 1);
+	nb_bus_free(bus);
+}
+
+void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+	bus_t *bus = bus_of_handle(hi2c);
+	if (!bus || !bus->busy) {
+		return;
+	}
+	if (bus->op == NB_INIT) {
+		int ok = bus->init_buf[0] == CONFIG2_DEFAULT;
+		if (ok) {
+			chip_strikes[bus->init_chip] = 0;
+		} else {
+			chip_errors[bus->init_chip]++;
+		}
+		init_step_done(bus, ok);
+		nb_bus_free(bus);
+		return;
+	}
+	uint8_t chip = bus->chip;
+	chip_strikes[chip] = 0;
+	if (bus->op == NB_CALIB) {
+		// Also what the chip starts from if it has to be brought back
+		memcpy(calib[chip].baselines, bus->buf, NUM_ELECS);
+		calib[chip].has_baselines = 1;
+		calib_pending &= ~(1 << chip);
+		calib_fresh |= 1 << chip;
+		nb_bus_free(bus);
+		return;
+	}
+	if (bus->op == NB_VELOCITY) {
+		uint8_t velocity[NUM_ELECS];
+		estimate_velocity(chip, bus->buf, bus->status, velocity);
+		keyboard_update(chip, bus->status, velocity);
+		nb_bus_free(bus);
+		return;
+	}
+	uint16_t status = bus->buf[0] | (bus->buf[1] << 8);
+	uint16_t prev = (nb_read & (1 << chip)) ? nb_status[chip] : 0;
+	nb_status[chip] = status;
+	nb_read |= 1 << chip;
+	if (status & ~prev & ((1 << NUM_ELECS) - 1)) {
+		// Something went down, read how hard before the events go out.
+		// The bus stays ours, the chip's status waits in bus->status.
+		bus->op = NB_VELOCITY;
+		bus->status = status;
+		if (mpr121_read_nb(chip, FILTERED_DATA, bus->buf, ELEC_DATA_SIZE) == 0) {
+			return;
+		}
+	}
+	keyboard_update(chip, status, 0);
+	nb_bus_free(bus);
+}
+
+/*
+ * Counts a failed transfer against chip, and drops it once it has failed
+ * STRIKE_LIMIT times in a row: it stops being read and its keys are let
+ * go, until mpr121_poll brings it back.
+ */
+static void chip_error(uint8_t chip)
+{
+	chip_errors[chip]++;
+	if (++chip_strikes[chip] < STRIKE_LIMIT || !(init_ready & (1 << chip))) {
+		return;
+	}
+	chip_strikes[chip] = 0;
+	init_ready &= ~(1 << chip);
+	bus_of_chip(chip)->pending &= ~(1 << chip);
+	nb_read &= ~(1 << chip);
+	calib_fresh &= ~(1 << chip);
+	keyboard_update(chip, 0, 0);
+}
+
+/*
+ * The transfer on the bus failed or was abandoned. Gives up on the init
+ * step, or leaves the chip to be read again, and frees the bus.
+ */
+static void nb_fail(bus_t *bus)
+{
+	if (bus->op == NB_INIT) {
+		// No ack, or the bus went wrong: give up on this chip
+		chip_errors[bus->init_chip]++;
+		init_step_done(bus, 0);
+		nb_bus_free(bus);
+		return;
+	}
+	uint8_t chip = bus->chip;
+	chip_error(chip);
+	if (bus->op == NB_VELOCITY) {
+		// The status itself came through, send the events unweighted
+		keyboard_update(chip, bus->status, 0);
+		nb_bus_free(bus);
+		return;
+	}
+	if (bus->op == NB_CALIB) {
+		// Still in calib_pending, it goes again while the chip is up
+		nb_bus_free(bus);
+		return;
+	}
+	// The chip's interrupt line stays low until its status is read, so it
+	// will not fire again. Leave it pending behind the other chips, or for
+	// mpr121_poll to retry.
+	bus->busy = 0;
+	if (init_ready & (1 << chip)) {
+		bus->pending |= 1 << chip;
+	}
+	if (bus->pending & ~(1 << chip)) {
+		nb_start_next(bus);
+	}
+	init_advance(bus);
+}
+
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+	bus_t *bus = bus_of_handle(hi2c);
+	if (!bus || !bus->busy) {
+		return;
+	}
+	if (hi2c->ErrorCode & (HAL_I2C_ERROR_BERR | HAL_I2C_ERROR_ARLO)) {
+		// Something else is driving the lines, hold the bus for
+		// mpr121_poll to clock it free
+		bus->hung = 1;
+		return;
+	}
+	nb_fail(bus);
+}
+
+/*
+ * Half an SCL period while clocking a bus free by hand, slower than
+ * 100 kHz at any core clock.
+ */
+static void bus_delay()
+{
+	for (volatile uint32_t n = SystemCoreClock / 400000; n; n--);
+}
+
+/*
+ * Frees a bus from a chip holding SDA low partway through a byte: clocks
+ * SCL until it lets go, at most 9 times, then sends a STOP. The bus's I2C
+ * has to be deinitialized, HAL_I2C_Init takes the pins back.
+ */
+static void bus_clear(bus_t *bus)
+{
+	GPIO_InitTypeDef gpio = {0};
+	HAL_GPIO_WritePin(bus->port, bus->scl | bus->sda, GPIO_PIN_SET);
+	gpio.Pin = bus->scl | bus->sda;
+	gpio.Mode = GPIO_MODE_OUTPUT_OD;
+	gpio.Pull = GPIO_NOPULL;
+	gpio.Speed = GPIO_SPEED_FREQ_LOW;
+	HAL_GPIO_Init(bus->port, &gpio);
+	bus_delay();
+
+	for (int i = 0; i < 9 && HAL_GPIO_ReadPin(bus->port, bus->sda) == GPIO_PIN_RESET; i++) {
+		HAL_GPIO_WritePin(bus->port, bus->scl, GPIO_PIN_RESET);
+		bus_delay();
+		HAL_GPIO_WritePin(bus->port, bus->scl, GPIO_PIN_SET);
+		bus_delay();
+	}
+
+	// STOP: SDA rises while SCL is high
+	HAL_GPIO_WritePin(bus->port, bus->scl, GPIO_PIN_RESET);
+	bus_delay();
+	HAL_GPIO_WritePin(bus->port, bus->sda, GPIO_PIN_RESET);
+	bus_delay();
+	HAL_GPIO_WritePin(bus->port, bus->scl, GPIO_PIN_SET);
+	bus_delay();
+	HAL_GPIO_WritePin(bus->port, bus->sda, GPIO_PIN_SET);
+	bus_delay();
+}
+
+void mpr121_poll()
+{
+	for (int b = 0; b < MPR121_NUM_BUSES; b++) {
+		bus_t *bus = &buses[b];
+		uint32_t primask = __get_PRIMASK();
+		__disable_irq();
+		int hung = bus->busy && (bus->hung || HAL_GetTick() - bus->start_tick > I2C_TIMEOUT_MS);
+		if (hung) {
+			HAL_I2C_DeInit(bus->hi2c);
+		}
+		__set_PRIMASK(primask);
+
+		if (hung) {
+			// Its interrupts are off and busy keeps everything else off
+			// it, the other bus carries on meanwhile
+			bus_clear(bus);
+			HAL_I2C_Init(bus->hi2c);
+			__disable_irq();
+			bus->hung = 0;
+			nb_fail(bus);
+			__set_PRIMASK(primask);
+		}
+	}
+
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	if (HAL_GetTick() - reinit_tick >= REINIT_MS) {
+		reinit_tick = HAL_GetTick();
+		for (int b = 0; b < MPR121_NUM_BUSES; b++) {
+			bus_t *bus = &buses[b];
+			uint8_t mask = bus_mask(bus);
+			if (bus->init_step != INIT_DONE || !(mask & ~init_ready)) {
+				continue;
+			}
+			// Bring back the chips that dropped out or never came up,
+			// leaving the rest running
+			init_skip = (init_skip & ~mask) | (mask & init_ready);
+			init_next_chip(bus, bus->first_chip, INIT_STOP);
+		}
+	}
+	for (int b = 0; b < MPR121_NUM_BUSES; b++) {
+		// Reads left pending by a failed transfer, or one that found a
+		// blocking transfer on the bus, get no other interrupt to start them
+		nb_start_next(&buses[b]);
+		init_advance(&buses[b]);
+	}
+	__set_PRIMASK(primask);
+}
+
+uint32_t mpr121_errors(uint8_t chip)
+{
+	return (chip < MPR121_NUM_CHIPS) ? chip_errors[chip] : 0;
+}
+
+void mpr121_scan_start()
+{
+	// TIM7 reads every chip, the interrupt lines are left to latch
+	HAL_NVIC_DisableIRQ(EXTI15_10_IRQn);
+	HAL_TIM_Base_Start_IT(&htim7);
+}
+
+void mpr121_scan_stop()
+{
+	HAL_TIM_Base_Stop_IT(&htim7);
+	// Any edge since the last scan is still pending and fires here
+	HAL_NVIC_EnableIRQ(EXTI15_10_IRQn);
+}
+
+void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
+{
+	if (htim->Instance != TIM7) {
+		return;
+	}
+	// Chips still waiting from the last tick are read once, not twice
+	for (int b = 0; b < MPR121_NUM_BUSES; b++) {
+		bus_t *bus = &buses[b];
+		bus->pending |= init_ready & bus_mask(bus);
+		nb_start_next(bus);
+	}
+}
+
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
+{
+	uint32_t prof_start = profile_begin();
+	uint8_t chip = (GPIO_Pin == 0x400 ) ? 0 :
+				(GPIO_Pin == 0x1000) ? 1 :
+				(GPIO_Pin == 0x4000) ? 2 :
+				(GPIO_Pin == 0x8000) ? 3 : 4; //error
+
+	// A chip that is down or coming back up is left alone
+	if (chip < MPR121_NUM_CHIPS && (init_ready & (1 << chip))) {
+		bus_t *bus = bus_of_chip(chip);
+		bus->pending |= 1 << chip;
+		nb_start_next(bus);
+	}
+	profile_end(PROF_GPIO_EXTI, prof_start);
+}
@@ -1,5 +1,6 @@
 #include "stm32l4xx_hal.h"
 #include "pressure.h"
+#include "profile.h"
 
 #define LH_ADDR_LSB 0xa5
 #define RH_ADDR_LSB 0xa5
@@ -35,6 +36,7 @@ void pressure_read_start()
 
 void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
 {
+	uint32_t prof_start = profile_begin();
 
 	if(ibuf[0] != 0x7E){
 		goto exit;
@@ -55,6 +57,7 @@ void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
 
 exit:
 	pressure_read_start();
+	profile_end(PROF_UART_RX, prof_start);
 }
 
 void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
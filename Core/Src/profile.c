@@ -0,0 +1,66 @@
+#include <stdint.h>
+#include <string.h>
+#include "profile.h"
+#include "fastmem.h"
+
+prof_stats_t prof_stats[PROF_NUM_ZONES];
+volatile uint8_t prof_overrun;
+
+#if PROFILE_ENABLED
+
+void profile_init()
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+	memset(prof_stats, 0, sizeof(prof_stats));
+	profile_reset();
+}
+
+void profile_reset()
+{
+	for (int z = 0; z < PROF_NUM_ZONES; z++) {
+		uint32_t budget = prof_stats[z].budget;
+		memset(&prof_stats[z], 0, sizeof(prof_stats[z]));
+		prof_stats[z].min = UINT32_MAX;
+		prof_stats[z].budget = budget;
+	}
+	prof_overrun = 0;
+}
+
+void profile_set_budget(prof_zone_t zone, uint32_t cycles)
+{
+	prof_stats[zone].budget = cycles;
+}
+
+uint32_t profile_avg(prof_zone_t zone)
+{
+	prof_stats_t *s = &prof_stats[zone];
+	return s->count ? (uint32_t) (s->total / s->count) : 0;
+}
+
+// Called from the audio path, keep it next to it in SRAM2
+RAMFUNC uint32_t profile_end(prof_zone_t zone, uint32_t start)
+{
+	// Unsigned subtraction is right across a counter wrap
+	uint32_t cycles = DWT->CYCCNT - start;
+	prof_stats_t *s = &prof_stats[zone];
+	int bucket = cycles ? 32 - __CLZ(cycles) : 0;
+
+	s->count++;
+	s->total += cycles;
+	if (cycles < s->min) {
+		s->min = cycles;
+	}
+	if (cycles > s->max) {
+		s->max = cycles;
+	}
+	s->hist[(bucket < PROF_HIST_BUCKETS) ? bucket : PROF_HIST_BUCKETS - 1]++;
+	if (s->budget && cycles > s->budget) {
+		s->overruns++;
+		prof_overrun = 1;
+	}
+	return cycles;
+}
+
+#endif
@@ -0,0 +1,291 @@
+#include <string.h>
+#include "stm32l4xx_hal.h"
+#include "settings.h"
+
+// The SETTINGS region, split into NUM_SEGS segments. Each starts with a
+// seg_header_t, then records, each a rec_header_t and its data padded to
+// a double word, which is what the flash programs at a time.
+extern uint8_t _ssettings[], _esettings[];
+
+#define NUM_SEGS 2
+#define SEG_MAGIC 0x54544553 // "SETT"
+#define ERASED_KEY 0xFFFF
+#define PAD8(n) (((n) + 7) & ~7)
+
+typedef struct seg_header_s {
+	uint32_t magic;
+	uint32_t seq; // the active segment has the highest
+} seg_header_t;
+
+typedef struct rec_header_s {
+	uint16_t key; // ERASED_KEY past the last record
+	uint16_t size; // of the data
+	uint32_t check; // CRC-32 of key, size and data
+} rec_header_t;
+
+static uint8_t enabled; // dual bank, see settings_init
+static uint32_t seg_size;
+static uint8_t *seg; // active segment, 0 if there is none yet
+static uint32_t seg_seq;
+static uint8_t *log_end; // end of the valid records in seg
+static uint8_t log_full; // no more appends to seg, the next set compacts
+static volatile uint8_t ecc_fault; // settings_nmi caught a read of the region
+
+static uint32_t crc32(uint32_t crc, const uint8_t *data, int size)
+{
+	crc = ~crc;
+	for (int i = 0; i < size; i++) {
+		crc ^= data[i];
+		for (int b = 0; b < 8; b++) {
+			crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+		}
+	}
+	return ~crc;
+}
+
+static uint32_t rec_check(uint16_t key, uint16_t size, const void *data)
+{
+	uint16_t head[2] = {key, size};
+	return crc32(crc32(0, (const uint8_t *) head, sizeof(head)), data, size);
+}
+
+static uint8_t *rec_next(uint8_t *rec)
+{
+	return rec + sizeof(rec_header_t) + PAD8(((rec_header_t *) rec)->size);
+}
+
+/*
+ * Last record for key in the active segment, 0 if none.
+ */
+static rec_header_t *find(uint16_t key)
+{
+	rec_header_t *found = 0;
+	if (!seg) {
+		return 0;
+	}
+	for (uint8_t *p = seg + sizeof(seg_header_t); p < log_end; p = rec_next(p)) {
+		if (((rec_header_t *) p)->key == key) {
+			found = (rec_header_t *) p;
+		}
+	}
+	return found;
+}
+
+/*
+ * Programs size bytes of data at addr, padding the last double word with
+ * erased bytes. The flash has to be unlocked.
+ */
+static int program(uint8_t *addr, const void *data, int size)
+{
+	for (int i = 0; i < size; i += 8) {
+		uint64_t dword = ~(uint64_t) 0;
+		memcpy(&dword, (const uint8_t *) data + i, (size - i < 8) ? size - i : 8);
+		if (HAL_FLASH_Program(FLASH_TYPEPROGRAM_DOUBLEWORD, (uint32_t) addr + i, dword) != HAL_OK) {
+			return -1;
+		}
+	}
+	return 0;
+}
+
+/*
+ * Writes a record at addr, header first: a write cut short leaves a
+ * record that fails its check rather than one that looks erased.
+ */
+static int program_rec(uint8_t *addr, uint16_t key, const void *data, int size)
+{
+	rec_header_t rec = {key, size, rec_check(key, size, data)};
+	if (program(addr, &rec, sizeof(rec)) || program(addr + sizeof(rec), data, size)) {
+		return -1;
+	}
+	return 0;
+}
+
+/*
+ * Erases segment s. Dual bank only: the region is in bank 2, and the code
+ * runs on from bank 1 meanwhile.
+ */
+static int erase(uint8_t *s)
+{
+	FLASH_EraseInitTypeDef erase;
+	uint32_t addr = (uint32_t) s;
+	// 4 KB pages, numbered from the start of each bank
+	if (addr >= FLASH_BASE + FLASH_BANK_SIZE) {
+		erase.Banks = FLASH_BANK_2;
+		addr -= FLASH_BASE + FLASH_BANK_SIZE;
+	} else {
+		erase.Banks = FLASH_BANK_1;
+		addr -= FLASH_BASE;
+	}
+	erase.TypeErase = FLASH_TYPEERASE_PAGES;
+	erase.Page = addr / FLASH_PAGE_SIZE;
+	erase.NbPages = (seg_size + FLASH_PAGE_SIZE - 1) / FLASH_PAGE_SIZE;
+	uint32_t page_error;
+	return (HAL_FLASHEx_Erase(&erase, &page_error) == HAL_OK) ? 0 : -1;
+}
+
+/*
+ * Starts the next segment with the latest record of every key but key,
+ * then key's new value, and makes it the active one. Its header goes in
+ * last, until then the old segment stays active.
+ */
+static int compact(uint16_t key, const void *data, int size)
+{
+	uint8_t *next = _ssettings;
+	if (seg && seg + seg_size < _ssettings + NUM_SEGS * seg_size) {
+		next = seg + seg_size;
+	}
+	if (erase(next)) {
+		return -1;
+	}
+
+	uint8_t *end = next + seg_size;
+	uint8_t *p = next + sizeof(seg_header_t);
+	if (seg) {
+		for (uint8_t *rec = seg + sizeof(seg_header_t); rec < log_end; rec = rec_next(rec)) {
+			uint16_t rec_key = ((rec_header_t *) rec)->key;
+			if (rec_key == key || find(rec_key) != (rec_header_t *) rec) {
+				continue;
+			}
+			uint8_t *rec_end = rec_next(rec);
+			if (p + (rec_end - rec) > end || program(p, rec, rec_end - rec)) {
+				return -1;
+			}
+			p += rec_end - rec;
+		}
+	}
+	if (p + sizeof(rec_header_t) + PAD8(size) > end || program_rec(p, key, data, size)) {
+		return -1;
+	}
+	p += sizeof(rec_header_t) + PAD8(size);
+
+	seg_header_t head = {SEG_MAGIC, seg ? seg_seq + 1 : 0};
+	if (program(next, &head, sizeof(head))) {
+		return -1;
+	}
+	seg = next;
+	seg_seq = head.seq;
+	log_end = p;
+	log_full = 0;
+	return 0;
+}
+
+int settings_nmi()
+{
+	uint32_t eccr = FLASH->ECCR;
+	if (!(eccr & FLASH_FLAG_ECCD)) {
+		return 0;
+	}
+	uint32_t addr = FLASH_BASE + (eccr & FLASH_ECCR_ADDR_ECC);
+	if (eccr & FLASH_ECCR_BK_ECC) {
+		addr += FLASH_BANK_SIZE;
+	}
+	if (addr < (uint32_t) _ssettings || addr >= (uint32_t) _esettings) {
+		return 0;
+	}
+	__HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_ECCD);
+	ecc_fault = 1;
+	return 1;
+}
+
+/*
+ * Whether a read of the region since the last call came back with a
+ * double ECC error. The barriers have the reads done, and the NMI they
+ * raised taken, before the flag is looked at.
+ */
+static int ecc_failed()
+{
+	__DSB();
+	__ISB();
+	int failed = ecc_fault;
+	ecc_fault = 0;
+	return failed;
+}
+
+void settings_init()
+{
+	seg_size = (_esettings - _ssettings) / NUM_SEGS;
+	seg = 0;
+	// With one bank every fetch, the audio interrupts' included, waits
+	// out each page erase and the DAC underruns. Nothing is kept then.
+	enabled = READ_BIT(FLASH->OPTR, FLASH_OPTR_DBANK) != 0;
+	if (!enabled) {
+		return;
+	}
+	ecc_failed();
+	for (int i = 0; i < NUM_SEGS; i++) {
+		seg_header_t *head = (seg_header_t *) (_ssettings + i * seg_size);
+		seg_header_t h = *head;
+		if (!ecc_failed() && h.magic == SEG_MAGIC && (!seg || h.seq > seg_seq)) {
+			seg = (uint8_t *) head;
+			seg_seq = h.seq;
+		}
+	}
+	if (!seg) {
+		return;
+	}
+
+	// Up to the first erased or damaged record. A damaged one was cut
+	// short by a reset, the flash after it cannot be trusted to be
+	// erased, so the next set moves everything before it on. A double
+	// word cut short can fail its ECC, the read of it comes back through
+	// settings_nmi.
+	uint8_t *end = seg + seg_size;
+	uint8_t *p = seg + sizeof(seg_header_t);
+	log_full = 0;
+	while (p + sizeof(rec_header_t) <= end) {
+		rec_header_t rec = *(rec_header_t *) p;
+		if (ecc_failed()) {
+			log_full = 1;
+			break;
+		}
+		if (rec.key == ERASED_KEY) {
+			break;
+		}
+		if (rec.size > SETTINGS_MAX_SIZE || rec_next(p) > end
+				|| rec.check != rec_check(rec.key, rec.size, p + sizeof(rec_header_t))
+				|| ecc_failed()) {
+			log_full = 1;
+			break;
+		}
+		p = rec_next(p);
+	}
+	log_end = p;
+}
+
+int settings_get(uint16_t key, void *data, int size)
+{
+	rec_header_t *rec = find(key);
+	if (!rec || rec->size != size) {
+		return -1;
+	}
+	memcpy(data, rec + 1, size);
+	return 0;
+}
+
+int settings_set(uint16_t key, const void *data, int size)
+{
+	if (!enabled || key == ERASED_KEY || size < 0 || size > SETTINGS_MAX_SIZE) {
+		return -1;
+	}
+	rec_header_t *rec = find(key);
+	if (rec && rec->size == size && memcmp(rec + 1, data, size) == 0) {
+		return 0;
+	}
+
+	int err;
+	HAL_FLASH_Unlock();
+	__HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_ALL_ERRORS);
+	if (seg && !log_full && log_end + sizeof(rec_header_t) + PAD8(size) <= seg + seg_size) {
+		err = program_rec(log_end, key, data, size);
+		if (err) {
+			// Whatever got written is in the way now
+			log_full = 1;
+		} else {
+			log_end += sizeof(rec_header_t) + PAD8(size);
+		}
+	} else {
+		err = compact(key, data, size);
+	}
+	HAL_FLASH_Lock();
+	return err;
+}
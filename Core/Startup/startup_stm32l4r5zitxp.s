@@ -80,6 +80,16 @@ LoopCopyDataInit:
   adds r4, r0, r3
   cmp r4, r1
   bcc CopyDataInit
+
+/* Copy the SRAM2 code and data from flash, see .ramfunc and .fastdata */
+  ldr r0, =_sramfunc
+  ldr r1, =_eramfunc
+  ldr r2, =_siramfunc
+  bl CopySection
+  ldr r0, =_sfastdata
+  ldr r1, =_efastdata
+  ldr r2, =_sifastdata
+  bl CopySection
   
 /* Zero fill the bss segment. */
   ldr r2, =_sbss
@@ -102,6 +112,22 @@ LoopFillZerobss:
 
 LoopForever:
     b LoopForever
+
+/* Copies words from r2 to [r0, r1) */
+CopySection:
+  movs r3, #0
+  b LoopCopySection
+
+CopySectionWord:
+  ldr r4, [r2, r3]
+  str r4, [r0, r3]
+  adds r3, r3, #4
+
+LoopCopySection:
+  adds r4, r0, r3
+  cmp r4, r1
+  bcc CopySectionWord
+  bx lr
     
 .size	Reset_Handler, .-Reset_Handler
 
@@ -0,0 +1,585 @@
+/*
+ * Host-side driver for the audio engine in Core/Src/audio.c.
+ *
+ *   audio_host render <events> <out.wav>   renders a note-event script to WAV
+ *   audio_host bench [samples]             times audio_render_block at 1..AUDIO_MAX_VOICES voices
+ *   audio_host mix [blocks]                float mix loop vs mix_voices at 16/32/48 voices
+ *   audio_host osc [blocks]                time and THD+N of each oscillator table size and lookup
+ *   audio_host dsp [runs]                  checks the M4 mixer kernels against the plain C ones
+ *
+ * Event scripts have one event per line, '#' starts a comment:
+ *
+ *   <time_ms> on <note> <amp>    key down, note is 0..MAX_NOTES-1
+ *   <time_ms> off <note>         key up
+ *   <time_ms> sustain <0|1>      sustain pedal
+ *   <time_ms> mode <n>           instrument mode, same as the blue button
+ *   <time_ms> end                stop rendering
+ *
+ * Events are applied between blocks, as they are on the board where the
+ * main loop runs between DMA callbacks.
+ */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "audio.h"
+#include "audio_tables.h"
+#include "mix.h"
+#include "mix_dsp.h"
+#include "hal_stub.h"
+
+#define MAX_EVENTS 4096
+#define DEFAULT_BENCH_SAMPLES 20000
+#define DEFAULT_MIX_BLOCKS 20000
+#define DEFAULT_OSC_BLOCKS 5000
+#define DEFAULT_DSP_RUNS 20000
+#define DSP_TIMING_BLOCKS 20000
+#define OSC_BENCH_VOICES 16
+#define OSC_THD_FREQ 1000.3
+#define MIX_LUT_BITS 8
+#define BENCH_AMP 0.7f
+
+typedef enum {
+	EV_ON,
+	EV_OFF,
+	EV_SUSTAIN,
+	EV_MODE,
+	EV_END
+} event_type_t;
+
+typedef struct {
+	uint32_t time_ms;
+	event_type_t type;
+	int arg;
+	float amp;
+} event_t;
+
+static event_t events[MAX_EVENTS];
+static int num_events;
+
+static uint64_t now_ns()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t) ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+/*
+ * Rate at which TIM4 clocks samples into the DAC, taken from the setup
+ * done by init_timer().
+ */
+static uint32_t sample_rate()
+{
+	return HOST_TIM_CLK / (htim4.Init.Prescaler + 1) / (htim4.Init.Period + 1);
+}
+
+static int load_events(const char *path)
+{
+	FILE *f = fopen(path, "r");
+	char line[256];
+	int line_no = 0;
+
+	if (!f) {
+		perror(path);
+		return -1;
+	}
+	while (fgets(line, sizeof(line), f)) {
+		char cmd[16];
+		unsigned int t;
+		int arg = 0;
+		float amp = BENCH_AMP;
+		char *hash = strchr(line, '#');
+		int n;
+
+		line_no++;
+		if (hash) {
+			*hash = '\0';
+		}
+		n = sscanf(line, "%u %15s %d %f", &t, cmd, &arg, &amp);
+		if (n <= 0) {
+			continue;
+		}
+		if (n < 2 || num_events >= MAX_EVENTS) {
+			fprintf(stderr, "%s:%d: bad event\n", path, line_no);
+			fclose(f);
+			return -1;
+		}
+
+		event_t *ev = &events[num_events++];
+		ev->time_ms = t;
+		ev->arg = arg;
+		ev->amp = amp;
+		if (!strcmp(cmd, "on")) {
+			ev->type = EV_ON;
+		} else if (!strcmp(cmd, "off")) {
+			ev->type = EV_OFF;
+		} else if (!strcmp(cmd, "sustain")) {
+			ev->type = EV_SUSTAIN;
+		} else if (!strcmp(cmd, "mode")) {
+			ev->type = EV_MODE;
+		} else if (!strcmp(cmd, "end")) {
+			ev->type = EV_END;
+		} else {
+			fprintf(stderr, "%s:%d: unknown command '%s'\n", path, line_no, cmd);
+			fclose(f);
+			return -1;
+		}
+		if ((ev->type == EV_ON || ev->type == EV_OFF) && (arg < 0 || arg >= MAX_NOTES)) {
+			fprintf(stderr, "%s:%d: note %d out of range\n", path, line_no, arg);
+			fclose(f);
+			return -1;
+		}
+		if (num_events > 1 && ev->time_ms < events[num_events - 2].time_ms) {
+			fprintf(stderr, "%s:%d: events must be in time order\n", path, line_no);
+			fclose(f);
+			return -1;
+		}
+	}
+	fclose(f);
+	return 0;
+}
+
+static void put_le16(FILE *f, uint16_t v)
+{
+	fputc(v & 0xff, f);
+	fputc(v >> 8, f);
+}
+
+static void put_le32(FILE *f, uint32_t v)
+{
+	put_le16(f, v & 0xffff);
+	put_le16(f, v >> 16);
+}
+
+static void write_wav_header(FILE *f, uint32_t rate, uint32_t num_samples)
+{
+	fwrite("RIFF", 1, 4, f);
+	put_le32(f, 36 + num_samples * 2);
+	fwrite("WAVEfmt ", 1, 8, f);
+	put_le32(f, 16);
+	put_le16(f, 1); // PCM
+	put_le16(f, 1); // mono
+	put_le32(f, rate);
+	put_le32(f, rate * 2);
+	put_le16(f, 2);
+	put_le16(f, 16);
+	fwrite("data", 1, 4, f);
+	put_le32(f, num_samples * 2);
+}
+
+static void apply_event(const event_t *ev)
+{
+	switch (ev->type) {
+	case EV_ON:
+		add_note(ev->arg, ev->amp);
+		break;
+	case EV_OFF:
+		set_damp_factor(ev->arg, 1);
+		break;
+	case EV_SUSTAIN:
+		sustain = ev->arg != 0;
+		break;
+	case EV_MODE:
+		mode = ev->arg % NUM_MODES;
+		audio_set_mode(mode);
+		break;
+	case EV_END:
+		break;
+	}
+}
+
+static int render(const char *events_path, const char *wav_path)
+{
+	if (load_events(events_path)) {
+		return 1;
+	}
+	if (num_events == 0) {
+		fprintf(stderr, "%s: no events\n", events_path);
+		return 1;
+	}
+
+	FILE *out = fopen(wav_path, "wb");
+	if (!out) {
+		perror(wav_path);
+		return 1;
+	}
+
+	init_audio_ctx();
+	init_timer();
+	uint32_t rate = sample_rate();
+	uint32_t num_samples = 0;
+	uint16_t block[AUDIO_BLOCK_SIZE];
+
+	write_wav_header(out, rate, 0);
+	for (int e = 0; e < num_events; e++) {
+		uint64_t until = (uint64_t) events[e].time_ms * rate / 1000;
+		while (num_samples < until) {
+			audio_render_block(block, AUDIO_BLOCK_SIZE);
+			for (int k = 0; k < AUDIO_BLOCK_SIZE; k++) {
+				put_le16(out, (uint16_t) (((int32_t) block[k] - 2048) * 16));
+			}
+			num_samples += AUDIO_BLOCK_SIZE;
+		}
+		if (events[e].type == EV_END) {
+			break;
+		}
+		apply_event(&events[e]);
+	}
+	fseek(out, 0, SEEK_SET);
+	write_wav_header(out, rate, num_samples);
+	fclose(out);
+
+	printf("%s: %u samples at %u Hz (%.2f s)\n", wav_path, num_samples, rate, (double) num_samples / rate);
+	return 0;
+}
+
+static void start_voices(int n)
+{
+	init_audio_ctx();
+	sustain = 0;
+	for (int i = 0; i < n; i++) {
+		add_note(i, BENCH_AMP);
+	}
+}
+
+static int bench(int samples)
+{
+	uint16_t block[AUDIO_BLOCK_SIZE];
+	int blocks = (samples + AUDIO_BLOCK_SIZE - 1) / AUDIO_BLOCK_SIZE;
+
+	init_audio_ctx();
+	init_timer();
+	uint32_t rate = sample_rate();
+
+	printf("# %u Hz, block of %d samples every %.0f ns, %d blocks per point\n",
+			rate, AUDIO_BLOCK_SIZE, 1e9 * AUDIO_BLOCK_SIZE / rate, blocks);
+	printf("# voices  ns/sample  worst_block_ns\n");
+	for (int n = 1; n <= AUDIO_MAX_VOICES; n++) {
+		uint64_t worst = 0;
+
+		// Throughput over the whole run
+		start_voices(n);
+		uint64_t t0 = now_ns();
+		for (int i = 0; i < blocks; i++) {
+			audio_render_block(block, AUDIO_BLOCK_SIZE);
+		}
+		uint64_t total = now_ns() - t0;
+
+		// Per-block worst case, timer overhead included
+		start_voices(n);
+		for (int i = 0; i < blocks; i++) {
+			uint64_t t = now_ns();
+			audio_render_block(block, AUDIO_BLOCK_SIZE);
+			t = now_ns() - t;
+			if (t > worst) {
+				worst = t;
+			}
+		}
+		printf("%8d  %9.1f  %14llu\n", n, (double) total / (blocks * AUDIO_BLOCK_SIZE), (unsigned long long) worst);
+	}
+	return 0;
+}
+
+/*
+ * The mix loop as it was before the Q14 mixer: float gain, one voice at a time.
+ */
+static void mix_voices_float(float *acc, int len, const int16_t *table, int shift,
+		uint32_t *phase, const uint32_t *phase_inc, const float *amp, int num_voices)
+{
+	for (int v = 0; v < num_voices; v++) {
+		uint32_t p = phase[v];
+		for (int k = 0; k < len; k++) {
+			p += phase_inc[v];
+			acc[k] += amp[v] * table[p >> shift];
+		}
+		phase[v] = p;
+	}
+}
+
+static int mix_bench(int blocks)
+{
+	static const int voice_counts[] = {16, 32, 48};
+	int16_t table[1 << MIX_LUT_BITS];
+	const int16_t *tables[MAX_NOTES];
+	uint32_t phase[MAX_NOTES];
+	uint32_t phase_inc[MAX_NOTES];
+	int32_t gain[MAX_NOTES];
+	int32_t gain_step[MAX_NOTES];
+	float amp[MAX_NOTES];
+	float acc_f[AUDIO_BLOCK_SIZE];
+	int32_t acc_q[AUDIO_BLOCK_SIZE];
+	volatile float sink_f = 0;
+	volatile int32_t sink_q = 0;
+
+	srand(1);
+	for (int i = 0; i < (1 << MIX_LUT_BITS); i++) {
+		table[i] = (rand() % 4095) - 2047;
+	}
+	for (int v = 0; v < MAX_NOTES; v++) {
+		phase[v] = rand();
+		phase_inc[v] = rand();
+		amp[v] = 0.7f;
+		gain[v] = (int32_t) (amp[v] * MIX_GAIN_ONE) << MIX_RAMP_BITS;
+		gain_step[v] = 0;
+		tables[v] = table;
+	}
+
+	printf("# %d blocks of %d samples per point\n", blocks, AUDIO_BLOCK_SIZE);
+	printf("# voices  float_ns/sample  q14_ns/sample  speedup\n");
+	for (unsigned int c = 0; c < sizeof(voice_counts) / sizeof(voice_counts[0]); c++) {
+		int n = voice_counts[c];
+
+		uint64_t t0 = now_ns();
+		for (int b = 0; b < blocks; b++) {
+			memset(acc_f, 0, sizeof(acc_f));
+			mix_voices_float(acc_f, AUDIO_BLOCK_SIZE, table, 32 - MIX_LUT_BITS, phase, phase_inc, amp, n);
+			sink_f += acc_f[b % AUDIO_BLOCK_SIZE];
+		}
+		uint64_t t_float = now_ns() - t0;
+
+		t0 = now_ns();
+		for (int b = 0; b < blocks; b++) {
+			memset(acc_q, 0, sizeof(acc_q));
+			mix_voices(acc_q, AUDIO_BLOCK_SIZE, tables, 32 - MIX_LUT_BITS, phase, phase_inc, gain, gain_step, n);
+			sink_q += acc_q[b % AUDIO_BLOCK_SIZE];
+		}
+		uint64_t t_q = now_ns() - t0;
+
+		double samples = (double) blocks * AUDIO_BLOCK_SIZE;
+		printf("%8d  %15.2f  %13.2f  %7.2f\n", n, t_float / samples, t_q / samples, (double) t_float / t_q);
+	}
+	return 0;
+}
+
+typedef void (*mix_fn_t)(int32_t *acc, int len, const int16_t *const *table, int shift, uint32_t *phase,
+		const uint32_t *phase_inc, const int32_t *gain, const int32_t *gain_step, int num_voices);
+
+/*
+ * THD+N in dB of one full-gain sine voice at OSC_THD_FREQ, measured against
+ * the exact sine at the same phases. Includes the 12-bit table rounding.
+ */
+static double osc_thd(mix_fn_t mix_fn, const int16_t *table, int bits, uint32_t rate, int blocks)
+{
+	const int16_t *tables[1] = {table};
+	uint32_t phase = 0;
+	uint32_t phase_inc = (uint32_t) (OSC_THD_FREQ / rate * 4294967296.0);
+	int32_t gain = MIX_GAIN_ONE << MIX_RAMP_BITS;
+	int32_t gain_step = 0;
+	int32_t acc[AUDIO_BLOCK_SIZE];
+	double signal = 0, error = 0;
+
+	for (int b = 0; b < blocks; b++) {
+		uint32_t p = phase;
+		memset(acc, 0, sizeof(acc));
+		mix_fn(acc, AUDIO_BLOCK_SIZE, tables, 32 - bits, &phase, &phase_inc, &gain, &gain_step, 1);
+		for (int k = 0; k < AUDIO_BLOCK_SIZE; k++) {
+			p += phase_inc;
+			double ideal = 2047 * sin(2 * M_PI * p / 4294967296.0);
+			double e = (double) acc[k] / MIX_GAIN_ONE - ideal;
+			signal += ideal * ideal;
+			error += e * e;
+		}
+	}
+	return 10 * log10(error / signal);
+}
+
+static int osc_bench(int blocks)
+{
+	static const int table_bits[] = {8, 10, 11};
+	static const char *const methods[] = {"truncate", "linear"};
+	static const mix_fn_t mix_fns[] = {mix_voices, mix_voices_lerp};
+	static int16_t table[(1 << 11) + 1];
+	const int16_t *tables[OSC_BENCH_VOICES];
+	uint32_t phase[OSC_BENCH_VOICES];
+	uint32_t phase_inc[OSC_BENCH_VOICES];
+	int32_t gain[OSC_BENCH_VOICES];
+	int32_t gain_step[OSC_BENCH_VOICES];
+	int32_t acc[AUDIO_BLOCK_SIZE];
+	volatile int32_t sink = 0;
+
+	init_timer();
+	uint32_t rate = sample_rate();
+
+	srand(1);
+	for (int v = 0; v < OSC_BENCH_VOICES; v++) {
+		tables[v] = table;
+		phase[v] = rand();
+		phase_inc[v] = rand() >> 4;
+		gain[v] = (MIX_GAIN_ONE / 2) << MIX_RAMP_BITS;
+		gain_step[v] = 0;
+	}
+
+	printf("# %d Hz, %d voices x %d blocks for timing, %.1f Hz sine for THD+N\n",
+			rate, OSC_BENCH_VOICES, blocks, OSC_THD_FREQ);
+	printf("# firmware builds with %d-entry tables, %s lookup\n", WAVETABLE_SIZE,
+			methods[AUDIO_OSC_QUALITY]);
+	printf("# host timings, relative cost only: M4 cycles come from PROF_AUDIO_BLOCK\n");
+	printf("# entries  lookup    ns/voice-sample  thd+n_db\n");
+	for (unsigned int t = 0; t < sizeof(table_bits) / sizeof(table_bits[0]); t++) {
+		int bits = table_bits[t];
+		int size = 1 << bits;
+
+		for (int i = 0; i <= size; i++) {
+			table[i] = (int16_t) lround(2047 * sin(2 * M_PI * i / size));
+		}
+		for (unsigned int m = 0; m < sizeof(mix_fns) / sizeof(mix_fns[0]); m++) {
+			uint64_t t0 = now_ns();
+			for (int b = 0; b < blocks; b++) {
+				memset(acc, 0, sizeof(acc));
+				mix_fns[m](acc, AUDIO_BLOCK_SIZE, tables, 32 - bits, phase, phase_inc, gain, gain_step, OSC_BENCH_VOICES);
+				sink += acc[b % AUDIO_BLOCK_SIZE];
+			}
+			double ns = (double) (now_ns() - t0) / ((double) blocks * AUDIO_BLOCK_SIZE * OSC_BENCH_VOICES);
+			printf("%9d  %-8s  %15.2f  %8.1f\n", size, methods[m], ns, osc_thd(mix_fns[m], table, bits, rate, blocks));
+		}
+	}
+	return 0;
+}
+
+/*
+ * Random voices for dsp_check: 12-bit tables of 2^bits entries plus the
+ * guard, and gains that ramp anywhere between 0 and MIX_GAIN_ONE over len
+ * samples, as update_amps hands them to the mixer.
+ */
+static void dsp_voices(int16_t *table, int bits, int len, uint32_t *phase, uint32_t *phase_inc,
+		int32_t *gain, int32_t *gain_step, int num_voices)
+{
+	int size = 1 << bits;
+	for (int i = 0; i < size; i++) {
+		table[i] = (rand() % 4095) - 2047;
+	}
+	table[size] = table[0];
+	for (int v = 0; v < num_voices; v++) {
+		phase[v] = ((uint32_t) rand() << 16) ^ rand();
+		phase_inc[v] = ((uint32_t) rand() << 16) ^ rand();
+		int32_t start = rand() % (MIX_GAIN_ONE + 1);
+		int32_t end = rand() % (MIX_GAIN_ONE + 1);
+		gain[v] = start << MIX_RAMP_BITS;
+		gain_step[v] = ((end - start) << MIX_RAMP_BITS) / len;
+	}
+}
+
+/*
+ * Runs mix_voices and mix_voices_lerp as built for the M4 (mix_dsp.c)
+ * against mix_voices_ref and mix_voices_lerp_ref on the same random
+ * voices, and counts the runs where any sample or phase differs. Then
+ * times both builds at MAX_NOTES voices; on the host the intrinsics are
+ * plain C, so that only shows the pairing costs nothing extra here.
+ */
+static int dsp_check(int runs)
+{
+	static const int table_bits[] = {8, 10, 11};
+	static const char *const names[] = {"mix_voices", "mix_voices_lerp"};
+	static const mix_fn_t ref_fns[] = {mix_voices_ref, mix_voices_lerp_ref};
+	static const mix_fn_t dsp_fns[] = {mix_voices_dsp, mix_voices_lerp_dsp};
+	static int16_t table[(1 << 11) + 1];
+	const int16_t *tables[MAX_NOTES];
+	uint32_t phase[MAX_NOTES], phase_ref[MAX_NOTES];
+	uint32_t phase_inc[MAX_NOTES];
+	int32_t gain[MAX_NOTES];
+	int32_t gain_step[MAX_NOTES];
+	int32_t acc[AUDIO_BLOCK_SIZE], acc_ref[AUDIO_BLOCK_SIZE];
+	volatile int32_t sink = 0;
+	int failed = 0;
+
+	for (int v = 0; v < MAX_NOTES; v++) {
+		tables[v] = table;
+	}
+
+	srand(1);
+	printf("# %d runs of 1..%d voices, 1..%d samples\n", runs, MAX_NOTES, AUDIO_BLOCK_SIZE);
+	printf("# kernel           mismatched_runs\n");
+	for (unsigned int f = 0; f < sizeof(ref_fns) / sizeof(ref_fns[0]); f++) {
+		int mismatched = 0;
+		for (int r = 0; r < runs; r++) {
+			int bits = table_bits[rand() % 3];
+			int n = 1 + rand() % MAX_NOTES;
+			int len = 1 + rand() % AUDIO_BLOCK_SIZE;
+			dsp_voices(table, bits, len, phase, phase_inc, gain, gain_step, n);
+			for (int k = 0; k < len; k++) {
+				acc[k] = acc_ref[k] = rand() - RAND_MAX / 2;
+			}
+			memcpy(phase_ref, phase, sizeof(phase));
+			ref_fns[f](acc_ref, len, tables, 32 - bits, phase_ref, phase_inc, gain, gain_step, n);
+			dsp_fns[f](acc, len, tables, 32 - bits, phase, phase_inc, gain, gain_step, n);
+			if (memcmp(acc, acc_ref, len * sizeof(acc[0])) || memcmp(phase, phase_ref, n * sizeof(phase[0]))) {
+				mismatched++;
+			}
+		}
+		printf("%-17s  %15d\n", names[f], mismatched);
+		failed |= mismatched;
+	}
+
+	printf("# %d voices x %d blocks, host ns/voice-sample\n", MAX_NOTES, DSP_TIMING_BLOCKS);
+	printf("# kernel         ref    dsp\n");
+	for (unsigned int f = 0; f < sizeof(ref_fns) / sizeof(ref_fns[0]); f++) {
+		dsp_voices(table, 8, AUDIO_BLOCK_SIZE, phase, phase_inc, gain, gain_step, MAX_NOTES);
+		for (int v = 0; v < MAX_NOTES; v++) {
+			gain_step[v] = 0;
+		}
+		double ns[2];
+		for (int d = 0; d < 2; d++) {
+			mix_fn_t fn = d ? dsp_fns[f] : ref_fns[f];
+			uint64_t t0 = now_ns();
+			for (int b = 0; b < DSP_TIMING_BLOCKS; b++) {
+				memset(acc, 0, sizeof(acc));
+				fn(acc, AUDIO_BLOCK_SIZE, tables, 24, phase, phase_inc, gain, gain_step, MAX_NOTES);
+				sink += acc[b % AUDIO_BLOCK_SIZE];
+			}
+			ns[d] = (double) (now_ns() - t0) / ((double) DSP_TIMING_BLOCKS * AUDIO_BLOCK_SIZE * MAX_NOTES);
+		}
+		printf("%-15s  %5.2f  %5.2f\n", names[f], ns[0], ns[1]);
+	}
+	return failed ? 1 : 0;
+}
+
+static void usage()
+{
+	fprintf(stderr, "usage: audio_host render <events> <out.wav>\n"
+					"       audio_host bench [samples]\n"
+					"       audio_host mix [blocks]\n"
+					"       audio_host osc [blocks]\n"
+					"       audio_host dsp [runs]\n");
+}
+
+int main(int argc, char **argv)
+{
+	if (argc >= 4 && !strcmp(argv[1], "render")) {
+		return render(argv[2], argv[3]);
+	}
+	if (argc >= 2 && !strcmp(argv[1], "bench")) {
+		int samples = (argc >= 3) ? atoi(argv[2]) : DEFAULT_BENCH_SAMPLES;
+		if (samples <= 0) {
+			usage();
+			return 1;
+		}
+		return bench(samples);
+	}
+	if (argc >= 2 && !strcmp(argv[1], "mix")) {
+		int blocks = (argc >= 3) ? atoi(argv[2]) : DEFAULT_MIX_BLOCKS;
+		if (blocks <= 0) {
+			usage();
+			return 1;
+		}
+		return mix_bench(blocks);
+	}
+	if (argc >= 2 && !strcmp(argv[1], "osc")) {
+		int blocks = (argc >= 3) ? atoi(argv[2]) : DEFAULT_OSC_BLOCKS;
+		if (blocks <= 0) {
+			usage();
+			return 1;
+		}
+		return osc_bench(blocks);
+	}
+	if (argc >= 2 && !strcmp(argv[1], "dsp")) {
+		int runs = (argc >= 3) ? atoi(argv[2]) : DEFAULT_DSP_RUNS;
+		if (runs <= 0) {
+			usage();
+			return 1;
+		}
+		return dsp_check(runs);
+	}
+	usage();
+	return 1;
+}
@@ -0,0 +1,61 @@
+/*
+ * Host implementations of the HAL, display and main.c symbols that
+ * Core/Src/audio.c links against. Nothing is clocked here: the harness
+ * calls audio_render_block itself in place of the DMA callbacks.
+ */
+#include <stdint.h>
+#include "stm32l4xx_hal.h"
+#include "display.h"
+#include "hal_stub.h"
+
+TIM_TypeDef host_tim4;
+
+uint32_t SystemCoreClock = HOST_TIM_CLK;
+
+DAC_HandleTypeDef hdac1;
+TIM_HandleTypeDef htim4;
+
+// Globals normally owned by main.c
+volatile uint8_t sustain;
+volatile uint8_t mode;
+volatile uint8_t chmod;
+volatile uint8_t tutorial_mode;
+volatile int best_index = -1;
+volatile int pressure_wait;
+
+HAL_StatusTypeDef HAL_DAC_Start_DMA(DAC_HandleTypeDef *hdac, uint32_t Channel, uint32_t *pData, uint32_t Length, uint32_t Alignment)
+{
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Init(TIM_HandleTypeDef *htim)
+{
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Start(TIM_HandleTypeDef *htim)
+{
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIMEx_MasterConfigSynchronization(TIM_HandleTypeDef *htim, TIM_MasterConfigTypeDef *sMasterConfig)
+{
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Stop(TIM_HandleTypeDef *htim)
+{
+	return HAL_OK;
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+}
+
+void disp_print(char *s, uint16_t x, uint16_t y, uint8_t size, uint16_t fg, uint16_t bg)
+{
+}
+
+void disp_fill_rect(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color)
+{
+}
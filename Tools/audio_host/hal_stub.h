@@ -0,0 +1,17 @@
+#ifndef HAL_STUB_H
+#define HAL_STUB_H
+
+#include <stdint.h>
+#include "stm32l4xx_hal.h"
+
+// Timer kernel clock set up by SystemClock_Config (MSI 4 MHz * 60 / 2)
+#define HOST_TIM_CLK 120000000
+
+extern DAC_HandleTypeDef hdac1;
+extern TIM_HandleTypeDef htim4;
+
+extern volatile uint8_t sustain;
+extern volatile uint8_t mode;
+extern volatile uint8_t tutorial_mode;
+
+#endif
@@ -0,0 +1,14 @@
+/*
+ * Core/Src/mix.c built a second time with its __ARM_FEATURE_DSP path
+ * switched on, so the host can check it against the plain C versions.
+ * Its functions are renamed to link next to the ones from the real build.
+ */
+#include "mix_dsp.h"
+
+#define __ARM_FEATURE_DSP 1
+#define mix_voices mix_voices_dsp
+#define mix_voices_ref mix_voices_ref_dsp
+#define mix_voices_lerp mix_voices_lerp_dsp
+#define mix_voices_lerp_ref mix_voices_lerp_ref_dsp
+
+#include "../../Core/Src/mix.c"
@@ -0,0 +1,15 @@
+#ifndef MIX_DSP_H
+#define MIX_DSP_H
+
+#include <stdint.h>
+
+/*
+ * mix_voices and mix_voices_lerp as built for the Cortex-M4, two voices
+ * to an SMLAD, with the intrinsics from stub/stm32l4xx.h.
+ */
+void mix_voices_dsp(int32_t *acc, int len, const int16_t *const *table, int shift, uint32_t *phase,
+		const uint32_t *phase_inc, const int32_t *gain, const int32_t *gain_step, int num_voices);
+void mix_voices_lerp_dsp(int32_t *acc, int len, const int16_t *const *table, int shift, uint32_t *phase,
+		const uint32_t *phase_inc, const int32_t *gain, const int32_t *gain_step, int num_voices);
+
+#endif
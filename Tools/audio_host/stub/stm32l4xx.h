@@ -0,0 +1,31 @@
+/*
+ * Portable C versions of the CMSIS SIMD intrinsics the mixer uses, for
+ * building its Cortex-M4 DSP path on the host (see mix_dsp.c). Each one
+ * gives the same 32-bit result as the instruction, wrapping where it does.
+ */
+#ifndef STM32L4XX_H
+#define STM32L4XX_H
+
+#include <stdint.h>
+
+// Bottom half of a, top half of b << shift
+static inline uint32_t __PKHBT(uint32_t a, uint32_t b, int shift)
+{
+	return (a & 0xFFFF) | ((b << shift) & 0xFFFF0000);
+}
+
+// Top half of a, bottom half of b arithmetically shifted right by shift
+static inline uint32_t __PKHTB(uint32_t a, uint32_t b, int shift)
+{
+	return (a & 0xFFFF0000) | ((uint32_t) ((int32_t) b >> shift) & 0xFFFF);
+}
+
+// acc plus the products of the signed bottom halves and the top halves
+static inline uint32_t __SMLAD(uint32_t x, uint32_t y, uint32_t acc)
+{
+	int32_t lo = (int16_t) x * (int16_t) y;
+	int32_t hi = (int16_t) (x >> 16) * (int16_t) (y >> 16);
+	return acc + (uint32_t) lo + (uint32_t) hi;
+}
+
+#endif
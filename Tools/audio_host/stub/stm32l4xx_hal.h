@@ -0,0 +1,73 @@
+/*
+ * Minimal stand-in for the STM32L4 HAL so Core/Src/audio.c can be built and
+ * run on a Linux host. Only what the audio engine touches is declared here;
+ * the implementations live in hal_stub.c.
+ */
+#ifndef STM32L4XX_HAL_H
+#define STM32L4XX_HAL_H
+
+#include <stdint.h>
+
+typedef enum {
+	HAL_OK = 0x00,
+	HAL_ERROR = 0x01,
+	HAL_BUSY = 0x02,
+	HAL_TIMEOUT = 0x03
+} HAL_StatusTypeDef;
+
+typedef struct {
+	uint32_t dummy;
+} TIM_TypeDef;
+
+typedef struct {
+	uint32_t Prescaler;
+	uint32_t CounterMode;
+	uint32_t Period;
+	uint32_t ClockDivision;
+	uint32_t RepetitionCounter;
+	uint32_t AutoReloadPreload;
+} TIM_Base_InitTypeDef;
+
+typedef struct {
+	TIM_TypeDef *Instance;
+	TIM_Base_InitTypeDef Init;
+} TIM_HandleTypeDef;
+
+typedef struct {
+	uint32_t MasterOutputTrigger;
+	uint32_t MasterSlaveMode;
+} TIM_MasterConfigTypeDef;
+
+typedef struct {
+	void *Instance;
+} DAC_HandleTypeDef;
+
+extern uint32_t SystemCoreClock;
+
+extern TIM_TypeDef host_tim4;
+#define TIM4 (&host_tim4)
+
+#define TIM_COUNTERMODE_UP 0x00000000U
+#define TIM_CLOCKDIVISION_DIV1 0x00000000U
+#define TIM_AUTORELOAD_PRELOAD_DISABLE 0x00000000U
+#define TIM_TRGO_UPDATE 0x00000020U
+#define TIM_MASTERSLAVEMODE_DISABLE 0x00000000U
+
+#define DAC_CHANNEL_1 0x00000000U
+#define DAC_ALIGN_12B_R 0x00000000U
+
+HAL_StatusTypeDef HAL_DAC_Start_DMA(DAC_HandleTypeDef *hdac, uint32_t Channel, uint32_t *pData, uint32_t Length, uint32_t Alignment);
+
+HAL_StatusTypeDef HAL_TIM_Base_Init(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIM_Base_Start(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIM_Base_Stop(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIMEx_MasterConfigSynchronization(TIM_HandleTypeDef *htim, TIM_MasterConfigTypeDef *sMasterConfig);
+
+void HAL_Delay(uint32_t Delay);
+
+// Single threaded on the host, nothing to mask
+static inline uint32_t __get_PRIMASK(void) { return 0; }
+static inline void __set_PRIMASK(uint32_t primask) { (void) primask; }
+static inline void __disable_irq(void) { }
+
+#endif
@@ -0,0 +1,304 @@
+#!/usr/bin/env python3
+"""
+Generates the audio engine's constant tables so the firmware does no
+transcendental math at startup or on a mode change.
+
+    python3 Tools/gen_tables.py
+
+rewrites Core/Inc/audio_tables.h and Core/Src/audio_tables.c. Rerun it after
+changing anything below and commit the output with the change. The tables
+the audio path reads every block are tagged FASTDATA to live in SRAM2.
+"""
+import math
+import os
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+HEADER = os.path.join(ROOT, 'Core', 'Inc', 'audio_tables.h')
+SOURCE = os.path.join(ROOT, 'Core', 'Src', 'audio_tables.c')
+
+# Must match NUM_MODES / MAX_NOTES in audio.h and the mode names in audio.c
+MODES = [
+    # name        relative amplitude of each partial
+    ('Piano',    [1, 0.4, 0.2, 0.1, 0.6, 0.15]),
+    ('Alt Sax',  [1, 0, 0, 0, 0, 0]),
+    ('Bright',   [0.75, 0.2, 0.2, 0.2, 0.2, 0.2]),
+    ('Electric', [0.8, 0.6, 0.4, 0.2, 0.1, 0]),
+]
+
+# ADSR per mode, same order as MODES. Attack is a linear rise in ms, decay
+# and release are exponential time constants in ms, sustain is the level
+# held relative to the note's amp. Piano matches the old 0.9992 / 0.95
+# damping per update_amps tick.
+ENVELOPES = [
+    # attack  decay  sustain  release
+    (2,       235,   0,       4),
+    (25,      400,   0.7,     60),
+    (2,       300,   0.25,    8),
+    (1,       600,   0,       15),
+]
+# MAX_NOTES in audio.h can be up to any of these, 12 keys per touch
+# controller. The last one sets how many phase increments there are.
+NOTE_COUNTS = [48, 96]
+LOWEST_FREQ = 65.41  # C2
+
+# Table sizes AUDIO_WAVETABLE_BITS in audio.h can pick from
+WAVETABLE_BITS = [8, 10, 11]
+WAVETABLE_PEAK = 2047  # 12-bit DAC swing either side of mid
+
+# Output soft clip: identity up to SOFT_CLIP_KNEE of full scale, then a
+# tanh curve that reaches full scale at SOFT_CLIP_RANGE times full scale
+SOFT_CLIP_KNEE = 0.5
+SOFT_CLIP_RANGE = 2
+
+# TIM4 clocking from audio.c: BASE_CLK / (PRESCALER + 1) / TIM_PERIOD
+TIM_CLK = 120000000 // 2
+SAMPLE_RATES = [32000, 44100, 48000]
+
+
+def partial_number(j):
+    # Partial j of a profile sounds harmonic 3*j/4 + 1 (integer division),
+    # i.e. 1, 1, 2, 3, 4, 4. This is what the instrument has always played.
+    return 3 * j // 4 + 1
+
+
+def wavetable(amps, max_harmonic, bits):
+    # Partials above max_harmonic are dropped but the level is still set by
+    # the full profile, so a note does not get louder as it loses them.
+    # One extra sample repeats the first so interpolation never wraps.
+    size = 1 << bits
+    total = sum(amps)
+    table = []
+    for i in range(size + 1):
+        s = 0.0
+        for j, a in enumerate(amps):
+            if partial_number(j) <= max_harmonic:
+                s += math.sin(2 * math.pi * i * partial_number(j) / size) * a
+        table.append(int(round(s * WAVETABLE_PEAK / total)))
+    return table
+
+
+def mipmap_bits(notes):
+    # Mip level is the position of the top set bit of the phase increment,
+    # over the range the notes use at any supported rate
+    bits = [inc.bit_length() - 1 for rate in SAMPLE_RATES for inc in phase_incs(rate, notes)]
+    return min(bits), max(bits) - min(bits) + 1
+
+
+def mipmap_max_harmonic(bit):
+    # Increments below 2^(bit+1) are under 2^(bit+1-32) of the sample rate,
+    # harmonic h stays below Nyquist while h * 2^(bit+1-32) <= 1/2. This
+    # does not depend on the sample rate.
+    return 1 << (30 - bit)
+
+
+def mipmaps(bits, notes):
+    # Unique tables and, per mode, the index of each level's table. Going
+    # level by level puts the tables fewer notes need first.
+    base, levels = mipmap_bits(notes)
+    tables = []
+    index = [[] for _ in MODES]
+    for level in range(levels):
+        for (name, amps), row in zip(MODES, index):
+            table = wavetable(amps, mipmap_max_harmonic(base + level), bits)
+            if table not in tables:
+                tables.append(table)
+            row.append(tables.index(table))
+    return tables, index
+
+
+def timer_rate(rate):
+    period = (TIM_CLK + rate // 2) // rate
+    return TIM_CLK / period
+
+
+def phase_incs(rate, notes):
+    actual = timer_rate(rate)
+    incs = []
+    for n in range(notes):
+        freq = LOWEST_FREQ * 2 ** (n / 12)
+        incs.append(int(round(freq / actual * 2 ** 32)))
+    return incs
+
+
+def soft_clip():
+    size = SOFT_CLIP_RANGE * (WAVETABLE_PEAK + 1)
+    knee = SOFT_CLIP_KNEE
+    table = []
+    for i in range(size):
+        x = i / WAVETABLE_PEAK
+        if x > knee:
+            x = knee + (1 - knee) * math.tanh((x - knee) / (1 - knee))
+        table.append(int(round(x * WAVETABLE_PEAK)))
+    return table
+
+
+def envelope_coefs(rate):
+    actual = timer_rate(rate)
+    coefs = []
+    for attack, decay, sustain, release in ENVELOPES:
+        coefs.append((int(round(attack * actual / 1000)),
+                      math.exp(-1000 / (decay * actual)),
+                      sustain,
+                      math.exp(-1000 / (release * actual))))
+    return coefs
+
+
+def c_array(values, per_line, fmt):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append('\t' + ', '.join(fmt(v) for v in values[i:i + per_line]) + ',')
+    return '\n'.join(lines)
+
+
+def note_count_cond(i):
+    # Preprocessor test for MAX_NOTES picking NOTE_COUNTS[i]
+    return f'MAX_NOTES <= {NOTE_COUNTS[i]}' if i == 0 else f'MAX_NOTES > {NOTE_COUNTS[i - 1]}'
+
+
+def mipmap_levels():
+    lines = []
+    for i, notes in enumerate(NOTE_COUNTS):
+        lines.append(f'{"#if" if i == 0 else "#elif"} MAX_NOTES <= {notes}')
+        lines.append(f'#define MIPMAP_LEVELS {mipmap_bits(notes)[1]}')
+    lines.append('#else')
+    lines.append('#error "No mip levels for MAX_NOTES, add it to Tools/gen_tables.py"')
+    lines.append('#endif')
+    return '\n'.join(lines)
+
+
+def write_wavetables(f, bits):
+    # Tables for the largest note count. Fewer notes use a prefix of them,
+    # the rest are left out under #if.
+    tables, index = mipmaps(bits, NOTE_COUNTS[-1])
+    per_count = [mipmaps(bits, notes) for notes in NOTE_COUNTS]
+    for small_tables, _ in per_count:
+        assert small_tables == tables[:len(small_tables)]
+
+    f.write('FASTDATA static const int16_t wavetable_data[][WAVETABLE_SIZE + 1] = {\n')
+    opened = 0
+    for t, table in enumerate(tables):
+        while t >= len(per_count[opened][0]):
+            opened += 1
+            f.write(f'#if {note_count_cond(opened)}\n')
+        users = []
+        for (name, _), row in zip(MODES, index):
+            levels_used = [str(level) for level, i in enumerate(row) if i == t]
+            if levels_used:
+                users.append(f'{name} level {",".join(levels_used)}')
+        f.write(f'\t// {"; ".join(users)}\n\t{{\n')
+        rows = c_array(table, 12, lambda v: f'{v:5d}')
+        f.write(rows.replace('\n\t', '\n\t\t').replace('\t', '\t\t', 1))
+        f.write('\n\t},\n')
+    f.write('#endif\n' * opened)
+    f.write('};\n\n')
+
+    f.write('FASTDATA const int16_t *const wavetables[NUM_MODES][MIPMAP_LEVELS] = {\n')
+    for i, (_, small_index) in enumerate(per_count):
+        f.write(f'{"#if" if i == 0 else "#elif"} MAX_NOTES <= {NOTE_COUNTS[i]}\n')
+        for (name, _), row in zip(MODES, small_index):
+            f.write('\t{' + ', '.join(f'wavetable_data[{j}]' for j in row) + f'}}, // {name}\n')
+    f.write('#endif\n')
+    f.write('};\n')
+
+
+def write_header():
+    with open(HEADER, 'w') as f:
+        f.write(f'''/*
+ * Generated by Tools/gen_tables.py, do not edit.
+ */
+#ifndef AUDIO_TABLES_H
+#define AUDIO_TABLES_H
+
+#include <stdint.h>
+#include "audio.h"
+
+#define WAVETABLE_BITS AUDIO_WAVETABLE_BITS
+#define WAVETABLE_SIZE (1 << WAVETABLE_BITS)
+
+// A voice plays mip level (top set bit of its phase increment) - MIPMAP_BASE_BIT,
+// clamped to the levels there are
+#define MIPMAP_BASE_BIT {mipmap_bits(NOTE_COUNTS[0])[0]}
+{mipmap_levels()}
+
+/*
+ * One cycle of each mode's waveform per mip level, peak {WAVETABLE_PEAK} around
+ * zero, plus a copy of the first sample at [WAVETABLE_SIZE]. Each level
+ * keeps only the partials below Nyquist for the highest phase increment
+ * that uses it; levels that come out the same share a table.
+ */
+extern const int16_t *const wavetables[NUM_MODES][MIPMAP_LEVELS];
+
+/*
+ * Per-note 0.32 fixed-point phase increment at AUDIO_SAMPLE_RATE, enough
+ * for the largest MAX_NOTES.
+ */
+#define NOTE_TABLE_SIZE {NOTE_COUNTS[-1]}
+extern const uint32_t note_phase_inc[NOTE_TABLE_SIZE];
+
+typedef struct envelope_s {{
+	uint32_t attack_samples; // linear rise from 0 to the note's amp
+	float decay; // per-sample factor toward sustain while held
+	float sustain; // held level relative to the note's amp
+	float release; // per-sample factor toward 0 after key-up
+}} envelope_t;
+
+/*
+ * Each mode's ADSR at AUDIO_SAMPLE_RATE.
+ */
+extern const envelope_t mode_envelopes[NUM_MODES];
+
+#define SOFT_CLIP_SIZE {SOFT_CLIP_RANGE * (WAVETABLE_PEAK + 1)}
+
+/*
+ * Soft clip curve for non-negative mix levels, in the same units as the
+ * wavetables. Levels from SOFT_CLIP_SIZE up map to the last entry.
+ */
+extern const int16_t soft_clip[SOFT_CLIP_SIZE];
+
+#endif
+''')
+
+
+def write_source():
+    with open(SOURCE, 'w') as f:
+        f.write('''/*
+ * Generated by Tools/gen_tables.py, do not edit.
+ */
+#include <stdint.h>
+#include "audio_tables.h"
+#include "fastmem.h"
+
+''')
+        f.write(f'#if NUM_MODES != {len(MODES)}\n')
+        f.write('#error "audio.h does not match Tools/gen_tables.py, rerun it"\n')
+        f.write('#endif\n\n')
+
+        for b, bits in enumerate(WAVETABLE_BITS):
+            f.write(f'{"#if" if b == 0 else "#elif"} WAVETABLE_BITS == {bits}\n')
+            write_wavetables(f, bits)
+        f.write('#else\n')
+        f.write('#error "No wavetables for AUDIO_WAVETABLE_BITS, add it to Tools/gen_tables.py"\n')
+        f.write('#endif\n\n')
+
+        f.write('FASTDATA const int16_t soft_clip[SOFT_CLIP_SIZE] = {\n')
+        f.write(c_array(soft_clip(), 16, lambda v: f'{v:4d}'))
+        f.write('\n};\n\n')
+
+        for i, rate in enumerate(SAMPLE_RATES):
+            f.write(f'{"#if" if i == 0 else "#elif"} AUDIO_SAMPLE_RATE == {rate}\n')
+            f.write(f'// TIM4 actually runs at {timer_rate(rate):.3f} Hz\n')
+            f.write('const uint32_t note_phase_inc[NOTE_TABLE_SIZE] = {\n')
+            f.write(c_array(phase_incs(rate, NOTE_COUNTS[-1]), 6, lambda v: f'0x{v:08x}'))
+            f.write('\n};\n\n')
+            f.write('FASTDATA const envelope_t mode_envelopes[NUM_MODES] = {\n')
+            for (name, _), (a, d, s, r) in zip(MODES, envelope_coefs(rate)):
+                f.write(f'\t{{{a:4d}, {d:.9f}f, {s:.2f}f, {r:.9f}f}}, // {name}\n')
+            f.write('};\n')
+        f.write('#else\n')
+        f.write('#error "No phase increments for AUDIO_SAMPLE_RATE, add it to Tools/gen_tables.py"\n')
+        f.write('#endif\n')
+
+
+if __name__ == '__main__':
+    write_header()
+    write_source()